@@ -1,13 +1,19 @@
 #pragma once
 
 #include "common/base_agent.hpp"
+#include "common/session_handoff.hpp"
 #include "network/websocket_handler.hpp"
 #include "network/load_balancer.hpp"
+#include "network/udp_channel.hpp"
 #include <boost/asio.hpp>
 #include <memory>
 #include <unordered_map>
 #include <atomic>
+#include <functional>
 #include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace mmorpg::agents::connection_manager {
 
@@ -21,8 +27,23 @@ struct ConnectionInfo {
     std::chrono::time_point<std::chrono::high_resolution_clock> connected_at;
     std::chrono::time_point<std::chrono::high_resolution_clock> last_activity;
     bool is_authenticated = false;
+    // 에이전트 안에서는 UDP 바이트만 누적하고, get_connection_info()가 WebSocket 바이트를 더해 돌려줌
     std::atomic<uint64_t> bytes_sent{0};
     std::atomic<uint64_t> bytes_received{0};
+    
+    ConnectionInfo() = default;
+    
+    // 조회용 복사 (get_connection_info) - 원자 변수는 현재 값으로 복사
+    ConnectionInfo(const ConnectionInfo& other)
+        : connection_id(other.connection_id)
+        , user_id(other.user_id)
+        , ip_address(other.ip_address)
+        , connected_at(other.connected_at)
+        , last_activity(other.last_activity)
+        , is_authenticated(other.is_authenticated)
+        , bytes_sent(other.bytes_sent.load())
+        , bytes_received(other.bytes_received.load()) {
+    }
 };
 
 /**
@@ -33,7 +54,39 @@ struct ConnectionInfo {
  */
 class ConnectionManagerAgent : public mmorpg::common::BaseAgent {
 public:
-    explicit ConnectionManagerAgent(uint32_t max_connections = 5000);
+    /**
+     * @brief 사용자 로그인(인증 완료)/로그아웃(인증된 연결 해제) 알림
+     */
+    using SessionListener = std::function<void(const std::string& user_id, bool online)>;
+    
+    /**
+     * @brief 이전할 세션 전달 (송신 큐를 떼어 낸 I/O 스레드에서 호출)
+     */
+    using HandoffCallback = std::function<void(common::SessionHandoff handoff)>;
+    
+    /**
+     * @brief 다른 노드에서 넘어온 세션이 새 연결에서 재개됨 (state 복원용)
+     */
+    using ResumeListener = std::function<void(const std::string& connection_id, const common::SessionHandoff& handoff)>;
+    
+    // 넘겨받은 세션을 클라이언트의 ResumeRequest까지 보관하는 시간
+    static constexpr std::chrono::seconds kHandoffTimeout{10};
+    
+    // 세션보다 먼저 도착한 ResumeRequest를 기다리는 시간
+    static constexpr std::chrono::milliseconds kResumeWaitTimeout{2000};
+    
+    // 수신 프레임 기본 한도 (set_frame_limits 전)
+    static constexpr size_t kDefaultMaxFramePreAuth = 4 * 1024;
+    static constexpr size_t kDefaultMaxFrame = 64 * 1024;
+
+    /**
+     * @param max_connections 동시 접속 한도
+     * @param port WebSocket 리스닝 포트
+     * @param worker_threads WebSocket I/O 스레드 수 (0이면 코어 수)
+     */
+    explicit ConnectionManagerAgent(uint32_t max_connections = 5000,
+                                    uint16_t port = 8080,
+                                    uint32_t worker_threads = 0);
     ~ConnectionManagerAgent() override = default;
 
     void start() override;
@@ -41,6 +94,8 @@ public:
 
     /**
      * @brief 새로운 연결 처리
+     *
+     * 동시 접속 한도를 넘었거나 CONNECTIONS/BUFFERS 메모리 계정이 예산을 넘었으면 거부합니다.
      * @param connection_id 연결 ID
      * @param ip_address 클라이언트 IP 주소
      * @return 연결 허용 여부
@@ -68,6 +123,73 @@ public:
      */
     void update_activity(const std::string& connection_id);
 
+    /**
+     * @brief 세션 리스너 설정 (start 이전에 호출, 연결 잠금 밖에서 호출됨)
+     */
+    void set_session_listener(SessionListener listener);
+    
+    /**
+     * @brief UDP 보조 채널 사용 (start 이전에 호출)
+     *
+     * 인증된 연결마다 UDP 세션을 열고 UdpOffer(port, token)를 WebSocket으로 보냅니다.
+     * UDP로 받은 프레임은 바이너리 WebSocket 프레임과 같은 경로로 처리됩니다.
+     */
+    void enable_udp_channel(network::UdpChannelOptions options);
+    
+    /**
+     * @brief 고빈도 프레임 전송 (이동, 스냅샷)
+     *
+     * 클라이언트가 UDP 바인드를 마쳤으면 UDP로, 아니면 WebSocket 바이너리 프레임으로 보냅니다.
+     * 비신뢰 UDP 프레임은 같은 lane의 더 새 프레임이 먼저 도착하면 버려집니다.
+     * WebSocket으로 보내는 비신뢰 프레임은 LOW 우선순위라 대역폭 한도에 걸리면 미뤄집니다.
+     */
+    void send_datagram(const std::string& connection_id, uint16_t lane, const std::string& frame,
+                       bool reliable = false);
+    
+    /**
+     * @brief 인증된 연결을 다른 노드로 이전
+     *
+     * 쓰기 중이 아닌 송신 큐를 떼어 내고 MigrateRedirect(host, port, token)를 마지막 프레임으로
+     * 보낸 뒤 연결을 닫습니다. 떼어 낸 프레임과 state는 on_handoff로 넘어가며, 호출자가
+     * 대상 노드에 전달해 그 노드의 accept_handoff()로 등록합니다.
+     * @return 인증된 연결이 아니면 false
+     */
+    bool migrate_connection(const std::string& connection_id, const std::string& host, uint16_t port,
+                            const std::string& token, std::string state, HandoffCallback on_handoff);
+    
+    /**
+     * @brief 노드 종료 드레인 시작: 새 연결 수락을 멈추고 이후 handle_new_connection은 거부
+     */
+    void begin_drain();
+    
+    bool is_draining() const;
+    
+    /**
+     * @brief 남은 연결을 모두 재접속 안내 후 닫음 (begin_drain 이후, 세션 이전을 마친 다음 호출)
+     *
+     * 연결마다 송신 큐를 끝까지 보내고 Reconnect(host, port, delay_ms)를 마지막 프레임으로 보낸 뒤
+     * going_away로 닫습니다. 대상은 LoadBalancer::select_servers()로 exclude_node_id를 뺀 노드에
+     * 수용량 비례로 나누고(없으면 host를 비워 같은 주소), delay_ms는 [0, reconnect_spread]에서
+     * 무작위로 골라 재접속이 한 시점에 몰리지 않게 합니다.
+     * @return 드레인을 요청한 연결 수 (이미 이전 중인 연결은 Reconnect 없이 이전 절차대로 닫힘)
+     */
+    size_t drain_connections(std::chrono::milliseconds reconnect_spread, const std::string& exclude_node_id = "");
+    
+    /**
+     * @brief 다른 노드에서 넘어온 세션 등록 (이미 ResumeRequest가 와 있으면 즉시 재개)
+     */
+    void accept_handoff(common::SessionHandoff handoff);
+    
+    /**
+     * @brief 세션 재개 리스너 설정 (start 이전에 호출)
+     */
+    void set_resume_listener(ResumeListener listener);
+    
+    /**
+     * @brief 인증된 연결 ID (최대 limit개, 재분배 대상 선택용)
+     */
+    std::vector<std::string> get_authenticated_connection_ids(size_t limit) const;
+
     /**
      * @brief 연결 통계 반환
      */
@@ -83,15 +205,137 @@ public:
      */
     void cleanup_inactive_connections(std::chrono::seconds timeout = std::chrono::seconds(300));
 
+    /**
+     * @brief 동시 접속 한도 변경 (설정 리로드 시 호출, 기존 연결은 유지)
+     */
+    void set_max_connections(uint32_t max_connections);
+    
+    /**
+     * @brief 수신 프레임 크기/속도 한도 변경 (설정 리로드 시 호출, 기존 연결에도 적용)
+     *
+     * opcode 허용 목록은 연결 상태로 정합니다: 인증 전에는 Heartbeat, LoginRequest, ResumeRequest와
+     * JSON 텍스트만, 인증 후에는 클라이언트가 보내는 메시지만 받습니다. 위반한 연결은 디코드 전에 끊깁니다.
+     * @param messages_per_second 연결당 초당 메시지 수 (0이면 제한 없음)
+     */
+    void set_frame_limits(size_t max_frame_pre_auth, size_t max_frame,
+                          uint32_t messages_per_second, uint32_t message_burst);
+    
+    /**
+     * @brief RTT 측정 핑 주기 (start 이전에 호출, 0이면 측정하지 않음)
+     */
+    void set_ping_interval(std::chrono::milliseconds interval);
+    
+    /**
+     * @brief 클라이언트 연결의 세션 구동 방식 (start 이전에 호출)
+     */
+    void set_session_mode(network::SessionMode mode);
+    
+    /**
+     * @brief 송신 대역폭 한도 변경 (설정 리로드 시 호출, 기존 연결에도 적용, 0이면 제한 없음)
+     *
+     * 한도를 넘으면 LOW 프레임(WebSocket으로 가는 비신뢰 send_datagram)이 미뤄지고
+     * 나머지 프레임은 그대로 나갑니다.
+     */
+    void set_bandwidth_limits(uint64_t connection_bytes_per_second, uint64_t node_bytes_per_second);
+    
+    uint32_t get_max_connections() const;
+    
+    /**
+     * @brief 현재 연결 수
+     */
+    uint32_t get_connection_count() const;
+    
+    /**
+     * @brief WebSocket 핸들러 반환 (모니터링 연결용)
+     */
+    const network::WebSocketHandler& get_websocket_handler() const;
+    
+    /**
+     * @brief 로드 밸런서 반환 (클러스터 멤버십 연결용)
+     */
+    network::LoadBalancer& get_load_balancer();
+    
+    /**
+     * @brief UDP 보조 채널 (비활성이거나 바인드 실패 시 nullptr)
+     */
+    const network::UdpChannel* get_udp_channel() const;
+
 private:
-    uint32_t max_connections_;
+    class ClientMessageHandler;
+    
+    /**
+     * @brief 클라이언트 프레임 처리 (WebSocket I/O 스레드에서 호출)
+     *
+     * 바이너리 프레임은 protocol::dispatch로 opcode별 핸들러에 전달하고,
+     * 텍스트 프레임은 JSON으로 처리합니다.
+     */
+    void on_client_message(const std::string& connection_id, std::string_view message, bool is_binary);
+    
+    /**
+     * @brief JSON 텍스트 프레임 처리 (브라우저 클라이언트, 관리 도구)
+     *
+     * 수신 버퍼를 제자리에서 파싱하고 "type" 필드로 분기합니다.
+     */
+    void on_json_message(const std::string& connection_id, std::string_view message);
+    
+    void reject_frame(const std::string& connection_id, std::string_view reason, size_t size);
+    
+    /**
+     * @brief UDP로 주고받은 바이트를 ConnectionInfo에 누적
+     */
+    void record_datagram_bytes(const std::string& connection_id, size_t sent, size_t received);
+    
+    /**
+     * @brief ResumeRequest 처리 - 세션이 아직 안 왔으면 kResumeWaitTimeout까지 대기
+     */
+    void resume_connection(const std::string& connection_id, std::string_view token);
+    
+    void complete_resume(const std::string& connection_id, common::SessionHandoff handoff);
+    
+    void send_resume_failure(const std::string& connection_id);
+    
+    /**
+     * @brief 인증된 연결의 UDP 세션을 열고 UdpOffer 전송
+     */
+    void offer_udp_channel(const std::string& connection_id);
+    
+    /**
+     * @brief 만료된 세션/대기 중인 재개 요청 정리 (cleanup_inactive_connections에서 호출)
+     */
+    void expire_handoffs();
+    
+    struct PendingHandoff {
+        common::SessionHandoff handoff;
+        std::chrono::steady_clock::time_point expires_at;
+    };
+    
+    struct ParkedResume {
+        std::string connection_id;
+        std::chrono::steady_clock::time_point expires_at;
+    };
+    
+    std::atomic<uint32_t> max_connections_;
     std::atomic<uint32_t> current_connections_{0};
+    std::atomic<uint32_t> authenticated_connections_{0};
+    std::atomic<uint64_t> rejected_frames_{0};
+    std::atomic<bool> draining_{false};
+    
+    // 이 에이전트 이름으로 태그된 메모리 계정 (WebSocket 연결과 공유)
+    common::MemoryAccount& connection_memory_;
+    common::MemoryAccount& buffer_memory_;
     
     mutable std::mutex connections_mutex_;
     std::unordered_map<std::string, std::unique_ptr<ConnectionInfo>> connections_;
     
     std::unique_ptr<network::WebSocketHandler> websocket_handler_;
     std::unique_ptr<network::LoadBalancer> load_balancer_;
+    std::unique_ptr<network::UdpChannel> udp_channel_;
+    SessionListener session_listener_;
+    ResumeListener resume_listener_;
+    
+    std::mutex handoffs_mutex_;
+    std::unordered_map<std::string, PendingHandoff> handoffs_;        // token -> 넘겨받은 세션
+    std::unordered_map<std::string, ParkedResume> parked_resumes_;    // token -> 세션을 기다리는 연결
     
     boost::asio::io_context io_context_;
     std::unique_ptr<boost::asio::io_context::work> work_;
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "common/session_handoff.hpp"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mmorpg::cluster {
+class ClusterBatch;
+class ClusterTransport;
+} // namespace mmorpg::cluster
+
+namespace mmorpg::agents::connection_manager {
+
+class ConnectionManagerAgent;
+
+/**
+ * @brief 세션 이전 누적 통계
+ */
+struct MigrationStats {
+    uint64_t started = 0;         // 클라이언트에 리다이렉트를 보낸 세션
+    uint64_t sent = 0;            // 대상 노드 배치에 실은 세션
+    uint64_t received = 0;        // 다른 노드에서 넘겨받은 세션
+    uint64_t failed = 0;          // 대상 노드로 보내지 못한 세션 (피어 없음, 대기 한도 초과)
+    uint64_t pending_frames = 0;  // 넘겨준 미전송 프레임 합계
+};
+
+/**
+ * @brief 노드 간 실시간 세션 이전
+ *
+ * migrate()는 연결의 송신 큐를 떼어 내고 클라이언트에 MigrateRedirect를 보낸 뒤, 세션(user_id,
+ * 게임 상태, 미전송 프레임)을 SessionTransfer로 대상 노드에 보냅니다. 대상 노드는 이를
+ * ConnectionManagerAgent::accept_handoff()로 등록하고, 클라이언트가 새 연결에서 토큰을 제출하면
+ * 인증 상태와 미전송 프레임을 이어받아 재개합니다.
+ *
+ * 클라이언트 재접속과 노드 간 전송이 동시에 진행되고 먼저 도착한 쪽이 다른 쪽을 기다리므로,
+ * 끊김 시간은 대략 max(클라이언트 재접속, 다음 틱 flush + 노드 간 RTT)입니다.
+ *
+ * 대상 노드의 클라이언트 접속 주소는 LoadBalancer(가십 멤버십이 채움)에서 찾습니다.
+ * migrate/rebalance/poll은 틱 스레드에서, on_batch는 전송 계층 배치 핸들러에서 호출합니다.
+ */
+class SessionMigrator {
+public:
+    /**
+     * @brief 이전할 플레이어의 게임 상태 직렬화 (틱 스레드에서 호출)
+     */
+    using StateProvider = std::function<std::string(const std::string& user_id)>;
+
+    SessionMigrator(ConnectionManagerAgent& connection_manager, cluster::ClusterTransport& transport);
+
+    SessionMigrator(const SessionMigrator&) = delete;
+    SessionMigrator& operator=(const SessionMigrator&) = delete;
+
+    void set_state_provider(StateProvider provider);
+
+    /**
+     * @brief 인증된 연결을 target_node로 이전 시작
+     * @return 대상 노드 주소를 모르거나 피어가 없거나 인증된 연결이 아니면 false
+     */
+    bool migrate(const std::string& connection_id, const std::string& target_node);
+
+    /**
+     * @brief 기존 세션 재분배
+     *
+     * 이 노드의 부하 점수가 가장 한가한 노드보다 threshold 이상 높으면, 두 노드의 연결 수 차이의
+     * 절반(최대 max_sessions)만큼 그 노드로 이전합니다.
+     * @return 이전을 시작한 세션 수
+     */
+    size_t rebalance(size_t max_sessions, double threshold = 0.2);
+
+    /**
+     * @brief 노드 종료 드레인: 인증된 세션을 모두 다른 노드로 이전
+     *
+     * 대상은 LoadBalancer::select_servers()로 남은 수용량에 비례해 나누므로 한 노드로 몰리지 않습니다.
+     * 이전하지 못한 연결은 ConnectionManagerAgent::drain_connections()가 재접속 안내 후 닫습니다.
+     * @return 이전을 시작한 세션 수
+     */
+    size_t evacuate();
+
+    /**
+     * @brief 수신 배치의 SessionTransfer를 연결 관리자에 등록
+     */
+    void on_batch(const cluster::ClusterBatch& batch);
+
+    /**
+     * @brief 떼어 낸 세션을 대상 노드 배치에 추가 (틱마다 transport.flush() 직전에 호출)
+     */
+    void poll();
+
+    MigrationStats get_stats() const;
+
+private:
+    std::string generate_token();
+
+    ConnectionManagerAgent& connection_manager_;
+    cluster::ClusterTransport& transport_;
+    StateProvider state_provider_;
+    std::random_device random_;   // 토큰은 추측할 수 없어야 하므로 OS 난수원 사용
+
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::string, common::SessionHandoff>> outbox_;   // (대상 노드, 세션)
+    MigrationStats stats_;
+};
+
+} // namespace mmorpg::agents::connection_manager
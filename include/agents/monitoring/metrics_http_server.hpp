@@ -0,0 +1,76 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/beast.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace mmorpg::agents::monitoring {
+
+namespace beast = boost::beast;
+namespace http = beast::http;
+namespace net = boost::asio;
+using tcp = boost::asio::ip::tcp;
+
+/**
+ * @brief 메트릭 스크레이핑용 경량 HTTP 서버
+ *
+ * 단일 스레드에서 GET 요청만 처리합니다. 응답 본문은 등록된
+ * 프로바이더가 반환하며, 프로바이더는 미리 렌더링된 문자열을
+ * 돌려주도록 해서 스크레이프가 집계 비용을 유발하지 않게 합니다.
+ */
+class MetricsHttpServer {
+public:
+    using Provider = std::function<std::string()>;
+
+    explicit MetricsHttpServer(uint16_t port);
+    ~MetricsHttpServer();
+
+    MetricsHttpServer(const MetricsHttpServer&) = delete;
+    MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+    /**
+     * @brief 경로별 응답 프로바이더 등록 (start 이전에 호출)
+     */
+    void add_route(const std::string& path, const std::string& content_type, Provider provider);
+
+    /**
+     * @brief 서버 시작
+     * @return 리스닝 성공 여부
+     */
+    bool start();
+
+    /**
+     * @brief 서버 중지
+     */
+    void stop();
+
+    /**
+     * @brief 실제 바인딩된 포트 (port 0으로 생성한 경우 확인용)
+     */
+    uint16_t get_port() const;
+
+private:
+    struct Route {
+        std::string content_type;
+        Provider provider;
+    };
+
+    class Session;
+
+    void start_accept();
+    http::response<http::string_body> handle_request(const http::request<http::string_body>& request) const;
+
+    uint16_t port_;
+    net::io_context io_context_;
+    tcp::acceptor acceptor_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::unordered_map<std::string, Route> routes_;
+};
+
+} // namespace mmorpg::agents::monitoring
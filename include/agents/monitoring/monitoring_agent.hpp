@@ -0,0 +1,192 @@
+#pragma once
+
+#include "cluster/cluster_transport.hpp"
+#include "common/base_agent.hpp"
+#include "common/memory_accounting.hpp"
+#include "common/metrics.hpp"
+#include "common/numa.hpp"
+#include "network/message_stats.hpp"
+#include "network/websocket_handler.hpp"
+#include "agents/monitoring/metrics_http_server.hpp"
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mmorpg::agents::monitoring {
+
+/**
+ * @brief 집계 구간 하나의 opcode별 통계
+ */
+struct OpcodeRate {
+    std::string opcode;
+    double inbound_per_second = 0.0;
+    double inbound_bytes_per_second = 0.0;
+    double outbound_per_second = 0.0;
+    double outbound_bytes_per_second = 0.0;
+    double handler_p50_us = 0.0;
+    double handler_p99_us = 0.0;
+};
+
+/**
+ * @brief 집계 구간 하나의 연결별 트래픽 (상위 연결)
+ */
+struct TopTalker {
+    std::string connection_id;
+    double messages_per_second = 0.0;
+    double bytes_per_second = 0.0;
+};
+
+/**
+ * @brief 집계 구간 하나의 클러스터 피어별 처리량 및 ack 지연
+ */
+struct ClusterPeerRate {
+    std::string node_id;
+    bool connected = false;
+    double sent_messages_per_second = 0.0;
+    double sent_bytes_per_second = 0.0;
+    double received_messages_per_second = 0.0;
+    double received_bytes_per_second = 0.0;
+    uint32_t in_flight_batches = 0;
+    double ack_p50_us = 0.0;
+    double ack_p99_us = 0.0;
+};
+
+/**
+ * @brief 집계 결과 스냅샷
+ */
+struct MonitoringSnapshot {
+    double interval_seconds = 0.0;
+    size_t connection_count = 0;
+    size_t outbound_queue_depth = 0;
+    double inbound_per_second = 0.0;
+    double outbound_per_second = 0.0;
+    double inbound_bytes_per_second = 0.0;
+    double outbound_bytes_per_second = 0.0;
+    double handler_p50_us = 0.0;
+    double handler_p99_us = 0.0;
+    double rtt_p50_ms = 0.0;                           // 구간 동안 측정한 클라이언트 RTT
+    double rtt_p99_ms = 0.0;
+    mmorpg::common::HistogramSnapshot client_rtt;      // 클라이언트 RTT 누적 분포
+    std::vector<OpcodeRate> opcodes;
+    std::vector<TopTalker> top_talkers;
+    std::vector<ClusterPeerRate> cluster_peers;
+    std::unordered_map<std::string, std::unordered_map<std::string, double>> agent_metrics;
+    mmorpg::common::NumaStats numa;
+    std::vector<mmorpg::common::MemoryUsage> memory;   // 소유자/분류별 메모리 계정
+    size_t memory_over_budget = 0;                     // 예산을 넘은 계정 수
+    network::FrameRejectionCounts frame_rejections{};  // 수신 검증으로 끊은 연결 수 (이유별 누적)
+    network::EgressStats egress;                       // 대역폭 한도로 미룬 LOW 프레임 (누적)
+};
+
+/**
+ * @brief Monitoring Agent
+ *
+ * 등록된 모든 에이전트의 메트릭과 네트워크 계층의 opcode별 처리량,
+ * 바이트 수, 핸들러 지연 시간 히스토그램, 상위 트래픽 연결, 송신 대기열
+ * 깊이를 주기적으로 집계합니다. 결과는 Prometheus 텍스트 포맷으로
+ * 미리 렌더링해 두고 HTTP(/metrics)로 노출하며, 한 줄 요약을 로그로 남깁니다.
+ * 핫 패스에서는 relaxed 원자 카운터만 증가시키고 나머지 계산은
+ * 집계 스레드가 구간마다 한 번 수행합니다. 메모리 계정의 예산 검사
+ * (MemoryRegistry::check_budgets)도 집계마다 이 스레드에서 실행됩니다.
+ */
+class MonitoringAgent : public mmorpg::common::BaseAgent {
+public:
+    explicit MonitoringAgent(std::chrono::seconds interval = std::chrono::seconds(10),
+                             uint16_t http_port = 8000,
+                             size_t top_talker_count = 10);
+    ~MonitoringAgent() override;
+
+    void start() override;
+    void stop() override;
+
+    /**
+     * @brief 수집 대상 에이전트 등록 (에이전트는 해제 전까지 유효해야 함)
+     */
+    void register_agent(const mmorpg::common::BaseAgent* agent);
+
+    /**
+     * @brief 수집 대상 에이전트 해제
+     */
+    void unregister_agent(const mmorpg::common::BaseAgent* agent);
+
+    /**
+     * @brief 네트워크 계층 연결 (opcode 통계, 연결별 트래픽, 대기열 깊이)
+     */
+    void attach_network(const network::WebSocketHandler* handler);
+
+    /**
+     * @brief 클러스터 전송 계층 연결 (피어별 처리량, 미확인 배치, ack 지연)
+     */
+    void attach_cluster(const cluster::ClusterTransport* transport);
+
+    /**
+     * @brief 즉시 한 번 집계 (테스트 및 종료 직전 수집용)
+     */
+    void aggregate_now();
+
+    /**
+     * @brief 마지막 집계 결과
+     */
+    MonitoringSnapshot get_last_snapshot() const;
+
+    /**
+     * @brief 마지막 집계 결과의 Prometheus 텍스트
+     */
+    std::string render_prometheus() const;
+
+    /**
+     * @brief 마지막 집계 결과의 한 줄 요약
+     */
+    std::string render_summary() const;
+
+    std::unordered_map<std::string, std::string> health_check() const override;
+
+private:
+    void run_aggregation_loop();
+    void aggregate();
+    void aggregate_cluster(MonitoringSnapshot& snapshot, double seconds,
+                           const std::vector<cluster::PeerStats>& peers,
+                           const std::vector<cluster::InboundStats>& inbound);
+    std::string build_prometheus(const MonitoringSnapshot& snapshot,
+                                 const std::array<network::OpcodeStatsSnapshot, network::MessageStats::kSlots>& totals,
+                                 const std::vector<cluster::PeerStats>& peers,
+                                 const std::vector<cluster::InboundStats>& inbound) const;
+    static std::string build_summary(const MonitoringSnapshot& snapshot);
+
+    std::chrono::seconds interval_;
+    uint16_t http_port_;
+    size_t top_talker_count_;
+
+    mutable std::mutex sources_mutex_;
+    std::vector<const mmorpg::common::BaseAgent*> agents_;
+    const network::WebSocketHandler* network_ = nullptr;
+    const cluster::ClusterTransport* cluster_ = nullptr;
+
+    // 집계 스레드 전용 상태 (이전 구간 값)
+    std::mutex aggregate_mutex_;
+    std::array<network::OpcodeStatsSnapshot, network::MessageStats::kSlots> previous_opcodes_{};
+    mmorpg::common::HistogramSnapshot previous_rtt_;
+    std::unordered_map<std::string, network::ConnectionTraffic> previous_traffic_;
+    std::unordered_map<std::string, cluster::PeerStats> previous_peers_;
+    std::unordered_map<std::string, cluster::InboundStats> previous_inbound_;
+    std::chrono::steady_clock::time_point previous_time_;
+
+    // 발행된 결과
+    mutable std::mutex snapshot_mutex_;
+    MonitoringSnapshot last_snapshot_;
+    std::string prometheus_text_;
+    std::string summary_text_;
+
+    std::thread aggregation_thread_;
+    std::mutex wakeup_mutex_;
+    std::condition_variable wakeup_cv_;
+
+    std::unique_ptr<MetricsHttpServer> http_server_;
+};
+
+} // namespace mmorpg::agents::monitoring
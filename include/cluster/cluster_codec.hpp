@@ -0,0 +1,78 @@
+#pragma once
+
+#include "cluster/message_arena.hpp"
+#include "common/buffer_pool.hpp"
+#include "protocol/cluster.pb.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace mmorpg::cluster {
+
+/**
+ * @brief 배치를 풀 버퍼에 직렬화
+ *
+ * ByteSizeLong()으로 크기를 한 번 계산(캐시)한 뒤 SerializeWithCachedSizesToArray로
+ * 버퍼에 직접 기록합니다. 풀 버퍼 용량이 충분하면 힙 할당이 없습니다.
+ */
+common::PooledBuffer encode_batch(const ClusterBatch& batch, common::BufferPool& pool);
+
+/**
+ * @brief 수신 프레임에서 Arena 위에 배치 파싱
+ *
+ * 프레임을 중간 버퍼로 복사하지 않고 직접 파싱합니다.
+ * 반환값은 arena.reset() 전까지 유효하며, 파싱에 실패하면 nullptr입니다.
+ */
+ClusterBatch* decode_batch(std::string_view frame, MessageArena& arena);
+
+/**
+ * @brief 스트림 하나의 틱당 배치 작성기
+ *
+ * add_message()로 받은 메시지는 현재 배치의 Arena에 할당됩니다.
+ * flush()는 배치를 직렬화하고 Arena를 리셋한 뒤 다음 배치를 시작합니다.
+ * 스레드 안전하지 않습니다.
+ *
+ * protobuf 3.21은 문자열 객체만 Arena에 두고 15바이트를 넘는 내용은 힙에 할당합니다.
+ * 문자열 필드는 mutable_xxx()->assign()으로 채워야 임시 std::string 할당이 추가로 생기지 않습니다.
+ */
+class ClusterBatchWriter {
+public:
+    explicit ClusterBatchWriter(std::string source_node,
+                                size_t initial_arena_block_size = MessageArena::kDefaultInitialBlockSize);
+
+    /**
+     * @brief 현재 배치에 메시지 추가 (sequence는 자동 증가)
+     */
+    ClusterMessage* add_message();
+
+    /**
+     * @brief 현재 배치의 메시지 수
+     */
+    int size() const noexcept {
+        return batch_->messages_size();
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 현재 배치를 직렬화하고 새 배치 시작
+     * @param tick 배치에 기록할 틱 번호
+     */
+    common::PooledBuffer flush(uint64_t tick, common::BufferPool& pool);
+
+    const MessageArena& get_arena() const noexcept {
+        return arena_;
+    }
+
+private:
+    void begin_batch();
+
+    std::string source_node_;
+    MessageArena arena_;
+    ClusterBatch* batch_ = nullptr;
+    uint64_t next_sequence_ = 1;
+};
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "cluster/cluster_transport.hpp"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace mmorpg::cluster {
+
+enum class RouteResult {
+    LOCAL,        // 대상이 이 노드에 있음 (호출자가 직접 처리)
+    FORWARDED,    // 피어 배치에 추가됨
+    UNROUTABLE,   // 대상 노드를 모르거나 피어가 없음
+    DROPPED       // 피어의 대기 한도 초과
+};
+
+inline const char* to_string(RouteResult result) noexcept {
+    switch (result) {
+        case RouteResult::LOCAL:      return "local";
+        case RouteResult::FORWARDED:  return "forwarded";
+        case RouteResult::UNROUTABLE: return "unroutable";
+        case RouteResult::DROPPED:    return "dropped";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief 노드 간 메시지 라우터
+ *
+ * 귓속말은 플레이어 위치 조회로, 존 행동은 존 소유 노드로, 길드 채팅은 모든 피어로
+ * 보냅니다. 메시지는 전송 계층의 현재 틱 배치에 추가되어 다음 flush()에서 전송됩니다.
+ * 틱 스레드에서만 사용합니다.
+ */
+class ClusterRouter {
+public:
+    /**
+     * @brief 플레이어가 접속한 노드 조회 (모르면 nullopt)
+     */
+    using PlayerLocator = std::function<std::optional<std::string>(uint64_t player_id)>;
+
+    explicit ClusterRouter(ClusterTransport& transport);
+
+    void set_player_locator(PlayerLocator locator);
+
+    /**
+     * @brief 존 소유 노드 지정
+     */
+    void assign_zone(uint32_t zone_id, const std::string& node_id);
+
+    std::optional<std::string> get_zone_owner(uint32_t zone_id) const;
+
+    RouteResult route_whisper(uint64_t sender_id, uint64_t target_id,
+                              std::string_view sender_name, std::string_view text);
+
+    /**
+     * @brief 모든 피어로 길드 채팅 팬아웃
+     * @return 메시지를 추가한 피어 수
+     */
+    size_t route_guild_chat(uint64_t guild_id, uint64_t sender_id,
+                            std::string_view sender_name, std::string_view text);
+
+    RouteResult route_zone_action(uint32_t zone_id, uint64_t actor_id, uint64_t target_id,
+                                  uint32_t action, std::string_view payload = {});
+
+private:
+    /**
+     * @brief 대상 노드 배치에 메시지 추가 (sent_at_us 기록)
+     */
+    ClusterMessage* begin_message(const std::string& node_id);
+
+    RouteResult resolve(const std::optional<std::string>& node_id, ClusterMessage*& message);
+
+    ClusterTransport& transport_;
+    PlayerLocator player_locator_;
+    std::unordered_map<uint32_t, std::string> zone_owners_;
+};
+
+} // namespace mmorpg::cluster
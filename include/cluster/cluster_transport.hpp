@@ -0,0 +1,175 @@
+#pragma once
+
+#include "cluster/cluster_codec.hpp"
+#include "common/buffer_pool.hpp"
+#include "common/metrics.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace grpc {
+class Server;
+} // namespace grpc
+
+namespace mmorpg::cluster {
+
+/**
+ * @brief 송신 피어(원격 노드) 하나의 누적 통계
+ */
+struct PeerStats {
+    std::string node_id;
+    std::string address;
+    bool connected = false;
+    uint64_t batches_sent = 0;
+    uint64_t messages_sent = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t batches_acked = 0;
+    uint64_t dropped_messages = 0;       // 대기 한도 초과 또는 스트림 끊김으로 잃은 메시지
+    uint64_t reconnects = 0;
+    uint32_t in_flight_batches = 0;      // 전송했으나 아직 확인(ack)받지 못한 배치
+    uint32_t pending_messages = 0;       // 다음 flush를 기다리는 메시지
+    common::HistogramSnapshot ack_latency;  // 배치 전송 → ack 수신 왕복 시간
+};
+
+/**
+ * @brief 수신 측 원격 노드 하나의 누적 통계 (배치의 source_node 기준)
+ */
+struct InboundStats {
+    std::string node_id;
+    uint64_t batches_received = 0;
+    uint64_t messages_received = 0;
+    uint64_t bytes_received = 0;
+};
+
+struct TransportOptions {
+    std::string node_id;
+    std::string listen_address = "127.0.0.1:0";        // host:port (포트 0이면 커널 할당)
+    uint32_t max_in_flight_batches = 8;                // 피어별 미확인 배치 한도 (흐름 제어 창)
+    uint32_t max_pending_messages = 65536;             // 창이 찼을 때 피어별로 쌓아 둘 메시지 한도
+    std::chrono::milliseconds reconnect_backoff{500};  // 스트림이 끊긴 뒤 재연결 대기
+};
+
+/**
+ * @brief 노드 간 gRPC 양방향 스트림 전송 계층
+ *
+ * 피어마다 스트림 하나를 열고, 틱 동안 add_message()로 쌓은 메시지를 flush()에서
+ * ClusterBatch 하나로 묶어 보냅니다. 수신 측은 배치를 Arena 위에 파싱해 핸들러에
+ * 넘긴 뒤 같은 스트림으로 ack를 돌려보냅니다.
+ *
+ * 흐름 제어: ack를 받지 못한 배치가 max_in_flight_batches에 이르면 그 피어는 flush를
+ * 건너뛰고 메시지를 다음 배치에 계속 쌓습니다. 쌓인 메시지가 max_pending_messages를
+ * 넘으면 add_message()가 nullptr을 반환합니다. 끊긴 스트림은 reconnect_backoff 뒤
+ * flush()에서 다시 엽니다. 끊길 때 전송 중이던 배치는 재전송하지 않습니다 (최대 한 번 전달).
+ *
+ * 생성 코드 플러그인 없이 gRPC generic API(ByteBuffer)를 사용하므로 배치 직렬화는
+ * cluster_codec의 풀 버퍼/Arena 경로를 그대로 씁니다.
+ *
+ * add_peer/remove_peer/add_message/flush는 틱 스레드 하나에서 호출해야 합니다.
+ * 통계 조회는 어느 스레드에서나 가능합니다.
+ */
+class ClusterTransport {
+public:
+    /**
+     * @brief 수신 배치 핸들러 (gRPC 스레드에서 호출, 배치는 반환 후 무효)
+     */
+    using BatchHandler = std::function<void(const ClusterBatch&)>;
+
+    static constexpr const char* kExchangeMethod = "/mmorpg.cluster.ClusterTransport/Exchange";
+
+    explicit ClusterTransport(TransportOptions options);
+    ~ClusterTransport();
+
+    ClusterTransport(const ClusterTransport&) = delete;
+    ClusterTransport& operator=(const ClusterTransport&) = delete;
+
+    /**
+     * @brief 수신 서버 시작
+     * @return 바인드 성공 여부
+     */
+    bool start();
+
+    /**
+     * @brief 모든 스트림을 닫고 서버 중지
+     */
+    void stop();
+
+    /**
+     * @brief 수신 배치 핸들러 설정 (start 이전에 호출)
+     */
+    void set_batch_handler(BatchHandler handler);
+
+    const std::string& get_node_id() const noexcept {
+        return options_.node_id;
+    }
+
+    /**
+     * @brief 실제로 바인드된 포트 (포트 0으로 시작한 경우 확인용)
+     */
+    uint16_t get_port() const noexcept {
+        return bound_port_;
+    }
+
+    /**
+     * @brief 송신 피어 추가 (스트림은 다음 flush에서 엶)
+     */
+    void add_peer(const std::string& node_id, const std::string& address);
+
+    /**
+     * @brief 송신 피어 제거 (대기 중인 메시지는 버림)
+     */
+    void remove_peer(const std::string& node_id);
+
+    bool has_peer(const std::string& node_id) const;
+
+    std::vector<std::string> get_peer_ids() const;
+
+    /**
+     * @brief 피어의 현재 배치에 메시지 추가
+     * @return 다음 flush까지 유효한 메시지, 피어가 없거나 대기 한도를 넘으면 nullptr
+     */
+    ClusterMessage* add_message(const std::string& node_id);
+
+    /**
+     * @brief 피어마다 쌓인 메시지를 배치로 전송 (틱마다 호출)
+     * @return 전송한 배치 수
+     */
+    size_t flush(uint64_t tick);
+
+    std::vector<PeerStats> get_peer_stats() const;
+
+    std::vector<InboundStats> get_inbound_stats() const;
+
+private:
+    class Peer;
+    class OutboundStream;
+    class InboundStream;
+    class Service;
+
+    /**
+     * @brief 수신 배치 처리 (InboundStream에서 호출)
+     */
+    void on_batch(const ClusterBatch& batch, size_t bytes);
+
+    TransportOptions options_;
+    uint16_t bound_port_ = 0;
+    BatchHandler batch_handler_;
+
+    // 전송 중인 풀 버퍼가 gRPC 슬라이스보다 먼저 사라지지 않도록 공유 소유
+    std::shared_ptr<common::BufferPool> buffer_pool_;
+
+    mutable std::mutex peers_mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Peer>> peers_;
+
+    mutable std::mutex inbound_mutex_;
+    std::unordered_map<std::string, InboundStats> inbound_stats_;
+
+    std::unique_ptr<Service> service_;
+    std::unique_ptr<grpc::Server> server_;
+};
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mmorpg::network {
+class LoadBalancer;
+} // namespace mmorpg::network
+
+namespace mmorpg::cluster {
+
+class GossipMember;
+class GossipMessage;
+
+enum class MemberState {
+    ALIVE,
+    SUSPECT,   // 직접/간접 탐지 모두 실패, suspect_timeout 안에 반박이 없으면 DEAD
+    DEAD
+};
+
+inline const char* to_string(MemberState state) noexcept {
+    switch (state) {
+        case MemberState::ALIVE:   return "alive";
+        case MemberState::SUSPECT: return "suspect";
+        case MemberState::DEAD:    return "dead";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief 노드가 스스로 보고하는 부하 (가십으로 전파)
+ */
+struct MemberLoad {
+    double cpu_usage = 0.0;       // 0.0 ~ 1.0
+    double memory_usage = 0.0;    // 0.0 ~ 1.0
+    uint32_t connections = 0;
+    uint32_t max_connections = 1000;
+};
+
+/**
+ * @brief 멤버 하나의 현재 상태 (조회용 복사본)
+ */
+struct MemberInfo {
+    std::string node_id;
+    std::string gossip_address;
+    std::string service_host;
+    uint16_t service_port = 0;
+    MemberState state = MemberState::ALIVE;
+    uint64_t incarnation = 0;
+    uint64_t heartbeat = 0;
+    MemberLoad load;
+};
+
+struct MembershipOptions {
+    std::string node_id;
+    std::string bind_address = "127.0.0.1:0";             // UDP host:port (포트 0이면 커널 할당)
+    std::string service_host = "127.0.0.1";               // LoadBalancer에 등록할 클라이언트 접속 주소
+    uint16_t service_port = 0;
+    std::vector<std::string> seeds;                       // 합류 시 PING을 보낼 host:port 목록
+    std::chrono::milliseconds protocol_period{1000};      // 탐지 주기 (주기마다 멤버 하나를 PING)
+    std::chrono::milliseconds ping_timeout{300};          // 직접 PING 응답 대기, 이후 간접 탐지
+    uint32_t indirect_probes = 3;                         // PING_REQ를 보낼 멤버 수
+    std::chrono::milliseconds suspect_timeout{3000};      // SUSPECT -> DEAD
+    std::chrono::milliseconds dead_retention{30000};      // DEAD 항목을 유지하며 전파하는 시간
+    uint32_t max_piggyback = 8;                           // 메시지당 피기백 멤버 수 (자신 제외)
+};
+
+/**
+ * @brief SWIM 방식 가십 멤버십
+ *
+ * 주기마다 멤버 하나를 골라 UDP로 PING을 보내고, ping_timeout 안에 ACK가 없으면
+ * indirect_probes개 멤버에게 PING_REQ로 간접 탐지를 부탁합니다. 주기가 끝날 때까지
+ * ACK가 없으면 SUSPECT로 표시하고, suspect_timeout 안에 대상이 더 높은 incarnation으로
+ * 반박하지 않으면 DEAD로 확정합니다. 상태 변화와 각 노드의 부하(CPU, 메모리, 연결 수)는
+ * 모든 메시지에 피기백으로 실려 퍼집니다.
+ *
+ * 기본값 기준 장애 감지는 약 protocol_period + suspect_timeout(4초 내외)입니다.
+ * incarnation은 시작 시각(ms)에서 출발하므로 같은 ID로 재시작한 노드도 DEAD 기록을 넘어섭니다.
+ *
+ * 프로토콜 처리는 전용 스레드 하나에서 이루어지며, 리스너와 LoadBalancer 갱신도 그 스레드에서 호출됩니다.
+ */
+class GossipMembership {
+public:
+    using LoadProvider = std::function<MemberLoad()>;
+    using MemberListener = std::function<void(const MemberInfo& member)>;
+
+    explicit GossipMembership(MembershipOptions options);
+    ~GossipMembership();
+
+    GossipMembership(const GossipMembership&) = delete;
+    GossipMembership& operator=(const GossipMembership&) = delete;
+
+    /**
+     * @brief 자신의 부하를 읽는 함수 (start 이전에 설정, 주기마다 호출)
+     */
+    void set_load_provider(LoadProvider provider);
+
+    /**
+     * @brief 멤버 상태 변화 또는 부하 갱신 리스너 (start 이전에 설정)
+     */
+    void set_listener(MemberListener listener);
+
+    /**
+     * @brief 멤버십을 LoadBalancer에 반영 (ALIVE: 추가/갱신, SUSPECT: 비정상, DEAD: 제거)
+     *
+     * 자기 자신도 등록됩니다. start 이전에 설정하며 balancer는 stop 이후까지 유효해야 합니다.
+     */
+    void attach_load_balancer(network::LoadBalancer* balancer);
+
+    /**
+     * @brief UDP 바인드 후 가십 스레드 시작
+     */
+    bool start();
+
+    /**
+     * @brief 가십 스레드 중지 (다른 노드는 탐지 실패로 이 노드를 제거)
+     */
+    void stop();
+
+    /**
+     * @brief 자신을 DEAD로 알리고 중지 (정상 종료 시 즉시 제거되도록)
+     */
+    void leave();
+
+    const std::string& get_node_id() const noexcept {
+        return options_.node_id;
+    }
+
+    uint16_t get_port() const noexcept {
+        return bound_port_;
+    }
+
+    /**
+     * @brief 알려진 모든 멤버 (자신 포함, DEAD 보존 항목 포함)
+     */
+    std::vector<MemberInfo> get_members() const;
+
+    std::optional<MemberInfo> get_member(const std::string& node_id) const;
+
+    /**
+     * @brief ALIVE 멤버 수 (자신 포함)
+     */
+    size_t get_alive_count() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using udp = boost::asio::ip::udp;
+
+    struct Member {
+        MemberInfo info;
+        udp::endpoint endpoint;
+        Clock::time_point state_changed_at;
+        uint32_t transmits_left = 0;     // 상태 변화 재전파 남은 횟수
+        uint64_t last_piggybacked = 0;   // 피기백 순서 (오래된 것 우선)
+    };
+
+    struct Probe {
+        std::string target_id;
+        uint64_t sequence = 0;
+        bool active = false;
+        bool acked = false;
+    };
+
+    struct Relay {
+        udp::endpoint requester;
+        uint64_t requester_sequence = 0;
+        Clock::time_point expires_at;
+    };
+
+    void schedule_period();
+    void on_period();
+    void on_probe_timeout(uint64_t sequence);
+    void start_receive();
+    void on_receive(size_t bytes);
+    void handle_message(const GossipMessage& message, const udp::endpoint& from);
+
+    void send(GossipMessage& message, const udp::endpoint& to);
+    void send_ping(const udp::endpoint& to, const std::string& target_id, uint64_t sequence);
+    void fill_piggyback(GossipMessage& message);
+    MemberInfo self_info() const;
+    void fill_self(GossipMember& member) const;
+
+    void merge(const GossipMember& update);
+    void set_state(Member& member, MemberState state, uint64_t incarnation);
+    void refute(uint64_t incarnation);
+    void expire_members();
+    std::optional<std::string> next_probe_target();
+    uint32_t retransmit_limit() const;
+
+    void notify(const MemberInfo& member);
+    void notify_load_balancer(const MemberInfo& member);
+    void flush_notifications();
+
+    std::optional<udp::endpoint> resolve(const std::string& address);
+
+    MembershipOptions options_;
+    uint16_t bound_port_ = 0;
+    std::string advertise_address_;
+    LoadProvider load_provider_;
+    MemberListener listener_;
+    network::LoadBalancer* load_balancer_ = nullptr;
+
+    boost::asio::io_context io_context_;
+    udp::socket socket_;
+    boost::asio::steady_timer period_timer_;
+    boost::asio::steady_timer probe_timer_;
+    std::thread thread_;
+    std::array<char, 65536> receive_buffer_{};
+    udp::endpoint receive_from_;
+
+    // 가십 스레드 전용
+    uint64_t incarnation_ = 0;
+    uint64_t heartbeat_ = 0;
+    MemberLoad self_load_;
+    uint64_t next_sequence_ = 1;
+    uint64_t piggyback_clock_ = 0;
+    Probe probe_;
+    std::vector<std::string> probe_order_;
+    size_t probe_index_ = 0;
+    std::unordered_map<uint64_t, Relay> relays_;
+    std::vector<udp::endpoint> seed_endpoints_;
+    std::vector<MemberInfo> pending_notifications_;
+    std::mt19937 random_;
+
+    // 가십 스레드가 쓰고 조회 스레드가 읽음
+    mutable std::mutex members_mutex_;
+    std::unordered_map<std::string, Member> members_;   // 자신 제외
+};
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mmorpg::cluster {
+
+/**
+ * @brief 가상 노드 기반 일관 해시 링
+ *
+ * 노드마다 virtual_nodes개의 점을 링에 배치하고, 키는 해시 값 이후 첫 점의 노드가 소유합니다.
+ * 노드 하나가 추가/제거되면 그 노드의 구간에 해당하는 약 1/N의 키만 소유자가 바뀝니다.
+ * 노드 ID만으로 점 위치가 정해지므로 같은 노드 집합이면 모든 노드에서 같은 결과가 나옵니다.
+ *
+ * 스레드 안전하지 않습니다.
+ */
+class HashRing {
+public:
+    explicit HashRing(uint32_t virtual_nodes = 64);
+
+    /**
+     * @return 새로 추가되었으면 true
+     */
+    bool add_node(const std::string& node_id);
+
+    /**
+     * @return 제거되었으면 true
+     */
+    bool remove_node(const std::string& node_id);
+
+    bool contains(const std::string& node_id) const;
+
+    /**
+     * @brief 키를 소유한 노드 (링이 비어 있으면 nullopt)
+     */
+    std::optional<std::string> owner(uint64_t key) const;
+
+    std::vector<std::string> get_nodes() const;
+
+    size_t size() const noexcept {
+        return nodes_.size();
+    }
+
+private:
+    struct Point {
+        uint64_t hash;
+        uint32_t node_index;
+    };
+
+    void rebuild();
+
+    uint32_t virtual_nodes_;
+    std::vector<std::string> nodes_;     // 정렬 유지
+    std::vector<Point> points_;          // hash 오름차순
+};
+
+} // namespace mmorpg::cluster
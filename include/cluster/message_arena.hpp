@@ -0,0 +1,83 @@
+#pragma once
+
+#include "common/numa.hpp"
+#include <google/protobuf/arena.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace mmorpg::cluster {
+
+/**
+ * @brief 배치 단위로 재사용하는 protobuf Arena
+ *
+ * 메시지는 배치(틱) 동안 Arena에서 할당하고, 배치 경계에서 reset()으로 한 번에 버립니다.
+ * Arena의 첫 블록은 이 객체가 소유한 버퍼라 reset() 후에도 남으므로, 배치가 첫 블록
+ * 안에 들어오면 정상 상태에서 힙 할당이 없습니다. 배치가 첫 블록을 넘치면 다음 배치부터
+ * 첫 블록을 키웁니다 (최대 max_initial_block_size). huge page 크기 이상인 첫 블록은
+ * HugePageRegion에 두어 TLB 미스를 줄입니다.
+ *
+ * 스레드 안전하지 않습니다. 스트림/워커마다 하나씩 둡니다.
+ */
+class MessageArena {
+public:
+    static constexpr size_t kDefaultInitialBlockSize = 64 * 1024;
+    static constexpr size_t kDefaultMaxInitialBlockSize = 4 * 1024 * 1024;
+
+    explicit MessageArena(size_t initial_block_size = kDefaultInitialBlockSize,
+                          size_t max_initial_block_size = kDefaultMaxInitialBlockSize);
+
+    MessageArena(const MessageArena&) = delete;
+    MessageArena& operator=(const MessageArena&) = delete;
+
+    google::protobuf::Arena* get() noexcept {
+        return &*arena_;
+    }
+
+    /**
+     * @brief Arena에 메시지 생성 (reset() 전까지 유효)
+     */
+    template <typename Message>
+    Message* create() {
+        return google::protobuf::Arena::CreateMessage<Message>(get());
+    }
+
+    /**
+     * @brief 배치 경계: 이번 배치의 모든 메시지를 버림
+     * @return 이번 배치가 사용한 바이트 수
+     */
+    uint64_t reset();
+
+    size_t get_initial_block_size() const noexcept {
+        return initial_block_size_;
+    }
+
+    /**
+     * @brief 지금까지 한 배치가 사용한 최대 바이트 수
+     */
+    uint64_t get_high_water_mark() const noexcept {
+        return high_water_mark_;
+    }
+
+    /**
+     * @brief 첫 블록을 넘쳐 추가 힙 블록을 쓴 배치 수
+     */
+    uint64_t get_overflow_count() const noexcept {
+        return overflow_count_;
+    }
+
+private:
+    void rebuild(size_t initial_block_size);
+
+    size_t initial_block_size_;
+    const size_t max_initial_block_size_;
+    std::unique_ptr<char[]> initial_block_;
+    common::HugePageRegion huge_initial_block_;
+    std::optional<google::protobuf::Arena> arena_;
+
+    uint64_t high_water_mark_ = 0;
+    uint64_t overflow_count_ = 0;
+};
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "cluster/hash_ring.hpp"
+#include "common/memory_accounting.hpp"
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/post.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mmorpg::cluster {
+
+class ClusterBatch;
+class ClusterTransport;
+struct MemberInfo;
+
+struct DirectoryOptions {
+    uint32_t virtual_nodes = 64;                      // 해시 링의 노드당 점 수
+    size_t cache_capacity = 65536;                    // 니어 캐시 항목 수 (LRU)
+    std::chrono::milliseconds query_timeout{1000};    // 소유 노드 응답 대기
+    std::string memory_owner = "PlayerDirectory";     // 니어 캐시 메모리 계정 소유자 (CACHES)
+};
+
+/**
+ * @brief 디렉터리 누적 통계
+ */
+struct DirectoryStats {
+    uint64_t cache_hits = 0;
+    uint64_t cache_misses = 0;
+    uint64_t queries_sent = 0;
+    uint64_t query_timeouts = 0;
+    uint64_t updates_sent = 0;
+    uint64_t invalidations_sent = 0;
+    uint64_t invalidations_received = 0;
+    uint64_t unroutable = 0;          // 소유 노드로 가는 피어가 없거나 대기 한도 초과로 보내지 못한 메시지
+    uint64_t pressure_evictions = 0;  // 메모리 예산 압박으로 줄인 캐시 항목
+    size_t local_players = 0;
+    size_t owned_entries = 0;         // 이 노드가 소유한 샤드 항목
+    size_t cached_entries = 0;
+    size_t ring_nodes = 0;
+};
+
+/**
+ * @brief 클러스터 전체 플레이어 위치 디렉터리
+ *
+ * player_id → 접속 노드 매핑을 해시 링으로 노드들에 분산해 보관합니다. 각 플레이어의
+ * 항목은 링에서 player_id를 소유한 노드(샤드) 하나에만 있고, 접속 노드가 로그인/로그아웃을
+ * DirectoryUpdate로 소유 노드에 알립니다.
+ *
+ * 조회는 로컬 접속자 → 자기 샤드 → LRU 니어 캐시 순으로 동기 처리하고, 모두 없으면
+ * lookup()이 소유 노드에 DirectoryQuery를 보내 응답을 캐시에 넣습니다. 소유 노드는
+ * 조회한 노드를 기억했다가 로그아웃이나 다른 노드로의 이동이 반영되면 DirectoryInvalidate를
+ * 보내 캐시 항목을 지웁니다.
+ *
+ * 멤버 변화로 링이 바뀌면 소유자가 바뀐 로컬 접속자를 새 소유 노드에 다시 알리고,
+ * 더 이상 소유하지 않는 샤드 항목과 니어 캐시를 비웁니다. DEAD 노드에 있던 플레이어
+ * 항목은 즉시 지웁니다.
+ *
+ * 니어 캐시는 memory_owner/CACHES 계정에 기록되며, 계정이 예산을 넘으면 압박 리스너가
+ * 예산의 3/4 아래로 내려갈 때까지 오래된 항목부터 버립니다.
+ *
+ * 갱신 순서는 접속 노드의 시각(version)으로 정하므로 노드 간 시계 오차보다 빠르게
+ * 이동한 경우에는 소유 노드가 나중 갱신을 이전 것으로 볼 수 있습니다.
+ *
+ * 스레드: on_login/on_logout/on_batch/on_member는 어느 스레드에서나 호출할 수 있으며
+ * 보낼 메시지는 내부 큐에 쌓입니다. locate/lookup/poll은 틱 스레드에서 호출하고,
+ * poll()이 큐를 전송 계층 배치로 옮기고 lookup 콜백을 실행하므로 transport.flush() 직전에 부릅니다.
+ */
+class PlayerDirectory {
+public:
+    /**
+     * @brief lookup 결과 (틱 스레드의 poll에서 호출, 접속 중이 아니거나 알 수 없으면 nullopt)
+     */
+    using LookupCallback = std::function<void(uint64_t player_id, const std::optional<std::string>& node_id)>;
+
+    explicit PlayerDirectory(ClusterTransport& transport, DirectoryOptions options = {});
+    ~PlayerDirectory();
+
+    PlayerDirectory(const PlayerDirectory&) = delete;
+    PlayerDirectory& operator=(const PlayerDirectory&) = delete;
+
+    /**
+     * @brief 이 노드에 플레이어 로그인 (인증 완료 시)
+     */
+    void on_login(uint64_t player_id);
+
+    /**
+     * @brief 이 노드에서 플레이어 로그아웃 (연결 해제 시)
+     */
+    void on_logout(uint64_t player_id);
+
+    /**
+     * @brief 수신 배치의 디렉터리 메시지 처리 (전송 계층 배치 핸들러에서 호출)
+     */
+    void on_batch(const ClusterBatch& batch);
+
+    /**
+     * @brief 멤버 상태 반영 (ALIVE: 링에 추가, DEAD: 링에서 제거, SUSPECT: 유지)
+     */
+    void on_member(const MemberInfo& member);
+
+    /**
+     * @brief 링에 노드 추가/제거 (멤버십 없이 정적 구성으로 쓸 때)
+     */
+    void add_node(const std::string& node_id);
+    void remove_node(const std::string& node_id);
+
+    /**
+     * @brief 원격 조회 없이 알 수 있는 위치 (ClusterRouter의 PlayerLocator로 사용)
+     */
+    std::optional<std::string> locate(uint64_t player_id);
+
+    /**
+     * @brief 위치 조회, 동기로 모르면 소유 노드에 질의 후 poll에서 콜백
+     *
+     * 동기로 알 수 있으면 콜백을 즉시 호출합니다.
+     */
+    void lookup(uint64_t player_id, LookupCallback callback);
+
+    /**
+     * @brief lookup의 Asio 비동기 연산 형태 (완료 시그니처 void(std::optional<std::string>))
+     *
+     * 결과는 완료 핸들러의 실행기로 post되므로 코루틴에서는
+     * `auto node_id = co_await directory.async_lookup(player_id, net::use_awaitable);`로 기다리고
+     * 같은 strand에서 이어서 실행됩니다. 그 실행기의 io_context는 poll()이 결과를 낼 때까지
+     * 작업이 남아 있어야 합니다 (I/O 샤드는 work guard로 유지).
+     */
+    template <typename CompletionToken>
+    auto async_lookup(uint64_t player_id, CompletionToken&& token) {
+        return boost::asio::async_initiate<CompletionToken, void(std::optional<std::string>)>(
+            [this](auto handler, uint64_t player_id) {
+                // LookupCallback은 복사 가능해야 하므로 이동 전용 핸들러는 공유 포인터로 감쌈
+                auto shared = std::make_shared<decltype(handler)>(std::move(handler));
+                lookup(player_id, [shared](uint64_t, const std::optional<std::string>& node_id) {
+                    const auto executor = boost::asio::get_associated_executor(*shared);
+                    boost::asio::post(executor, [shared, node_id]() mutable {
+                        std::move(*shared)(node_id);
+                    });
+                });
+            },
+            token, player_id);
+    }
+
+    /**
+     * @brief 쌓인 디렉터리 메시지를 전송 계층에 넘기고 완료된 lookup 콜백 실행 (틱마다)
+     */
+    void poll();
+
+    std::optional<std::string> get_owner(uint64_t player_id) const;
+
+    /**
+     * @brief 니어 캐시를 max_entries 이하로 줄임 (오래 쓰지 않은 항목부터)
+     * @return 버린 항목 수
+     */
+    size_t shrink_cache(size_t max_entries);
+
+    DirectoryStats get_stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct LocalPlayer {
+        uint64_t version = 0;
+        std::string published_to;             // 마지막으로 갱신을 보낸 소유 노드
+    };
+
+    struct ShardEntry {
+        std::string node_id;
+        uint64_t version = 0;
+        std::vector<std::string> subscribers; // 이 항목을 캐시했을 수 있는 노드
+    };
+
+    using CacheLru = std::list<uint64_t, common::TrackingAllocator<uint64_t>>;
+
+    struct CacheEntry {
+        std::string node_id;
+        uint64_t version = 0;
+        CacheLru::iterator lru;
+    };
+
+    using CacheMap = std::unordered_map<uint64_t, CacheEntry, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                        common::TrackingAllocator<std::pair<const uint64_t, CacheEntry>>>;
+
+    struct PendingLookup {
+        Clock::time_point deadline;
+        std::vector<LookupCallback> callbacks;
+    };
+
+    struct Outgoing {
+        enum class Kind { UPDATE, QUERY, REPLY, INVALIDATE };
+
+        Kind kind;
+        std::string to;
+        uint64_t player_id = 0;
+        std::string node_id;
+        bool online = false;
+        uint64_t version = 0;
+    };
+
+    struct Completion {
+        uint64_t player_id = 0;
+        std::optional<std::string> node_id;
+        std::vector<LookupCallback> callbacks;
+    };
+
+    // 아래 함수는 mutex_를 잡은 상태에서 호출
+    std::optional<std::string> locate_locked(uint64_t player_id);
+    void publish_locked(uint64_t player_id, LocalPlayer& player, bool online);
+    void apply_update_locked(uint64_t player_id, const std::string& node_id, bool online,
+                             uint64_t version);
+    void subscribe_locked(ShardEntry& entry, const std::string& node_id);
+    void invalidate_subscribers_locked(uint64_t player_id, ShardEntry& entry);
+    void cache_put_locked(uint64_t player_id, const std::string& node_id, uint64_t version);
+    void cache_erase_locked(uint64_t player_id, uint64_t version);
+    void complete_locked(uint64_t player_id, const std::optional<std::string>& node_id);
+    void rebalance_locked();
+    void drop_node_locked(const std::string& node_id);
+    size_t shrink_cache_locked(size_t max_entries);
+
+    void on_memory_pressure(const common::MemoryAccount& account);
+
+    ClusterTransport& transport_;
+    DirectoryOptions options_;
+    std::string node_id_;
+    common::MemoryAccount& cache_memory_;
+    uint64_t pressure_listener_ = 0;
+
+    mutable std::mutex mutex_;
+    HashRing ring_;
+    std::unordered_map<uint64_t, LocalPlayer> local_players_;
+    std::unordered_map<uint64_t, ShardEntry> shard_;
+    CacheMap cache_;
+    CacheLru cache_lru_;                      // 앞쪽이 최근 사용
+    std::unordered_map<uint64_t, PendingLookup> pending_lookups_;
+    std::vector<Outgoing> outbox_;
+    std::vector<Completion> completions_;
+    DirectoryStats stats_;
+};
+
+} // namespace mmorpg::cluster
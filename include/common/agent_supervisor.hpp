@@ -0,0 +1,127 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mmorpg::common {
+
+class BaseAgent;
+
+/**
+ * @brief 구성 요소 시작 상태
+ */
+enum class StartupState {
+    PENDING,    // 의존 대상 대기 중
+    STARTING,   // start 실행 또는 준비 대기 중
+    READY,
+    FAILED,     // start 실패 또는 준비 시간 초과
+    SKIPPED     // 의존 대상이 실패해 시작하지 않음
+};
+
+inline const char* to_string(StartupState state) {
+    switch (state) {
+        case StartupState::PENDING: return "PENDING";
+        case StartupState::STARTING: return "STARTING";
+        case StartupState::READY: return "READY";
+        case StartupState::FAILED: return "FAILED";
+        case StartupState::SKIPPED: return "SKIPPED";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief 구성 요소별 시작 기록 (시간은 AgentSupervisor::start() 호출 시점 기준, 초)
+ */
+struct StartupRecord {
+    std::string name;
+    size_t stage = 0;               // 의존 깊이 (의존 대상이 없으면 0)
+    StartupState state = StartupState::PENDING;
+    double started_at = 0.0;        // 의존 대상이 모두 준비되어 start를 호출한 시각
+    double ready_at = 0.0;          // 준비 완료 시각
+    double startup_time = 0.0;      // start 호출부터 준비 완료까지
+};
+
+/**
+ * @brief 의존 관계에 따른 에이전트 병렬 시작
+ *
+ * 의존 대상이 모두 준비된 구성 요소는 다른 구성 요소를 기다리지 않고 바로 자기 스레드에서 시작하므로,
+ * 서로 독립인 에이전트는 병렬로 시작되고 전체 부팅 시간은 가장 긴 의존 경로의 합이 됩니다.
+ * BaseAgent는 start() 후 mark_ready()가 호출될 때까지 기다리고, 에이전트가 아닌 구성 요소(전송 계층,
+ * 멤버십)는 시작 함수가 true를 반환하면 준비된 것으로 봅니다.
+ *
+ * 의존 대상은 먼저 add()해야 하므로 순환 의존은 만들 수 없습니다. 하나라도 실패하면 그에 의존하는
+ * 구성 요소는 시작하지 않고, 이미 시작한 구성 요소는 역순으로 중지합니다.
+ * 클라이언트 리스너처럼 앞단에 있는 구성 요소는 뒤에서 처리하는 구성 요소 전부에 의존하도록 선언합니다.
+ */
+class AgentSupervisor {
+public:
+    using StartFunction = std::function<bool()>;
+    using StopFunction = std::function<void()>;
+
+    explicit AgentSupervisor(std::chrono::milliseconds ready_timeout = std::chrono::seconds(10));
+
+    AgentSupervisor(const AgentSupervisor&) = delete;
+    AgentSupervisor& operator=(const AgentSupervisor&) = delete;
+
+    /**
+     * @brief 에이전트 등록 (이름은 agent ID). agent는 stop() 이후까지 유효해야 합니다.
+     * @return 이름이 중복되거나 등록되지 않은 의존 대상이 있거나 이미 시작했으면 false
+     */
+    bool add(BaseAgent& agent, const std::vector<std::string>& dependencies = {});
+
+    /**
+     * @brief 에이전트가 아닌 구성 요소 등록 (start가 false를 반환하면 실패)
+     */
+    bool add(const std::string& name, StartFunction start, StopFunction stop,
+             const std::vector<std::string>& dependencies = {});
+
+    /**
+     * @brief 모든 구성 요소를 시작하고 준비될 때까지 대기
+     * @return 전부 준비되면 true. 실패 시 시작한 구성 요소를 모두 중지한 뒤 false
+     */
+    bool start();
+
+    /**
+     * @brief start를 호출한 구성 요소를 시작 순서의 역순으로 중지 (의존하는 쪽이 먼저 중지됨)
+     */
+    void stop();
+
+    /**
+     * @brief 등록 순서대로 시작 기록 반환
+     */
+    std::vector<StartupRecord> get_startup_report() const;
+
+    /**
+     * @brief start() 호출부터 마지막 구성 요소 준비까지 걸린 시간 (초)
+     */
+    double get_total_startup_time() const;
+
+private:
+    struct Component {
+        std::string name;
+        BaseAgent* agent = nullptr;
+        StartFunction start;
+        StopFunction stop;
+        std::vector<size_t> dependencies;
+        StartupRecord record;
+    };
+
+    bool add_component(Component component, const std::vector<std::string>& dependencies);
+    void run_component(size_t index, std::chrono::steady_clock::time_point boot);
+
+    const std::chrono::milliseconds ready_timeout_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable state_cv_;
+    std::vector<Component> components_;
+    std::vector<size_t> started_order_;   // start를 호출한 순서 (중지는 역순)
+    double total_startup_time_ = 0.0;
+    bool started_ = false;
+};
+
+} // namespace mmorpg::common
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "common/memory_accounting.hpp"
 #include <string>
 #include <chrono>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <unordered_map>
 #include <functional>
@@ -46,6 +48,17 @@ public:
      */
     virtual bool is_running() const noexcept;
 
+    /**
+     * @brief 준비 완료 여부 (start() 이후 요청을 처리할 수 있는 상태)
+     */
+    bool is_ready() const noexcept;
+
+    /**
+     * @brief 준비 완료까지 대기
+     * @return timeout 안에 준비되지 않으면 false
+     */
+    bool wait_ready(std::chrono::milliseconds timeout) const;
+
     /**
      * @brief 에이전트 ID 반환
      */
@@ -72,16 +85,41 @@ public:
     const std::unordered_map<std::string, double>& get_metrics() const;
 
     /**
-     * @brief 헬스 체크
+     * @brief 모든 메트릭 복사본 반환 (다른 스레드에서 수집할 때 사용)
+     */
+    std::unordered_map<std::string, double> snapshot_metrics() const;
+
+    /**
+     * @brief 헬스 체크 (분류별 메모리 계정 포함)
      */
     virtual std::unordered_map<std::string, std::string> health_check() const;
 
 protected:
+    /**
+     * @brief 이 에이전트 이름으로 태그된 메모리 계정 (핫 패스에서 쓰려면 참조를 보관)
+     */
+    MemoryAccount& memory_account(MemoryCategory category) const;
+
+    /**
+     * @brief 준비 완료 알림 (start()에서 하위 구성 요소가 모두 동작하면 호출)
+     */
+    void mark_ready();
+
+    /**
+     * @brief 준비 상태 해제 (stop()에서 호출)
+     */
+    void clear_ready();
+
     std::string agent_id_;
     std::atomic<bool> running_{false};
     TimePoint start_time_;
     mutable std::unordered_map<std::string, double> metrics_;
     mutable std::mutex metrics_mutex_;
+
+private:
+    std::atomic<bool> ready_{false};
+    mutable std::mutex ready_mutex_;
+    mutable std::condition_variable ready_cv_;
 };
 
 } // namespace mmorpg::common
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mmorpg::common {
+
+class BufferPool;
+
+/**
+ * @brief 풀로 돌려보내는 삭제자
+ */
+struct BufferPoolReturner {
+    BufferPool* pool = nullptr;
+    void operator()(std::string* buffer) const noexcept;
+};
+
+/**
+ * @brief 풀에서 빌린 버퍼 (소멸 시 용량을 유지한 채 풀로 반환)
+ */
+using PooledBuffer = std::unique_ptr<std::string, BufferPoolReturner>;
+
+/**
+ * @brief 직렬화 출력용 재사용 버퍼 풀
+ *
+ * 반환된 버퍼는 clear()만 하고 용량을 유지하므로 정상 상태에서는 직렬화 시
+ * 힙 할당이 없습니다. 너무 커진 버퍼와 상한을 넘는 반환분은 해제합니다.
+ * 풀은 빌려 간 모든 버퍼보다 오래 살아야 합니다.
+ */
+class BufferPool {
+public:
+    static constexpr size_t kDefaultMaxPooled = 256;
+    static constexpr size_t kDefaultMaxRetainedCapacity = 1 << 20;
+
+    explicit BufferPool(size_t max_pooled = kDefaultMaxPooled,
+                        size_t max_retained_capacity = kDefaultMaxRetainedCapacity);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /**
+     * @brief 빈 버퍼 대여 (capacity가 reserve 이상이 되도록 보장)
+     */
+    PooledBuffer acquire(size_t reserve = 0);
+
+    /**
+     * @brief 풀에 대기 중인 버퍼 수
+     */
+    size_t get_pooled_count() const;
+
+    /**
+     * @brief 풀이 비어 새로 만든 버퍼 수 (누적)
+     */
+    uint64_t get_created_count() const noexcept;
+
+private:
+    friend struct BufferPoolReturner;
+
+    void release(std::string* buffer) noexcept;
+
+    const size_t max_pooled_;
+    const size_t max_retained_capacity_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::string*> free_;
+    std::atomic<uint64_t> created_{0};
+};
+
+} // namespace mmorpg::common
@@ -0,0 +1,390 @@
+#pragma once
+
+#include "common/epoch_reclamation.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 읽기에 잠금이 없는 동시 해시 맵 (개방 주소법, 선형 탐사)
+ *
+ * 슬롯은 노드 포인터 하나이고, 읽기는 EpochGuard 안에서 슬롯을 따라가며 잠금을 잡지 않습니다.
+ * 쓰기는 키 해시로 고른 줄무늬 잠금 하나만 잡으므로 같은 키를 두 스레드가 동시에 바꾸지 않고,
+ * 빈 슬롯은 CAS로 차지합니다. 지운 슬롯은 묘비로 남겨 탐사 체인을 끊지 않습니다.
+ * 노드와 옛 테이블은 EpochRetireList로 넘겨 읽는 스레드가 모두 지나간 뒤 해제합니다.
+ *
+ * 값은 노드에 넣은 뒤 바꾸지 않습니다. insert_or_assign()은 새 노드로 교체하므로 값 안의 필드를
+ * 제자리에서 고쳐야 하는 레지스트리는 값을 불변 객체의 shared_ptr로 두어야 합니다.
+ * 읽기는 진행 중인 쓰기의 직전 또는 직후 상태를 보고, for_each()는 순회 중의 쓰기를 일부만 볼 수 있습니다.
+ *
+ * 사용(슬롯 중 노드나 묘비가 있는 것)이 절반을 넘으면 모든 줄무늬를 잡고 다시 해시합니다.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap {
+public:
+    static constexpr size_t kStripeCount = 64;
+    static constexpr size_t kMinCapacity = 16;
+
+    explicit ConcurrentHashMap(size_t expected_size = 0)
+        : table_(new Table(capacity_for(expected_size)))
+        , capacity_(table_.load(std::memory_order_relaxed)->capacity()) {
+    }
+
+    ~ConcurrentHashMap() {
+        Table* table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < table->capacity(); ++i) {
+            Node* node = table->slots[i].load(std::memory_order_relaxed);
+            if (is_live(node)) {
+                delete node;
+            }
+        }
+        delete table;
+    }
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+    /**
+     * @brief 키가 없을 때만 추가 (이미 있으면 false)
+     */
+    bool insert(const Key& key, Value value) {
+        return put(key, std::move(value), false);
+    }
+
+    /**
+     * @brief 추가하거나 새 노드로 교체 (추가했으면 true)
+     */
+    bool insert_or_assign(const Key& key, Value value) {
+        return put(key, std::move(value), true);
+    }
+
+    bool erase(const Key& key) {
+        const size_t hash = hash_of(key);
+        std::lock_guard<std::mutex> lock(stripe_for(hash));
+
+        Table& table = *table_.load(std::memory_order_acquire);
+        const size_t index = locate(table, key, hash);
+        if (index == kNotFound) {
+            return false;
+        }
+        Node* node = table.slots[index].load(std::memory_order_relaxed);
+        table.slots[index].store(tombstone(), std::memory_order_release);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        retired_.retire(node);
+        return true;
+    }
+
+    /**
+     * @brief 모든 항목 제거 (모든 줄무늬를 잡고 빈 테이블로 교체)
+     */
+    void clear() {
+        StripeLocks locks(stripes_);
+
+        Table* old_table = table_.load(std::memory_order_relaxed);
+        table_.store(new Table(kMinCapacity), std::memory_order_release);
+        capacity_.store(kMinCapacity, std::memory_order_relaxed);
+        used_.store(0, std::memory_order_relaxed);
+        size_.store(0, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < old_table->capacity(); ++i) {
+            Node* node = old_table->slots[i].load(std::memory_order_relaxed);
+            if (is_live(node)) {
+                retired_.retire(node);
+            }
+        }
+        retired_.retire(old_table);
+    }
+
+    /**
+     * @brief 값 복사본 조회 (잠금 없음)
+     */
+    std::optional<Value> find(const Key& key) const {
+        std::optional<Value> result;
+        visit(key, [&result](const Value& value) { result.emplace(value); });
+        return result;
+    }
+
+    bool contains(const Key& key) const {
+        return visit(key, [](const Value&) {});
+    }
+
+    /**
+     * @brief 키가 있으면 visitor(const Value&) 호출 (잠금 없음, 복사 없이 값 사용)
+     *
+     * visitor는 읽기 구간 안에서 실행되므로 짧게 끝나야 하고, 참조를 밖으로 내보내면 안 됩니다.
+     */
+    template <typename Visitor>
+    bool visit(const Key& key, Visitor&& visitor) const {
+        const size_t hash = hash_of(key);
+        EpochGuard guard;
+        const Node* node = find_node(*table_.load(std::memory_order_acquire), key, hash);
+        if (node == nullptr) {
+            return false;
+        }
+        visitor(static_cast<const Value&>(node->value));
+        return true;
+    }
+
+    /**
+     * @brief 모든 항목에 visitor(const Key&, const Value&) 호출 (잠금 없음)
+     */
+    template <typename Visitor>
+    void for_each(Visitor&& visitor) const {
+        EpochGuard guard;
+        const Table& table = *table_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < table.capacity(); ++i) {
+            const Node* node = table.slots[i].load(std::memory_order_acquire);
+            if (is_live(node)) {
+                visitor(static_cast<const Key&>(node->key), static_cast<const Value&>(node->value));
+            }
+        }
+    }
+
+    size_t size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    size_t capacity() const noexcept {
+        return capacity_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+    struct Node {
+        Key key;
+        Value value;
+        size_t hash;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity)
+            : mask(capacity - 1)
+            , slots(std::make_unique<std::atomic<Node*>[]>(capacity)) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        size_t capacity() const noexcept {
+            return mask + 1;
+        }
+
+        const size_t mask;
+        std::unique_ptr<std::atomic<Node*>[]> slots;
+    };
+
+    struct alignas(64) Stripe {
+        std::mutex mutex;
+    };
+
+    using Stripes = std::array<Stripe, kStripeCount>;
+
+    /**
+     * @brief 모든 줄무늬를 순서대로 잡음 (다시 해시/clear 전용, 쓰기는 줄무늬 하나만 잡으므로 교착 없음)
+     */
+    class StripeLocks {
+    public:
+        explicit StripeLocks(Stripes& stripes) : stripes_(stripes) {
+            for (auto& stripe : stripes_) {
+                stripe.mutex.lock();
+            }
+        }
+
+        ~StripeLocks() {
+            for (auto it = stripes_.rbegin(); it != stripes_.rend(); ++it) {
+                it->mutex.unlock();
+            }
+        }
+
+        StripeLocks(const StripeLocks&) = delete;
+        StripeLocks& operator=(const StripeLocks&) = delete;
+
+    private:
+        Stripes& stripes_;
+    };
+
+    static Node* tombstone() noexcept {
+        alignas(Node) static unsigned char tag;
+        return reinterpret_cast<Node*>(&tag);
+    }
+
+    static bool is_live(const Node* node) noexcept {
+        return node != nullptr && node != tombstone();
+    }
+
+    static size_t capacity_for(size_t expected_size) noexcept {
+        size_t capacity = kMinCapacity;
+        while (capacity < expected_size * 4) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    size_t hash_of(const Key& key) const noexcept {
+        // 정수 키의 항등 해시도 슬롯과 줄무늬에 고르게 퍼지도록 섞음 (splitmix64 마무리 단계)
+        uint64_t hash = static_cast<uint64_t>(hasher_(key));
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return static_cast<size_t>(hash);
+    }
+
+    std::mutex& stripe_for(size_t hash) noexcept {
+        // 슬롯 위치는 하위 비트를 쓰므로 줄무늬는 상위 비트로 고름
+        return stripes_[(hash >> 40) % kStripeCount].mutex;
+    }
+
+    /**
+     * @brief 읽기용 탐사 - 슬롯을 다시 읽지 않고 찾은 노드를 그대로 돌려줌 (그 사이 슬롯이 재사용될 수 있음)
+     */
+    const Node* find_node(const Table& table, const Key& key, size_t hash) const {
+        size_t index = hash & table.mask;
+        for (size_t probe = 0; probe <= table.mask; ++probe, index = (index + 1) & table.mask) {
+            const Node* node = table.slots[index].load(std::memory_order_acquire);
+            if (node == nullptr) {
+                return nullptr;
+            }
+            if (node != tombstone() && node->hash == hash && equal_(node->key, key)) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief 쓰기용 탐사 (키의 줄무늬를 잡은 상태) - 슬롯 위치, 없으면 kNotFound
+     */
+    size_t locate(const Table& table, const Key& key, size_t hash) const {
+        size_t index = hash & table.mask;
+        for (size_t probe = 0; probe <= table.mask; ++probe, index = (index + 1) & table.mask) {
+            const Node* node = table.slots[index].load(std::memory_order_acquire);
+            if (node == nullptr) {
+                return kNotFound;
+            }
+            if (node != tombstone() && node->hash == hash && equal_(node->key, key)) {
+                return index;
+            }
+        }
+        return kNotFound;
+    }
+
+    bool put(const Key& key, Value value, bool overwrite) {
+        const size_t hash = hash_of(key);
+        auto node = std::unique_ptr<Node>(new Node{key, std::move(value), hash});
+
+        for (;;) {
+            if ((used_.load(std::memory_order_relaxed) + 1) * 2 > capacity()) {
+                rehash(false);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(stripe_for(hash));
+                Table& table = *table_.load(std::memory_order_acquire);
+
+                // 줄무늬를 잡았으므로 이 키를 바꾸는 스레드는 없음 - 끝까지 탐사해 중복을 확인
+                size_t free_index = kNotFound;
+                Node* free_expected = nullptr;
+                size_t index = hash & table.mask;
+                for (size_t probe = 0; probe <= table.mask; ++probe, index = (index + 1) & table.mask) {
+                    Node* current = table.slots[index].load(std::memory_order_acquire);
+                    if (current == nullptr || current == tombstone()) {
+                        if (free_index == kNotFound) {
+                            free_index = index;
+                            free_expected = current;
+                        }
+                        if (current == nullptr) {
+                            break;
+                        }
+                        continue;
+                    }
+                    if (current->hash == hash && equal_(current->key, key)) {
+                        if (!overwrite) {
+                            return false;
+                        }
+                        table.slots[index].store(node.release(), std::memory_order_release);
+                        retired_.retire(current);
+                        return false;
+                    }
+                }
+
+                if (free_index != kNotFound) {
+                    // 다른 줄무늬의 쓰기와 같은 빈 슬롯을 노릴 수 있으므로 CAS로 차지
+                    if (table.slots[free_index].compare_exchange_strong(free_expected, node.get(),
+                                                                        std::memory_order_acq_rel)) {
+                        node.release();
+                        size_.fetch_add(1, std::memory_order_relaxed);
+                        if (free_expected == nullptr) {
+                            used_.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        return true;
+                    }
+                    continue;
+                }
+            }
+
+            // 빈 슬롯이 없음 (여러 쓰기가 동시에 마지막 여유분을 채움)
+            rehash(true);
+        }
+    }
+
+    void rehash(bool force) {
+        StripeLocks locks(stripes_);
+
+        Table* old_table = table_.load(std::memory_order_relaxed);
+        const size_t used = used_.load(std::memory_order_relaxed);
+        if (!force && (used + 1) * 2 <= old_table->capacity()) {
+            return;   // 다른 스레드가 먼저 다시 해시함
+        }
+
+        // 다시 해시한 뒤 사용률이 1/4 이하가 되도록 (묘비만 많으면 같은 크기로 정리)
+        const size_t live = size_.load(std::memory_order_relaxed);
+        size_t capacity = old_table->capacity();
+        while ((live + 1) * 4 > capacity) {
+            capacity *= 2;
+        }
+
+        auto* table = new Table(capacity);
+        for (size_t i = 0; i < old_table->capacity(); ++i) {
+            Node* node = old_table->slots[i].load(std::memory_order_relaxed);
+            if (!is_live(node)) {
+                continue;
+            }
+            size_t index = node->hash & table->mask;
+            while (table->slots[index].load(std::memory_order_relaxed) != nullptr) {
+                index = (index + 1) & table->mask;
+            }
+            table->slots[index].store(node, std::memory_order_relaxed);
+        }
+
+        table_.store(table, std::memory_order_release);
+        capacity_.store(capacity, std::memory_order_relaxed);
+        used_.store(live, std::memory_order_relaxed);
+        retired_.retire(old_table);   // 노드는 새 테이블로 옮겼으므로 테이블 껍데기만 회수
+    }
+
+    Hash hasher_;
+    KeyEqual equal_;
+    std::atomic<Table*> table_;
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> used_{0};   // 노드 또는 묘비가 있는 슬롯 수
+    std::atomic<size_t> size_{0};
+    Stripes stripes_;
+    EpochRetireList retired_;
+};
+
+} // namespace mmorpg::common
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 에포크 기반 메모리 회수 (프로세스 전체 도메인 하나)
+ *
+ * 잠금 없이 공유 구조를 읽는 스레드는 EpochGuard로 읽는 구간을 알리고, 쓰는 쪽은 구조에서 떼어 낸
+ * 노드를 바로 지우지 않고 EpochRetireList에 넘깁니다. 떼어 낼 때 이미 읽고 있던 스레드가 모두
+ * 구간을 벗어나야 노드가 해제됩니다. 스레드마다 처음 진입할 때 기록 하나를 받고 스레드가 끝나면
+ * 반납하므로, 구간 진입은 자기 캐시 라인에 한 번 저장하고 펜스를 치는 비용입니다.
+ */
+class EpochDomain {
+public:
+    static EpochDomain& instance();
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /**
+     * @brief 읽기 구간 진입/이탈 (같은 스레드에서 중첩 가능, 보통 EpochGuard로 사용)
+     */
+    void enter() noexcept;
+    void exit() noexcept;
+
+    /**
+     * @brief 현재 에포크를 돌려주고 한 칸 진행 (노드를 떼어 낸 뒤 호출)
+     */
+    uint64_t advance() noexcept;
+
+    /**
+     * @brief 읽기 구간에 있는 스레드 중 가장 오래된 에포크 (없으면 UINT64_MAX)
+     *
+     * 이 값보다 작은 에포크에 떼어 낸 노드는 더 이상 읽는 스레드가 없습니다.
+     */
+    uint64_t oldest_active() const noexcept;
+
+private:
+    struct alignas(64) Record {
+        std::atomic<uint64_t> active{0};   // 0이면 읽기 구간 밖
+        std::atomic<bool> in_use{false};
+        uint32_t depth = 0;                // 소유 스레드만 접근
+        Record* next = nullptr;            // 목록에 게시한 뒤 변경하지 않음
+    };
+
+    EpochDomain() = default;
+
+    Record* local_record();
+    Record* acquire_record();
+
+    std::atomic<uint64_t> epoch_{1};
+    std::atomic<Record*> records_{nullptr};   // 기록은 반납만 하고 해제하지 않음
+};
+
+/**
+ * @brief 읽기 구간 RAII
+ */
+class EpochGuard {
+public:
+    EpochGuard() noexcept {
+        EpochDomain::instance().enter();
+    }
+
+    ~EpochGuard() {
+        EpochDomain::instance().exit();
+    }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+/**
+ * @brief 떼어 낸 노드를 회수 가능해질 때까지 보관하는 목록 (스레드 안전)
+ *
+ * retire()마다 회수를 시도하므로 읽는 스레드가 없을 때는 바로 해제됩니다. 소멸자는 남은 노드를
+ * 모두 해제하므로 소유 구조를 더 이상 아무도 읽지 않을 때 파괴해야 합니다.
+ */
+class EpochRetireList {
+public:
+    using Deleter = void (*)(void*);
+
+    EpochRetireList() = default;
+    ~EpochRetireList();
+
+    EpochRetireList(const EpochRetireList&) = delete;
+    EpochRetireList& operator=(const EpochRetireList&) = delete;
+
+    template <typename T>
+    void retire(T* node) {
+        retire(node, [](void* pointer) { delete static_cast<T*>(pointer); });
+    }
+
+    void retire(void* node, Deleter deleter);
+
+    /**
+     * @brief 회수 가능한 노드 해제 (해제 함수는 잠금 밖에서 호출)
+     */
+    void collect();
+
+    /**
+     * @brief 아직 해제하지 못한 노드 수
+     */
+    size_t get_pending_count() const;
+
+private:
+    struct Retired {
+        void* node;
+        Deleter deleter;
+        uint64_t epoch;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Retired> retired_;
+};
+
+} // namespace mmorpg::common
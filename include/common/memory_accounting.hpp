@@ -0,0 +1,244 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 메모리 사용 분류
+ */
+enum class MemoryCategory {
+    CONNECTIONS,    // 연결 객체와 연결별 상태
+    BUFFERS,        // 송수신 버퍼, 송신 대기 프레임
+    WORLD,          // 월드/엔티티 상태
+    CACHES          // 다시 만들 수 있는 캐시 (압박 시 먼저 줄임)
+};
+
+inline const char* to_string(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::CONNECTIONS: return "CONNECTIONS";
+        case MemoryCategory::BUFFERS: return "BUFFERS";
+        case MemoryCategory::WORLD: return "WORLD";
+        case MemoryCategory::CACHES: return "CACHES";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief 소유자(에이전트/서브시스템) 하나의 분류 하나에 대한 바이트 계정
+ *
+ * charge/release는 relaxed 원자 연산 하나(최댓값 갱신 시 하나 더)이므로 운영 중에도 켜 둡니다.
+ * 예산(budget)은 소프트 한도로, 넘어도 할당을 막지 않고 over_budget()과 압박 리스너로 알립니다.
+ * 계정은 MemoryRegistry가 소유하며 프로세스가 끝날 때까지 주소가 바뀌지 않습니다.
+ */
+class MemoryAccount {
+public:
+    MemoryAccount(std::string owner, MemoryCategory category)
+        : owner_(std::move(owner))
+        , category_(category) {
+    }
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    void charge(size_t bytes) noexcept {
+        const size_t current = bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_.load(std::memory_order_relaxed);
+        while (current > peak && !peak_.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+    }
+
+    void release(size_t bytes) noexcept {
+        bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 소프트 예산 설정 (0이면 제한 없음)
+     */
+    void set_budget(size_t bytes) noexcept {
+        budget_.store(bytes, std::memory_order_relaxed);
+    }
+
+    size_t get_bytes() const noexcept {
+        return bytes_.load(std::memory_order_relaxed);
+    }
+
+    size_t get_peak() const noexcept {
+        return peak_.load(std::memory_order_relaxed);
+    }
+
+    size_t get_budget() const noexcept {
+        return budget_.load(std::memory_order_relaxed);
+    }
+
+    bool over_budget() const noexcept {
+        const size_t budget = get_budget();
+        return budget != 0 && get_bytes() > budget;
+    }
+
+    const std::string& get_owner() const noexcept {
+        return owner_;
+    }
+
+    MemoryCategory get_category() const noexcept {
+        return category_;
+    }
+
+private:
+    const std::string owner_;
+    const MemoryCategory category_;
+    std::atomic<size_t> bytes_{0};
+    std::atomic<size_t> peak_{0};
+    std::atomic<size_t> budget_{0};
+};
+
+/**
+ * @brief 계정 하나의 조회 시점 값
+ */
+struct MemoryUsage {
+    std::string owner;
+    MemoryCategory category = MemoryCategory::CONNECTIONS;
+    size_t bytes = 0;
+    size_t peak = 0;
+    size_t budget = 0;
+};
+
+/**
+ * @brief 소유자 × 분류별 메모리 계정 목록과 예산 압박 알림
+ *
+ * 각 서브시스템은 시작 시 account()로 계정을 받아 두고 핫 패스에서는 그 계정에만 기록합니다.
+ * check_budgets()는 모니터링 집계 주기마다 호출되며, 예산을 넘은 계정의 압박 리스너를 불러
+ * 캐시를 줄이거나 새 작업을 거절하게 합니다.
+ */
+class MemoryRegistry {
+public:
+    /**
+     * @brief 압박 리스너 (예산을 넘은 계정, check_budgets 호출 스레드에서 실행)
+     */
+    using PressureListener = std::function<void(const MemoryAccount& account)>;
+
+    static MemoryRegistry& instance();
+
+    MemoryRegistry() = default;
+    MemoryRegistry(const MemoryRegistry&) = delete;
+    MemoryRegistry& operator=(const MemoryRegistry&) = delete;
+
+    /**
+     * @brief 소유자/분류 계정 (없으면 생성, 반환된 참조는 레지스트리 수명 동안 유효)
+     */
+    MemoryAccount& account(const std::string& owner, MemoryCategory category);
+
+    /**
+     * @brief 소프트 예산 설정 (0이면 제한 없음, 계정이 없으면 생성)
+     */
+    void set_budget(const std::string& owner, MemoryCategory category, size_t bytes);
+
+    /**
+     * @brief 계정의 예산 압박 리스너 등록
+     * @return remove_pressure_listener에 넘길 ID
+     */
+    uint64_t add_pressure_listener(const std::string& owner, MemoryCategory category, PressureListener listener);
+
+    /**
+     * @brief 리스너 해제 (반환 후에는 리스너가 실행 중이지 않음)
+     */
+    void remove_pressure_listener(uint64_t listener_id);
+
+    /**
+     * @brief 예산을 넘은 계정의 리스너 실행
+     *
+     * 리스너는 레지스트리 잠금을 잡은 채로 실행되므로 그 안에서 리스너를 등록/해제하면 안 됩니다.
+     * @return 예산을 넘은 계정 수
+     */
+    size_t check_budgets();
+
+    /**
+     * @brief 전체 계정 값 (등록 순서)
+     */
+    std::vector<MemoryUsage> snapshot() const;
+
+    /**
+     * @brief 소유자 하나의 계정 값
+     */
+    std::vector<MemoryUsage> snapshot(const std::string& owner) const;
+
+    /**
+     * @brief 모든 계정의 현재 바이트 합계
+     */
+    size_t get_total_bytes() const;
+
+private:
+    struct Listener {
+        uint64_t id = 0;
+        MemoryAccount* account = nullptr;
+        PressureListener callback;
+    };
+
+    MemoryAccount* find_locked(const std::string& owner, MemoryCategory category) const;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<MemoryAccount>> accounts_;
+
+    std::mutex listeners_mutex_;
+    std::vector<Listener> listeners_;
+    uint64_t next_listener_id_ = 1;
+};
+
+/**
+ * @brief 할당 크기를 계정에 기록하는 표준 할당자
+ *
+ * 컨테이너의 노드/버킷 할당을 그대로 집계합니다. 계정이 없으면 기록하지 않습니다.
+ */
+template <typename T>
+class TrackingAllocator {
+public:
+    using value_type = T;
+
+    TrackingAllocator() noexcept = default;
+
+    explicit TrackingAllocator(MemoryAccount* account) noexcept
+        : account_(account) {
+    }
+
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U>& other) noexcept
+        : account_(other.get_account()) {
+    }
+
+    T* allocate(size_t count) {
+        T* memory = std::allocator<T>().allocate(count);
+        if (account_) {
+            account_->charge(count * sizeof(T));
+        }
+        return memory;
+    }
+
+    void deallocate(T* memory, size_t count) noexcept {
+        if (account_) {
+            account_->release(count * sizeof(T));
+        }
+        std::allocator<T>().deallocate(memory, count);
+    }
+
+    MemoryAccount* get_account() const noexcept {
+        return account_;
+    }
+
+    template <typename U>
+    bool operator==(const TrackingAllocator<U>& other) const noexcept {
+        return account_ == other.get_account();
+    }
+
+private:
+    MemoryAccount* account_ = nullptr;
+};
+
+} // namespace mmorpg::common
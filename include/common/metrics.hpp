@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 지연 시간 히스토그램 스냅샷
+ */
+struct HistogramSnapshot {
+    static constexpr size_t kBuckets = 28;
+
+    std::array<uint64_t, kBuckets> counts{};
+    uint64_t count = 0;
+    uint64_t sum_ns = 0;
+
+    /**
+     * @brief 버킷 i의 상한 (ns)
+     */
+    static constexpr uint64_t bucket_upper_bound_ns(size_t i) noexcept {
+        return uint64_t{1} << (i + 8);
+    }
+
+    /**
+     * @brief 분위수 추정 (버킷 내부 선형 보간, ns)
+     */
+    double percentile(double q) const noexcept;
+
+    double mean_ns() const noexcept {
+        return count ? static_cast<double>(sum_ns) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief 두 스냅샷의 차이 (집계 구간별 값 계산용)
+     */
+    HistogramSnapshot operator-(const HistogramSnapshot& previous) const noexcept;
+    HistogramSnapshot& operator+=(const HistogramSnapshot& other) noexcept;
+};
+
+/**
+ * @brief 잠금 없는 로그 스케일 지연 시간 히스토그램
+ *
+ * 버킷 i는 [2^(i+7), 2^(i+8)) ns 구간을 담습니다 (256ns ~ 약 34초).
+ * 기록은 relaxed fetch_add 두 번이므로 핫 패스에서 호출해도 됩니다.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t kBuckets = HistogramSnapshot::kBuckets;
+
+    static constexpr size_t bucket_index(uint64_t ns) noexcept {
+        const int width = std::bit_width(ns);
+        if (width <= 8) {
+            return 0;
+        }
+        const size_t index = static_cast<size_t>(width - 8);
+        return index < kBuckets ? index : kBuckets - 1;
+    }
+
+    void record(uint64_t ns) noexcept {
+        buckets_[bucket_index(ns)].fetch_add(1, std::memory_order_relaxed);
+        sum_ns_.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    HistogramSnapshot snapshot() const noexcept;
+
+private:
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+    std::atomic<uint64_t> sum_ns_{0};
+};
+
+/**
+ * @brief Prometheus 텍스트 포맷 라벨 값 이스케이프
+ */
+std::string escape_prometheus_label(const std::string& value);
+
+} // namespace mmorpg::common
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 큰 메모리 영역의 huge page 사용 방식
+ */
+enum class HugePageMode {
+    OFF,            // 일반 4KB 페이지
+    TRANSPARENT,    // THP (madvise(MADV_HUGEPAGE)) - 커널이 가능할 때 2MB 페이지로 합침
+    EXPLICIT        // hugetlbfs 예약 페이지 (MAP_HUGETLB), 예약분이 없으면 TRANSPARENT로 대체
+};
+
+inline const char* to_string(HugePageMode mode) {
+    switch (mode) {
+        case HugePageMode::OFF: return "OFF";
+        case HugePageMode::TRANSPARENT: return "TRANSPARENT";
+        case HugePageMode::EXPLICIT: return "EXPLICIT";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief 프로세스 메모리 배치 정책
+ */
+struct MemoryPlacementOptions {
+    bool numa_aware = true;                              // NUMA 노드별 I/O 샤드 + 스레드 바인딩
+    HugePageMode huge_pages = HugePageMode::TRANSPARENT;
+};
+
+/**
+ * @brief 메모리 배치 정책 설정 (스레드와 에이전트를 만들기 전에 한 번 호출)
+ */
+void configure_memory_placement(const MemoryPlacementOptions& options);
+
+/**
+ * @brief 현재 메모리 배치 정책
+ */
+const MemoryPlacementOptions& memory_placement() noexcept;
+
+/**
+ * @brief NUMA 노드와 노드별 CPU 목록 (/sys/devices/system/node)
+ *
+ * 노드 정보를 읽을 수 없는 환경에서는 모든 CPU를 가진 노드 하나로 봅니다.
+ * 노드 인덱스는 0부터 연속이며 커널 노드 번호와 다를 수 있습니다 (get_node_id()).
+ */
+class NumaTopology {
+public:
+    static const NumaTopology& instance();
+
+    size_t node_count() const noexcept {
+        return node_ids_.size();
+    }
+
+    bool is_numa() const noexcept {
+        return node_ids_.size() > 1;
+    }
+
+    int get_node_id(size_t node) const {
+        return node_ids_.at(node);
+    }
+
+    const std::vector<int>& cpus_of(size_t node) const {
+        return node_cpus_.at(node);
+    }
+
+    /**
+     * @brief 호출 스레드가 지금 실행 중인 노드 인덱스 (알 수 없으면 0)
+     */
+    size_t current_node() const noexcept;
+
+private:
+    NumaTopology();
+
+    std::vector<int> node_ids_;
+    std::vector<std::vector<int>> node_cpus_;
+};
+
+/**
+ * @brief 호출 스레드를 노드 CPU에 고정하고 이후 할당을 그 노드 메모리에 우선 배치
+ *
+ * 이 스레드가 처음 건드리는 페이지(malloc 스레드 아레나 포함)가 해당 노드에 놓입니다.
+ * @return 바인딩에 실패하면 false (스레드는 그대로 동작)
+ */
+bool bind_thread_to_node(size_t node);
+
+/**
+ * @brief 노드 지정 + huge page 기반 익명 메모리 영역 (mmap)
+ *
+ * 큰 풀의 백업 메모리로 씁니다. 크기는 huge page 단위(2MB)로 올림하고, 첫 접근 전에
+ * 노드를 지정하므로 어느 스레드가 먼저 쓰든 지정한 노드에 놓입니다.
+ */
+class HugePageRegion {
+public:
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    HugePageRegion() = default;
+
+    /**
+     * @param node 노드 인덱스 (-1이면 첫 접근 스레드의 노드)
+     */
+    explicit HugePageRegion(size_t size, int node = -1, HugePageMode mode = memory_placement().huge_pages);
+    ~HugePageRegion();
+
+    HugePageRegion(HugePageRegion&& other) noexcept;
+    HugePageRegion& operator=(HugePageRegion&& other) noexcept;
+    HugePageRegion(const HugePageRegion&) = delete;
+    HugePageRegion& operator=(const HugePageRegion&) = delete;
+
+    char* data() const noexcept {
+        return data_;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief 실제로 적용된 방식 (EXPLICIT 예약분이 없으면 TRANSPARENT, madvise 실패 시 OFF)
+     */
+    HugePageMode get_backing() const noexcept {
+        return backing_;
+    }
+
+private:
+    void release() noexcept;
+
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    HugePageMode backing_ = HugePageMode::OFF;
+};
+
+/**
+ * @brief NUMA 배치 통계
+ */
+struct NumaStats {
+    std::vector<uint64_t> resident_pages;   // 노드별 이 프로세스의 상주 페이지 (/proc/self/numa_maps)
+    uint64_t local_allocations = 0;         // 실행 중인 노드에서 할당된 페이지 (시스템 누적, numastat local_node)
+    uint64_t remote_allocations = 0;        // 다른 노드에서 실행 중에 할당된 페이지 (시스템 누적, numastat other_node)
+};
+
+/**
+ * @brief NUMA 배치 통계 수집 (모니터링 집계 주기마다 호출, /proc 읽기 비용이 있음)
+ */
+NumaStats sample_numa_stats();
+
+} // namespace mmorpg::common
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 프로세스 CPU/메모리 사용률 샘플러
+ *
+ * CPU 사용률은 직전 sample() 이후 소비한 CPU 시간을 경과 시간 x 코어 수로 나눈 값(0.0 ~ 1.0)입니다.
+ * 메모리 사용률은 상주 메모리(RSS)를 물리 메모리로 나눈 값입니다. 스레드 안전하지 않습니다.
+ */
+class ProcessUsageSampler {
+public:
+    ProcessUsageSampler();
+
+    /**
+     * @brief 직전 호출 이후 구간의 CPU 사용률 (첫 호출은 생성 이후 구간)
+     */
+    double sample_cpu_usage();
+
+    /**
+     * @brief 현재 메모리 사용률
+     */
+    static double memory_usage();
+
+private:
+    static uint64_t cpu_time_us();
+
+    uint64_t last_cpu_us_;
+    std::chrono::steady_clock::time_point last_time_;
+};
+
+} // namespace mmorpg::common
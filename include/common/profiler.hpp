@@ -0,0 +1,242 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 프로파일러 존 이벤트 (Chrome trace의 "X" 이벤트 하나에 대응)
+ *
+ * name/category는 문자열 리터럴처럼 프로세스 수명 동안 유효한 포인터여야 합니다.
+ */
+struct ProfileEvent {
+    const char* name = nullptr;
+    const char* category = nullptr;
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+};
+
+/**
+ * @brief 스레드별 프로파일 링 버퍼
+ *
+ * 소유 스레드만 기록하고, 덤프 스레드는 head_를 기준으로 복사한 뒤
+ * 복사 도중 덮어쓰였을 수 있는 구간을 버립니다. 필드는 relaxed 원자 변수라서
+ * 기록 비용은 일반 저장과 같고 TSan 빌드에서도 경합으로 보고되지 않습니다.
+ */
+class ProfileRingBuffer {
+public:
+#ifdef MMORPG_PROFILER_RING_CAPACITY
+    static constexpr size_t kCapacity = MMORPG_PROFILER_RING_CAPACITY;
+#else
+    static constexpr size_t kCapacity = 16384;
+#endif
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "ring capacity must be a power of two");
+
+    ProfileRingBuffer(uint32_t thread_id, std::string thread_name);
+
+    /**
+     * @brief 이벤트 기록 (소유 스레드 전용)
+     */
+    void push(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns) noexcept {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & (kCapacity - 1)];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.category.store(category, std::memory_order_relaxed);
+        slot.start_ns.store(start_ns, std::memory_order_relaxed);
+        slot.end_ns.store(end_ns, std::memory_order_relaxed);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief since_ns 이후에 끝난 이벤트를 out에 추가
+     */
+    void snapshot(std::vector<ProfileEvent>& out, uint64_t since_ns) const;
+
+    uint32_t thread_id() const noexcept { return thread_id_; }
+    std::string thread_name() const;
+    void set_thread_name(std::string name);
+
+private:
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<const char*> category{nullptr};
+        std::atomic<uint64_t> start_ns{0};
+        std::atomic<uint64_t> end_ns{0};
+    };
+
+    std::array<Slot, kCapacity> slots_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint32_t thread_id_;
+    std::string thread_name_;
+    mutable std::mutex name_mutex_;
+};
+
+/**
+ * @brief 상시 동작하는 저비용 존 프로파일러
+ *
+ * RAII 존(ScopedZone)이 스레드별 링 버퍼에 타임스탬프를 기록하고,
+ * 틱 예산 초과나 시그널 같은 트리거가 발생하면 최근 N초 구간을
+ * Chrome trace / Perfetto에서 열 수 있는 JSON으로 덤프합니다.
+ */
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static Profiler& instance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * @brief 현재 시각 (ns, steady_clock 기준)
+     */
+    static uint64_t now_ns() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief 존 기록 활성화 여부
+     */
+    bool is_enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+    void set_enabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief 현재 스레드에 존 기록
+     */
+    void record(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns) noexcept {
+        thread_buffer().push(name, category, start_ns, end_ns);
+    }
+
+    /**
+     * @brief 현재 스레드 이름 지정 (trace의 스레드 트랙 이름)
+     */
+    void set_thread_name(const std::string& name);
+
+    /**
+     * @brief 덤프 파일 저장 디렉토리 및 덤프 구간 설정
+     */
+    void set_output_directory(const std::string& directory);
+    void set_dump_window(std::chrono::milliseconds window);
+
+    /**
+     * @brief 덤프 요청 (async-signal-safe, 시그널 핸들러에서 호출 가능)
+     */
+    void request_dump() noexcept;
+
+    /**
+     * @brief 틱 종료 보고 - 예산 초과 시 덤프 요청
+     * @return 예산 초과 여부
+     */
+    bool end_tick(uint64_t tick_start_ns, std::chrono::microseconds budget);
+
+    /**
+     * @brief 대기 중인 덤프 요청 처리 (메인 루프에서 주기적으로 호출)
+     *
+     * 실제 직렬화는 백그라운드 스레드에서 수행하므로 호출 스레드를 막지 않습니다.
+     */
+    void poll();
+
+    /**
+     * @brief 최근 window 구간의 이벤트를 Chrome trace JSON으로 기록
+     * @return 기록한 이벤트 수
+     */
+    size_t dump_chrome_trace(const std::string& path, std::chrono::milliseconds window) const;
+
+    /**
+     * @brief 모든 스레드의 최근 window 구간 이벤트 수집
+     */
+    std::vector<std::pair<std::shared_ptr<ProfileRingBuffer>, std::vector<ProfileEvent>>>
+    collect(std::chrono::milliseconds window) const;
+
+    /**
+     * @brief 진행 중인 백그라운드 덤프 완료 대기
+     */
+    void shutdown();
+
+    uint64_t get_overrun_count() const noexcept { return overrun_count_.load(std::memory_order_relaxed); }
+    uint64_t get_dump_count() const noexcept { return dump_count_.load(std::memory_order_relaxed); }
+
+private:
+    Profiler() = default;
+    ~Profiler();
+
+    ProfileRingBuffer& thread_buffer() noexcept {
+        thread_local ProfileRingBuffer* buffer = register_thread();
+        return *buffer;
+    }
+
+    ProfileRingBuffer* register_thread();
+    void start_dump(const char* reason);
+
+    std::atomic<bool> enabled_{true};
+    std::atomic<bool> dump_requested_{false};
+    std::atomic<bool> overrun_pending_{false};
+    std::atomic<uint64_t> overrun_count_{0};
+    std::atomic<uint64_t> dump_count_{0};
+    std::atomic<uint32_t> next_thread_id_{1};
+
+    mutable std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<ProfileRingBuffer>> buffers_;
+
+    std::mutex config_mutex_;
+    std::string output_directory_{"profile_dumps"};
+    std::chrono::milliseconds dump_window_{5000};
+    std::chrono::seconds dump_cooldown_{10};
+    Clock::time_point last_dump_time_{};
+
+    std::thread dump_thread_;
+    std::atomic<bool> dumping_{false};
+};
+
+/**
+ * @brief RAII 프로파일 존
+ */
+class ScopedZone {
+public:
+    explicit ScopedZone(const char* name, const char* category = "default") noexcept
+        : name_(name)
+        , category_(category)
+        , start_ns_(Profiler::instance().is_enabled() ? Profiler::now_ns() : 0) {
+    }
+
+    ~ScopedZone() {
+        if (start_ns_ != 0) {
+            Profiler::instance().record(name_, category_, start_ns_, Profiler::now_ns());
+        }
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    uint64_t start_ns_;
+};
+
+} // namespace mmorpg::common
+
+// 프로파일 존 매크로 (ENABLE_ZONE_PROFILER=OFF이면 비용 없음)
+#define MMORPG_PROFILE_CONCAT_INNER(a, b) a##b
+#define MMORPG_PROFILE_CONCAT(a, b) MMORPG_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef MMORPG_ENABLE_ZONE_PROFILER
+#define PROFILE_ZONE(name) \
+    ::mmorpg::common::ScopedZone MMORPG_PROFILE_CONCAT(profile_zone_, __LINE__)(name)
+#define PROFILE_ZONE_CAT(name, category) \
+    ::mmorpg::common::ScopedZone MMORPG_PROFILE_CONCAT(profile_zone_, __LINE__)(name, category)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_ZONE_CAT(name, category) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 클라이언트로 아직 보내지 못한 프레임
+ */
+struct PendingFrame {
+    std::string payload;
+    bool binary = false;
+};
+
+/**
+ * @brief 노드 간 세션 이전 시 넘기는 세션 (연결 계층 → 노드 간 채널 → 새 노드의 연결 계층)
+ */
+struct SessionHandoff {
+    std::string token;                        // 클라이언트가 새 노드에 제출할 재접속 토큰
+    std::string user_id;
+    std::string state;                        // 게임 로직이 직렬화한 플레이어 상태 (연결 계층은 해석하지 않음)
+    std::vector<PendingFrame> pending_frames; // 이전 노드의 송신 큐에 남아 있던 프레임 (순서 유지)
+};
+
+} // namespace mmorpg::common
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+namespace mmorpg::common {
+
+/**
+ * @brief 토큰 버킷 (초당 rate개씩 채워지고 최대 burst개까지 쌓임)
+ *
+ * 잠금이 없으므로 소유자 한 곳(연결의 strand 등)에서만 사용합니다.
+ * rate가 0이면 제한 없이 항상 통과합니다.
+ *
+ * consume()은 토큰이 모자라도 차감해 빚을 남기고, 이후 try_consume()/time_until()은
+ * 빚을 갚을 때까지 기다리게 합니다 (미룰 수 없는 트래픽도 예산에 반영하기 위함).
+ */
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TokenBucket() = default;
+
+    TokenBucket(double rate, double burst) {
+        configure(rate, burst);
+    }
+
+    /**
+     * @brief 속도/버스트 변경 (쌓인 토큰은 새 burst로 잘라 유지)
+     */
+    void configure(double rate, double burst) noexcept {
+        rate_ = rate;
+        burst_ = std::max(burst, rate > 0.0 ? 1.0 : 0.0);
+        tokens_ = std::min(initialized_ ? tokens_ : burst_, burst_);
+        initialized_ = true;
+    }
+
+    bool try_consume(double tokens = 1.0, Clock::time_point now = Clock::now()) noexcept {
+        if (rate_ <= 0.0) {
+            return true;
+        }
+        refill(now);
+        if (tokens_ < tokens) {
+            return false;
+        }
+        tokens_ -= tokens;
+        return true;
+    }
+
+    /**
+     * @brief 토큰이 모자라도 차감 (빚 허용)
+     */
+    void consume(double tokens, Clock::time_point now = Clock::now()) noexcept {
+        if (rate_ <= 0.0) {
+            return;
+        }
+        refill(now);
+        tokens_ -= tokens;
+    }
+
+    /**
+     * @brief tokens개(burst보다 크면 burst개)가 쌓일 때까지 남은 시간 (0이면 지금 꺼낼 수 있음)
+     *
+     * burst보다 큰 요청은 버킷이 가득 찼을 때 통과시키므로 try_consume 대신
+     * time_until()이 0일 때 consume()으로 꺼냅니다.
+     */
+    Clock::duration time_until(double tokens, Clock::time_point now = Clock::now()) noexcept {
+        if (rate_ <= 0.0) {
+            return Clock::duration::zero();
+        }
+        refill(now);
+        const double missing = std::min(tokens, burst_) - tokens_;
+        if (missing <= 0.0) {
+            return Clock::duration::zero();
+        }
+        return std::chrono::ceil<Clock::duration>(std::chrono::duration<double>(missing / rate_));
+    }
+
+    double get_rate() const noexcept {
+        return rate_;
+    }
+
+    double get_burst() const noexcept {
+        return burst_;
+    }
+
+private:
+    void refill(Clock::time_point now) noexcept {
+        if (last_refill_ == Clock::time_point{}) {
+            last_refill_ = now;
+            return;
+        }
+        if (now <= last_refill_) {
+            return;
+        }
+        const double elapsed = std::chrono::duration<double>(now - last_refill_).count();
+        tokens_ = std::min(burst_, tokens_ + elapsed * rate_);
+        last_refill_ = now;
+    }
+
+    double rate_ = 0.0;
+    double burst_ = 0.0;
+    double tokens_ = 0.0;
+    bool initialized_ = false;
+    Clock::time_point last_refill_{};
+};
+
+} // namespace mmorpg::common
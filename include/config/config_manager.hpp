@@ -0,0 +1,107 @@
+#pragma once
+
+#include "config/server_config.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mmorpg::config {
+
+/**
+ * @brief 서버 설정 게시/리로드 관리자
+ *
+ * current()는 원자 포인터 하나를 읽으므로 핫 패스에서 매번 호출해도 됩니다.
+ * 이전 스냅샷은 해제하지 않고 보관하므로 다른 스레드가 읽던 참조는
+ * 리로드 이후에도 유효합니다 (리로드는 드물고 스냅샷은 작음).
+ *
+ * SIGHUP 핸들러는 request_reload()로 플래그만 세우고,
+ * 실제 파일 읽기와 리스너 호출은 메인 루프의 poll()에서 수행합니다.
+ */
+class ConfigManager {
+public:
+    /**
+     * @brief 리로드 리스너 (이전 스냅샷, 새 스냅샷)
+     */
+    using Listener = std::function<void(const ServerConfig& previous, const ServerConfig& current)>;
+
+    static ConfigManager& instance();
+
+    ConfigManager(const ConfigManager&) = delete;
+    ConfigManager& operator=(const ConfigManager&) = delete;
+
+    /**
+     * @brief 현재 설정 스냅샷 (잠금 없음)
+     */
+    const ServerConfig& current() const noexcept {
+        return *current_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 파일에서 설정을 읽어 게시하고 리로드 경로로 기억
+     * @return 성공 여부 (실패 시 기존 설정 유지)
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief 마지막으로 로드한 파일을 다시 읽어 게시
+     */
+    bool reload();
+
+    /**
+     * @brief 설정 게시 (리스너 호출 포함)
+     */
+    void publish(const ServerConfig& config);
+
+    /**
+     * @brief 리로드 리스너 등록
+     * @return remove_listener()에 넘길 ID
+     */
+    uint64_t add_listener(Listener listener);
+
+    /**
+     * @brief 리로드 리스너 해제
+     */
+    void remove_listener(uint64_t listener_id);
+
+    /**
+     * @brief 리로드 요청 (async-signal-safe, SIGHUP 핸들러에서 호출)
+     */
+    void request_reload() noexcept;
+
+    /**
+     * @brief 대기 중인 리로드 요청 처리 (메인 루프에서 주기적으로 호출)
+     * @return 리로드를 수행했으면 true
+     */
+    bool poll();
+
+    /**
+     * @brief 게시된 설정 세대 (최초 1, 게시마다 증가)
+     */
+    uint64_t get_generation() const noexcept { return generation_.load(std::memory_order_acquire); }
+
+    const std::string& get_path() const { return path_; }
+
+private:
+    ConfigManager();
+
+    std::atomic<const ServerConfig*> current_;
+    std::atomic<uint64_t> generation_{1};
+    std::atomic<bool> reload_requested_{false};
+
+    // 게시/리스너 등록 직렬화 (읽기 경로와 무관)
+    std::mutex publish_mutex_;
+    std::vector<std::unique_ptr<const ServerConfig>> snapshots_;
+    std::vector<std::pair<uint64_t, Listener>> listeners_;
+    uint64_t next_listener_id_ = 1;
+    std::string path_;
+};
+
+/**
+ * @brief 명령행에서 --config=경로 추출 (없으면 빈 문자열)
+ */
+std::string find_config_argument(int argc, char* argv[]);
+
+} // namespace mmorpg::config
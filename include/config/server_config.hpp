@@ -0,0 +1,111 @@
+#pragma once
+
+#include "common/numa.hpp"
+#include "network/session_mode.hpp"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mmorpg::config {
+
+/**
+ * @brief 서버 설정 스냅샷
+ *
+ * 한 번 게시된 스냅샷은 변경되지 않습니다. 리로드는 새 스냅샷을 만들어
+ * ConfigManager가 원자적으로 교체하므로 읽는 쪽은 잠금 없이 필드를 읽습니다.
+ *
+ * 주석에 [live]로 표시된 값은 SIGHUP 리로드 시 즉시 반영되고,
+ * [restart]로 표시된 값은 재시작해야 적용됩니다.
+ */
+struct ServerConfig {
+    // [server]
+    uint16_t port = 8080;                              // [restart] WebSocket 리스닝 포트
+    uint32_t max_connections = 5000;                   // [live] 동시 접속 한도
+    uint32_t tick_rate = 60;                           // [live] 메인 루프 틱 (Hz)
+    uint32_t worker_threads = 0;                       // [restart] I/O 스레드 수 (0 = 코어 수)
+    std::chrono::seconds idle_timeout{300};            // [live] 비활성 연결 정리 기준
+    uint32_t max_frame_bytes_pre_auth = 4096;          // [live] 인증 전 최대 수신 메시지 크기 (넘으면 연결 끊음)
+    uint32_t max_frame_bytes = 65536;                  // [live] 인증 후 최대 수신 메시지 크기
+    std::chrono::seconds ping_interval{5};             // [restart] RTT 측정 핑 주기 (0 = 측정 안 함)
+    std::chrono::seconds drain_timeout{10};            // [live] 종료 시 세션 이전/송신 큐 비우기를 기다리는 최대 시간
+    network::SessionMode session_mode = network::SessionMode::CALLBACK_CHAIN;  // [restart] 연결 읽기 루프 방식 (callback / coroutine)
+
+    // [monitoring]
+    uint16_t metrics_port = 8000;                      // [restart] /metrics HTTP 포트 (0 = 비활성)
+    std::chrono::seconds monitoring_interval{10};      // [restart] 집계 주기
+
+    // [rate_limit]
+    uint32_t messages_per_second = 60;                 // [live] 연결당 초당 메시지 수 (넘으면 연결 끊음)
+    uint32_t message_burst = 120;                      // [live] 토큰 버킷 버스트 크기
+
+    // [bandwidth]
+    uint64_t connection_bytes_per_second = 0;          // [live] 연결당 송신 한도 (0 = 제한 없음, 넘으면 LOW 프레임을 미룸)
+    uint64_t node_bytes_per_second = 0;                // [live] 노드 전체 송신 한도
+
+    // [aoi]
+    float aoi_radius = 100.0f;                         // [live] 관심 영역 반경 (월드 단위)
+    float aoi_hysteresis = 10.0f;                      // [live] 경계 진동 방지 여유
+
+    // [database]
+    std::string database_host = "localhost";           // [restart]
+    uint16_t database_port = 5432;                     // [restart]
+    std::string database_name = "mmorpg";              // [restart]
+
+    // [cluster]
+    std::string cluster_node_id;                       // [restart] 이 노드 ID (비어 있으면 클러스터 비활성)
+    std::string cluster_listen = "0.0.0.0:7100";       // [restart] 노드 간 gRPC 리스닝 주소
+    std::map<std::string, std::string> cluster_peers;  // [restart] 노드 ID -> 주소 ("b=host:port,c=host:port")
+    uint32_t cluster_max_in_flight_batches = 8;        // [restart] 피어별 미확인 배치 한도
+    std::string cluster_gossip_listen = "127.0.0.1:7200";  // [restart] 멤버십 가십 UDP 주소 (다른 노드가 닿을 수 있어야 함)
+    std::vector<std::string> cluster_seeds;            // [restart] 합류할 노드의 가십 주소 목록
+    std::string cluster_service_host = "127.0.0.1";    // [restart] LoadBalancer에 알릴 클라이언트 접속 호스트
+    std::chrono::seconds cluster_suspect_timeout{3};   // [restart] 응답 없는 노드를 의심 후 제거하기까지의 시간
+
+    // [udp]
+    bool udp_enabled = false;                          // [restart] 인증된 연결에 이동/스냅샷용 UDP 보조 채널 제공
+    std::string udp_listen = "0.0.0.0:7300";           // [restart] UDP 채널 주소 (포트는 UdpOffer로 클라이언트에 알림)
+
+    // [memory]
+    bool numa_aware = true;                            // [restart] NUMA 노드별 I/O 샤드와 노드 로컬 할당
+    common::HugePageMode huge_pages = common::HugePageMode::TRANSPARENT;  // [restart] 큰 풀의 huge page 방식
+    uint32_t connection_budget_mb = 0;                 // [live] 연결 상태 소프트 예산 (0 = 제한 없음, 넘으면 새 연결 거부)
+    uint32_t buffer_budget_mb = 0;                     // [live] 송수신 버퍼 소프트 예산 (넘으면 새 연결 거부)
+    uint32_t cache_budget_mb = 0;                      // [live] 플레이어 디렉터리 니어 캐시 소프트 예산 (넘으면 캐시 축소)
+
+    /**
+     * @brief 틱 예산 (1 / tick_rate)
+     */
+    std::chrono::microseconds tick_budget() const {
+        return std::chrono::microseconds(1000000 / (tick_rate ? tick_rate : 1));
+    }
+
+    /**
+     * @brief 재시작이 필요한 값이 다른 항목 이름 목록 (리로드 경고용)
+     */
+    std::vector<std::string> restart_required_changes(const ServerConfig& other) const;
+};
+
+/**
+ * @brief INI 텍스트를 "section.key" -> 값 맵으로 파싱
+ *
+ * '#' 또는 ';'로 시작하는 줄은 주석입니다. 형식 오류 시 error에 줄 번호를 기록하고 nullopt를 반환합니다.
+ */
+std::optional<std::map<std::string, std::string>> parse_ini(std::string_view text, std::string* error = nullptr);
+
+/**
+ * @brief INI 텍스트로부터 설정 생성 (지정하지 않은 키는 기본값 유지)
+ *
+ * 알 수 없는 키는 경고만 남기고, 범위를 벗어난 값은 오류로 처리합니다.
+ */
+std::optional<ServerConfig> parse_server_config(std::string_view text, std::string* error = nullptr);
+
+/**
+ * @brief 파일에서 설정 로드
+ */
+std::optional<ServerConfig> load_server_config(const std::string& path, std::string* error = nullptr);
+
+} // namespace mmorpg::config
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "common/token_bucket.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace mmorpg::network {
+
+/**
+ * @brief 송신 프레임 우선순위
+ */
+enum class SendPriority : uint8_t {
+    NORMAL,   // 대역폭 한도와 관계없이 바로 전송 (예산에는 반영)
+    LOW       // 한도를 넘으면 토큰이 쌓일 때까지 미룸 (최신 값만 의미 있는 스냅샷 등)
+};
+
+/**
+ * @brief 송신 대역폭 한도 (0이면 제한 없음)
+ *
+ * 버킷 크기는 kBurstSeconds 동안 보낼 양입니다.
+ */
+struct BandwidthLimits {
+    static constexpr double kBurstSeconds = 0.25;
+
+    uint64_t connection_bytes_per_second = 0;
+    uint64_t node_bytes_per_second = 0;
+
+    static double burst_for(uint64_t bytes_per_second) noexcept {
+        return static_cast<double>(bytes_per_second) * kBurstSeconds;
+    }
+};
+
+/**
+ * @brief 미룬 송신 누적 통계
+ */
+struct EgressStats {
+    uint64_t deferred_frames = 0;   // LOW 프레임이 한도 때문에 기다린 횟수 (다시 기다리면 다시 셈)
+    uint64_t deferred_bytes = 0;
+};
+
+/**
+ * @brief 노드 전체 송신 토큰 버킷 (모든 I/O 스레드가 공유)
+ *
+ * NORMAL 프레임은 charge()로 빚을 지며 바로 나가고, LOW 프레임은 acquire()가 0을 돌려줄 때만
+ * 나갑니다. 그래서 큰 이벤트로 NORMAL 트래픽이 늘면 LOW 레인이 먼저 밀려 노드 송신량이
+ * 한도 근처에 머뭅니다. 연결별 버킷은 각 연결의 strand가 따로 가집니다.
+ */
+class NodeEgressShaper {
+public:
+    using Clock = common::TokenBucket::Clock;
+
+    void configure(uint64_t bytes_per_second) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        limited_.store(bytes_per_second != 0, std::memory_order_relaxed);
+        bucket_.configure(static_cast<double>(bytes_per_second), BandwidthLimits::burst_for(bytes_per_second));
+    }
+
+    void charge(size_t bytes, Clock::time_point now = Clock::now()) {
+        if (!limited_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        bucket_.consume(static_cast<double>(bytes), now);
+    }
+
+    /**
+     * @brief LOW 프레임용: 지금 보낼 수 있으면 차감하고 0, 아니면 기다릴 시간
+     */
+    Clock::duration acquire(size_t bytes, Clock::time_point now = Clock::now()) {
+        if (!limited_.load(std::memory_order_relaxed)) {
+            return Clock::duration::zero();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto wait = bucket_.time_until(static_cast<double>(bytes), now);
+        if (wait == Clock::duration::zero()) {
+            bucket_.consume(static_cast<double>(bytes), now);
+        }
+        return wait;
+    }
+
+    void record_deferred(size_t bytes) noexcept {
+        deferred_frames_.fetch_add(1, std::memory_order_relaxed);
+        deferred_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    EgressStats get_stats() const noexcept {
+        EgressStats stats;
+        stats.deferred_frames = deferred_frames_.load(std::memory_order_relaxed);
+        stats.deferred_bytes = deferred_bytes_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    std::mutex mutex_;
+    common::TokenBucket bucket_;
+    std::atomic<bool> limited_{false};   // 한도가 없으면 잠금 없이 통과
+    std::atomic<uint64_t> deferred_frames_{0};
+    std::atomic<uint64_t> deferred_bytes_{0};
+};
+
+} // namespace mmorpg::network
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+namespace mmorpg::network {
+
+/**
+ * @brief 수신 검증에서 프레임을 거부한 이유
+ */
+enum class FrameRejection {
+    TOO_LARGE,            // 상태별 최대 메시지 크기 초과 (Beast가 버퍼를 키우기 전에 읽기 실패)
+    OPCODE_NOT_ALLOWED,   // 현재 상태에서 허용하지 않는 opcode 또는 텍스트 프레임
+    RATE_LIMITED          // 연결별 메시지 토큰 버킷 소진
+};
+
+inline constexpr size_t kFrameRejectionCount = 3;
+
+inline const char* to_string(FrameRejection rejection) noexcept {
+    switch (rejection) {
+        case FrameRejection::TOO_LARGE:          return "too_large";
+        case FrameRejection::OPCODE_NOT_ALLOWED: return "opcode_not_allowed";
+        case FrameRejection::RATE_LIMITED:       return "rate_limited";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief 이유별 누적 거부 수
+ */
+using FrameRejectionCounts = std::array<uint64_t, kFrameRejectionCount>;
+
+/**
+ * @brief 연결 상태별 수신 프레임 허용 규칙 (게시 후 변경하지 않음)
+ *
+ * 검증은 프레임을 읽은 직후 디코드와 핸들러 호출 전에 이루어지고, 위반한 연결은 끊깁니다.
+ * opcode 목록이 비어 있으면 그 상태에서는 모든 opcode를 허용합니다. 2바이트보다 짧은
+ * 바이너리 프레임은 opcode를 읽을 수 없으므로 그대로 넘겨 디코드 단계에서 거부합니다.
+ */
+struct FramePolicy {
+    size_t max_frame_pre_auth = 64 * 1024;        // 인증 전 최대 메시지 크기 (바이트)
+    size_t max_frame_authenticated = 64 * 1024;   // 인증 후 최대 메시지 크기
+    uint32_t messages_per_second = 0;             // 연결당 초당 메시지 수 (0 = 제한 없음)
+    uint32_t message_burst = 0;                   // 토큰 버킷 크기
+    bool text_pre_auth = true;                    // 인증 전 텍스트(JSON) 프레임 허용
+    bool text_authenticated = true;
+
+    void allow_pre_auth(std::initializer_list<uint16_t> opcodes) {
+        for (const uint16_t opcode : opcodes) {
+            pre_auth_opcodes_.set(opcode);
+        }
+    }
+
+    void allow_authenticated(std::initializer_list<uint16_t> opcodes) {
+        for (const uint16_t opcode : opcodes) {
+            authenticated_opcodes_.set(opcode);
+        }
+    }
+
+    size_t max_frame(bool authenticated) const noexcept {
+        return authenticated ? max_frame_authenticated : max_frame_pre_auth;
+    }
+
+    /**
+     * @brief 현재 상태에서 프레임 종류/opcode 허용 여부
+     */
+    bool allows(std::string_view frame, bool is_binary, bool authenticated) const noexcept {
+        if (!is_binary) {
+            return authenticated ? text_authenticated : text_pre_auth;
+        }
+        if (frame.size() < 2) {
+            return true;
+        }
+        const auto& opcodes = authenticated ? authenticated_opcodes_ : pre_auth_opcodes_;
+        if (opcodes.none()) {
+            return true;
+        }
+        const uint16_t opcode = static_cast<uint16_t>(
+            static_cast<uint8_t>(frame[0]) | (static_cast<uint8_t>(frame[1]) << 8));
+        return opcodes.test(opcode);
+    }
+
+private:
+    std::bitset<65536> pre_auth_opcodes_;
+    std::bitset<65536> authenticated_opcodes_;
+};
+
+/**
+ * @brief 핸들러 전체의 이유별 거부 카운터 (I/O 스레드에서 relaxed 증가)
+ */
+class FrameRejectionStats {
+public:
+    void record(FrameRejection rejection) noexcept {
+        counts_[static_cast<size_t>(rejection)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    FrameRejectionCounts snapshot() const noexcept {
+        FrameRejectionCounts counts{};
+        for (size_t i = 0; i < kFrameRejectionCount; ++i) {
+            counts[i] = counts_[i].load(std::memory_order_relaxed);
+        }
+        return counts;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kFrameRejectionCount> counts_{};
+};
+
+} // namespace mmorpg::network
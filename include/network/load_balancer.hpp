@@ -7,6 +7,7 @@
 #include <mutex>
 #include <chrono>
 #include <memory>
+#include <thread>
 
 namespace mmorpg::network {
 
@@ -24,6 +25,21 @@ struct ServerNode {
     std::atomic<bool> is_healthy{true};
     std::chrono::time_point<std::chrono::steady_clock> last_health_check;
     
+    ServerNode() = default;
+    
+    // 조회용 복사 (get_all_servers) - 원자 변수는 현재 값으로 복사
+    ServerNode(const ServerNode& other)
+        : id(other.id)
+        , host(other.host)
+        , port(other.port)
+        , current_connections(other.current_connections.load())
+        , max_connections(other.max_connections.load())
+        , cpu_usage(other.cpu_usage.load())
+        , memory_usage(other.memory_usage.load())
+        , is_healthy(other.is_healthy.load())
+        , last_health_check(other.last_health_check) {
+    }
+    
     // 부하 점수 계산
     double get_load_score() const {
         double connection_ratio = static_cast<double>(current_connections.load()) / max_connections.load();
@@ -81,11 +97,25 @@ public:
      */
     void remove_server(const std::string& id);
     
+    /**
+     * @brief 서버 노드 등록 여부
+     */
+    bool has_server(const std::string& id) const;
+    
     /**
      * @brief 최적 서버 선택
      */
     std::string select_server(const std::string& client_ip = "");
     
+    /**
+     * @brief 연결 count개를 나눠 받을 서버 목록 (노드 종료 드레인용)
+     *
+     * exclude_id를 뺀 헬시 서버에 남은 수용량(max - current)에 비례해 배정하고, 같은 서버가
+     * 몰려 나오지 않도록 smooth weighted round robin 순서로 섞어 돌려줍니다.
+     * @return 길이 count의 서버 ID 목록 (받을 서버가 없으면 빈 목록)
+     */
+    std::vector<std::string> select_servers(size_t count, const std::string& exclude_id = "");
+    
     /**
      * @brief 연결 할당
      */
@@ -101,6 +131,12 @@ public:
      */
     void update_server_status(const std::string& server_id, double cpu_usage, double memory_usage, bool is_healthy);
     
+    /**
+     * @brief 노드가 직접 보고한 부하로 서버 상태 업데이트 (멤버십 가십용, 연결 수 포함)
+     */
+    void update_server_load(const std::string& server_id, double cpu_usage, double memory_usage,
+                            uint32_t current_connections, bool is_healthy);
+    
     /**
      * @brief 서버 정보 조회
      */
@@ -118,8 +154,10 @@ public:
     
     /**
      * @brief 헬스 체크 시작
+     * @param stale_after 마지막 상태 업데이트 후 이 시간이 지나면 비헬시로 표시
      */
-    void start_health_check(std::chrono::seconds interval = std::chrono::seconds(30));
+    void start_health_check(std::chrono::seconds interval = std::chrono::seconds(30),
+                            std::chrono::seconds stale_after = std::chrono::minutes(5));
 
 private:
     void perform_health_check();
@@ -138,6 +176,7 @@ private:
     
     std::thread health_check_thread_;
     std::chrono::seconds health_check_interval_{30};
+    std::chrono::seconds health_check_stale_after_{300};
     
     // 연결 추적
     std::unordered_map<std::string, std::string> connection_to_server_;
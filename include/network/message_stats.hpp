@@ -0,0 +1,109 @@
+#pragma once
+
+#include "common/metrics.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace mmorpg::network {
+
+/**
+ * @brief 메시지 방향
+ */
+enum class MessageDirection {
+    INBOUND,
+    OUTBOUND
+};
+
+/**
+ * @brief opcode 하나에 대한 누적 통계 스냅샷
+ */
+struct OpcodeStatsSnapshot {
+    uint16_t slot = 0;
+    uint64_t inbound_count = 0;
+    uint64_t inbound_bytes = 0;
+    uint64_t outbound_count = 0;
+    uint64_t outbound_bytes = 0;
+    mmorpg::common::HistogramSnapshot handler_latency;
+};
+
+/**
+ * @brief 메시지 타입(opcode)별 처리량/지연 시간 통계
+ *
+ * 바이너리 프레임은 앞 2바이트(little-endian)를 opcode로 봅니다.
+ * 텍스트 프레임과 추적 범위를 벗어난 opcode는 별도 슬롯에 모읍니다.
+ * 모든 카운터는 relaxed 원자 연산이라 I/O 스레드에서 잠금 없이 기록합니다.
+ */
+class MessageStats {
+public:
+    static constexpr size_t kSlots = 256;
+    static constexpr uint16_t kTextSlot = kSlots - 2;
+    static constexpr uint16_t kOtherSlot = kSlots - 1;
+
+    /**
+     * @brief 프레임에서 통계 슬롯 결정
+     */
+    static uint16_t classify(std::string_view payload, bool is_binary) noexcept {
+        if (!is_binary) {
+            return kTextSlot;
+        }
+        if (payload.size() < 2) {
+            return kOtherSlot;
+        }
+        const uint16_t opcode = static_cast<uint16_t>(
+            static_cast<uint8_t>(payload[0]) | (static_cast<uint8_t>(payload[1]) << 8));
+        return opcode < kTextSlot ? opcode : kOtherSlot;
+    }
+
+    /**
+     * @brief 슬롯 이름 (Prometheus 라벨용)
+     */
+    static std::string slot_name(uint16_t slot);
+
+    void record_inbound(uint16_t slot, size_t bytes, uint64_t handler_ns) noexcept {
+        auto& counters = slots_[slot];
+        counters.inbound_count.fetch_add(1, std::memory_order_relaxed);
+        counters.inbound_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        counters.handler_latency.record(handler_ns);
+    }
+
+    void record_outbound(uint16_t slot, size_t bytes) noexcept {
+        auto& counters = slots_[slot];
+        counters.outbound_count.fetch_add(1, std::memory_order_relaxed);
+        counters.outbound_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 전체 슬롯 스냅샷
+     */
+    std::array<OpcodeStatsSnapshot, kSlots> snapshot() const;
+
+private:
+    struct alignas(64) SlotCounters {
+        std::atomic<uint64_t> inbound_count{0};
+        std::atomic<uint64_t> inbound_bytes{0};
+        std::atomic<uint64_t> outbound_count{0};
+        std::atomic<uint64_t> outbound_bytes{0};
+        mmorpg::common::LatencyHistogram handler_latency;
+    };
+
+    std::array<SlotCounters, kSlots> slots_;
+};
+
+/**
+ * @brief 연결 하나의 누적 트래픽
+ */
+struct ConnectionTraffic {
+    std::string connection_id;
+    uint64_t messages_in = 0;
+    uint64_t bytes_in = 0;
+    uint64_t messages_out = 0;
+    uint64_t bytes_out = 0;
+    uint32_t pending_writes = 0;
+    uint32_t rtt_us = 0;          // 평활 RTT (핑 응답을 받기 전에는 0)
+    uint32_t rtt_jitter_us = 0;
+};
+
+} // namespace mmorpg::network
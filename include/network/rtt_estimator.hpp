@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace mmorpg::network {
+
+/**
+ * @brief RTT 추정값 스냅샷 (마이크로초)
+ */
+struct RttSnapshot {
+    uint32_t last_us = 0;       // 가장 최근 표본
+    uint32_t smoothed_us = 0;   // 평활 RTT (SRTT)
+    uint32_t jitter_us = 0;     // 평균 편차 (RTTVAR)
+    uint64_t samples = 0;
+};
+
+/**
+ * @brief 연결별 RTT 추정 (RFC 6298 방식)
+ *
+ * 첫 표본 R은 SRTT = R, RTTVAR = R/2로 시작하고 이후
+ * RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, SRTT = 7/8 SRTT + 1/8 R로 갱신합니다.
+ * 기록은 연결 strand 한 곳에서만 하고 읽기는 어느 스레드에서나 relaxed로 합니다.
+ */
+class RttEstimator {
+public:
+    void record(std::chrono::microseconds sample) noexcept {
+        const uint32_t rtt = static_cast<uint32_t>(
+            std::clamp<int64_t>(sample.count(), 0, INT32_MAX));
+        const uint64_t samples = samples_.load(std::memory_order_relaxed);
+
+        uint32_t smoothed = rtt;
+        uint32_t jitter = rtt / 2;
+        if (samples != 0) {
+            const uint32_t previous = smoothed_us_.load(std::memory_order_relaxed);
+            const uint32_t deviation = previous > rtt ? previous - rtt : rtt - previous;
+            jitter = static_cast<uint32_t>(
+                (uint64_t{3} * jitter_us_.load(std::memory_order_relaxed) + deviation) / 4);
+            smoothed = static_cast<uint32_t>((uint64_t{7} * previous + rtt) / 8);
+        }
+
+        last_us_.store(rtt, std::memory_order_relaxed);
+        smoothed_us_.store(smoothed, std::memory_order_relaxed);
+        jitter_us_.store(jitter, std::memory_order_relaxed);
+        samples_.store(samples + 1, std::memory_order_relaxed);
+    }
+
+    RttSnapshot snapshot() const noexcept {
+        RttSnapshot snapshot;
+        snapshot.last_us = last_us_.load(std::memory_order_relaxed);
+        snapshot.smoothed_us = smoothed_us_.load(std::memory_order_relaxed);
+        snapshot.jitter_us = jitter_us_.load(std::memory_order_relaxed);
+        snapshot.samples = samples_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+private:
+    std::atomic<uint32_t> last_us_{0};
+    std::atomic<uint32_t> smoothed_us_{0};
+    std::atomic<uint32_t> jitter_us_{0};
+    std::atomic<uint64_t> samples_{0};
+};
+
+} // namespace mmorpg::network
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mmorpg::network {
+
+/**
+ * @brief 연결의 핸드셰이크/읽기 루프 구동 방식
+ */
+enum class SessionMode : uint8_t {
+    CALLBACK_CHAIN,   // 완료 핸들러 체인 (perform_handshake -> on_handshake -> start_reading -> on_read)
+    COROUTINE         // 연결마다 net::awaitable 코루틴 하나 (WebSocketConnection::run_session)
+};
+
+inline const char* to_string(SessionMode mode) noexcept {
+    return mode == SessionMode::COROUTINE ? "coroutine" : "callback";
+}
+
+} // namespace mmorpg::network
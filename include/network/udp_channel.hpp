@@ -0,0 +1,231 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace mmorpg::network {
+
+enum class UdpPacketType : uint8_t {
+    BIND = 1,       // 클라이언트 -> 서버: 토큰으로 이 엔드포인트를 세션에 묶음
+    BIND_ACK = 2,   // 서버 -> 클라이언트: 바인드 완료
+    DATA = 3,       // 양방향: 프로토콜 프레임 하나
+    ACK = 4         // 양방향: 신뢰 DATA 수신 확인 (sequence = 확인한 번호)
+};
+
+inline const char* to_string(UdpPacketType type) noexcept {
+    switch (type) {
+        case UdpPacketType::BIND:     return "bind";
+        case UdpPacketType::BIND_ACK: return "bind_ack";
+        case UdpPacketType::DATA:     return "data";
+        case UdpPacketType::ACK:      return "ack";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief UDP 패킷 헤더 (16바이트, little-endian)
+ *
+ * [u64 token][u8 type][u8 flags][u16 lane][u32 sequence] 뒤에 페이로드(프로토콜 프레임)가 붙습니다.
+ * 신뢰/비신뢰 DATA는 서로 다른 sequence 공간을 씁니다.
+ */
+struct UdpPacketHeader {
+    static constexpr size_t kSize = 16;
+    static constexpr uint8_t kReliable = 0x01;
+
+    uint64_t token = 0;
+    UdpPacketType type = UdpPacketType::DATA;
+    uint8_t flags = 0;
+    uint16_t lane = 0;
+    uint32_t sequence = 0;
+
+    bool reliable() const noexcept {
+        return (flags & kReliable) != 0;
+    }
+
+    void encode(char* out) const noexcept;
+
+    /**
+     * @return 헤더보다 짧거나 type이 알 수 없는 값이면 nullopt
+     */
+    static std::optional<UdpPacketHeader> decode(std::string_view packet) noexcept;
+};
+
+/**
+ * @brief 직렬 번호 비교 (RFC 1982, 2^31 이내 차이에서 wraparound 안전)
+ */
+inline bool sequence_newer(uint32_t a, uint32_t b) noexcept {
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+struct UdpChannelOptions {
+    std::string bind_address = "0.0.0.0:0";                // UDP host:port (포트 0이면 커널 할당)
+    std::chrono::milliseconds resend_interval{50};        // 신뢰 DATA 재전송 간격
+    uint32_t max_resends = 10;                            // 이후 포기 (상위 계층이 WebSocket으로 대체)
+    double loss_rate = 0.0;                               // 시험용 손실 시뮬레이션 (송수신 각각 이 확률로 버림)
+    uint32_t loss_seed = 0;                               // 손실 시뮬레이션 시드 (0이면 무작위)
+};
+
+struct UdpChannelStats {
+    uint64_t packets_sent = 0;
+    uint64_t packets_received = 0;
+    uint64_t delivered = 0;              // 수신 핸들러에 넘긴 DATA
+    uint64_t stale_dropped = 0;          // 같은 lane의 더 새 비신뢰 DATA를 이미 받음
+    uint64_t duplicates_dropped = 0;     // 이미 받은 신뢰 DATA
+    uint64_t rejected = 0;               // 토큰/엔드포인트 불일치, 형식 오류
+    uint64_t resends = 0;
+    uint64_t reliable_expired = 0;       // max_resends 동안 ACK가 없어 포기
+    uint64_t simulated_losses = 0;
+};
+
+/**
+ * @brief 인증된 WebSocket 세션에 묶이는 보조 UDP 채널
+ *
+ * 이동 입력과 스냅샷처럼 최신 값만 의미 있는 고빈도 메시지를 TCP의 head-of-line blocking 없이
+ * 보냅니다. WebSocket은 제어 채널로 남습니다: 인증 후 서버가 open_session()으로 토큰을 만들어
+ * WebSocket으로 알리고(UdpOffer), 클라이언트는 그 토큰을 담은 BIND를 UDP로 보내 엔드포인트를
+ * 묶습니다. 이후 DATA는 토큰과 바인드된 엔드포인트가 모두 맞아야 받아들입니다.
+ *
+ * 비신뢰 DATA는 lane별 latest-wins입니다: 같은 lane에서 이미 받은 것보다 오래된 sequence는
+ * 버립니다. 신뢰 플래그를 단 DATA는 순서와 관계없이 한 번씩 전달되며(64개 창으로 중복 제거),
+ * 수신 즉시 ACK를 보내고 송신 측은 ACK가 올 때까지 resend_interval마다 재전송합니다.
+ *
+ * 수신과 재전송은 전용 스레드 하나에서 처리하며 수신 핸들러도 그 스레드에서 호출됩니다.
+ * send/open_session/close_session은 어느 스레드에서나 호출할 수 있습니다.
+ */
+class UdpChannel {
+public:
+    // 헤더 포함 데이터그램 최대 크기 (단편화 방지)
+    static constexpr size_t kMaxDatagramSize = 1400;
+    static constexpr size_t kMaxPayloadSize = kMaxDatagramSize - UdpPacketHeader::kSize;
+
+    /**
+     * @brief 수신 DATA (payload는 호출 동안만 유효)
+     */
+    using ReceiveHandler = std::function<void(const std::string& connection_id, uint16_t lane,
+                                              std::string_view payload)>;
+
+    explicit UdpChannel(UdpChannelOptions options = {});
+    ~UdpChannel();
+
+    UdpChannel(const UdpChannel&) = delete;
+    UdpChannel& operator=(const UdpChannel&) = delete;
+
+    /**
+     * @brief 수신 핸들러 설정 (start 이전에 호출)
+     */
+    void set_receive_handler(ReceiveHandler handler);
+
+    bool start();
+    void stop();
+
+    uint16_t get_port() const noexcept {
+        return bound_port_;
+    }
+
+    /**
+     * @brief 인증된 연결의 세션 생성 (이미 있으면 새 토큰으로 교체, 바인드 해제)
+     * @return 클라이언트가 BIND에 담아 보낼 토큰
+     */
+    uint64_t open_session(const std::string& connection_id);
+
+    /**
+     * @brief 세션 제거 (연결 해제 시, 재전송 대기 중인 DATA도 버림)
+     */
+    void close_session(const std::string& connection_id);
+
+    /**
+     * @brief 클라이언트가 BIND를 마쳐 UDP로 보낼 수 있는지
+     */
+    bool is_bound(const std::string& connection_id) const;
+
+    /**
+     * @brief 바인드된 세션에 DATA 전송
+     * @return 세션이 없거나 아직 바인드 전이거나 payload가 kMaxPayloadSize를 넘으면 false
+     */
+    bool send(const std::string& connection_id, uint16_t lane, std::string_view payload, bool reliable = false);
+
+    size_t get_session_count() const;
+
+    UdpChannelStats get_stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using udp = boost::asio::ip::udp;
+
+    struct PendingReliable {
+        uint32_t sequence = 0;
+        std::string packet;
+        Clock::time_point sent_at;
+        uint32_t resends = 0;
+    };
+
+    struct Session {
+        std::string connection_id;
+        uint64_t token = 0;
+        std::optional<udp::endpoint> endpoint;
+        uint32_t next_sequence = 1;
+        uint32_t next_reliable_sequence = 1;
+        std::unordered_map<uint16_t, uint32_t> latest_by_lane;   // 수신한 비신뢰 DATA의 최신 sequence
+        uint32_t reliable_highest = 0;                           // 수신한 신뢰 DATA의 최대 sequence
+        uint64_t reliable_window = 0;                            // bit i = reliable_highest - i 수신함
+        std::deque<PendingReliable> pending;                     // ACK 대기 중인 신뢰 DATA
+    };
+
+    void start_receive();
+    void on_receive(size_t bytes);
+    void schedule_resend();
+    void on_resend_timer();
+
+    /**
+     * @brief 신뢰 DATA 중복 검사 후 수신 창 갱신 (sessions_mutex_ 보유)
+     */
+    static bool accept_reliable(Session& session, uint32_t sequence);
+
+    void send_packet(std::string_view packet, const udp::endpoint& to);
+    bool simulate_loss();
+
+    std::optional<udp::endpoint> resolve(const std::string& address);
+
+    UdpChannelOptions options_;
+    uint16_t bound_port_ = 0;
+    ReceiveHandler receive_handler_;
+
+    boost::asio::io_context io_context_;
+    udp::socket socket_;
+    boost::asio::steady_timer resend_timer_;
+    std::thread thread_;
+    std::array<char, 65536> receive_buffer_{};
+    udp::endpoint receive_from_;
+
+    mutable std::mutex sessions_mutex_;
+    std::unordered_map<std::string, Session> sessions_;       // connection_id -> 세션
+    std::unordered_map<uint64_t, std::string> tokens_;        // token -> connection_id
+    std::mt19937_64 token_random_;
+
+    std::mutex loss_mutex_;
+    std::mt19937 loss_random_;
+
+    std::atomic<uint64_t> packets_sent_{0};
+    std::atomic<uint64_t> packets_received_{0};
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> stale_dropped_{0};
+    std::atomic<uint64_t> duplicates_dropped_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> resends_{0};
+    std::atomic<uint64_t> reliable_expired_{0};
+    std::atomic<uint64_t> simulated_losses_{0};
+};
+
+} // namespace mmorpg::network
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace mmorpg::network {
+
+/**
+ * @brief WebSocketHandler 콜백 묶음 (게시 후 변경하지 않음)
+ *
+ * 핸들러 교체는 현재 묶음을 복사해 한 항목만 바꾼 새 묶음을 게시하는 방식입니다 (read-copy-update).
+ * 연결은 게시된 묶음의 shared_ptr을 strand에서만 들고 있으므로 수신 경로는 잠금이나 원자 연산 없이
+ * on_message를 한 번 간접 호출합니다. 옛 묶음은 마지막 연결이 새 묶음으로 바꾸면 해제됩니다.
+ */
+struct WebSocketDispatch {
+    /**
+     * @brief 수신 메시지 핸들러 (연결 ID, 메시지 뷰, 바이너리 여부)
+     *
+     * 연결 strand에서 호출됩니다. 메시지 뷰는 수신 버퍼를 직접 가리키므로 핸들러가 반환되면
+     * 무효가 되고, 보관이 필요하면 핸들러 안에서 복사해야 합니다.
+     *
+     * 텍스트 프레임은 message.data()[message.size()]가 NUL이며, 핸들러는 반환 전까지
+     * 이 버퍼를 제자리에서 수정할 수 있습니다 (JSON in-situ 파싱용).
+     */
+    using MessageHandler = std::function<void(const std::string&, std::string_view, bool)>;
+    using ConnectionHandler = std::function<void(const std::string&)>;
+
+    MessageHandler on_message;
+    ConnectionHandler on_connection;
+    ConnectionHandler on_disconnection;
+};
+
+} // namespace mmorpg::network
@@ -1,13 +1,28 @@
 #pragma once
 
+#include "common/concurrent_hash_map.hpp"
+#include "common/memory_accounting.hpp"
+#include "common/session_handoff.hpp"
+#include "common/token_bucket.hpp"
+#include "network/egress_shaper.hpp"
+#include "network/frame_policy.hpp"
+#include "network/message_stats.hpp"
+#include "network/rtt_estimator.hpp"
+#include "network/session_mode.hpp"
+#include "network/websocket_dispatch.hpp"
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <deque>
 #include <memory>
-#include <unordered_map>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace mmorpg::network {
 
@@ -19,13 +34,22 @@ using tcp = boost::asio::ip::tcp;
 
 /**
  * @brief WebSocket 연결을 나타내는 클래스
+ *
+ * 소켓은 strand 실행기에서 생성되며 모든 비동기 작업과 쓰기 큐 조작은
+ * 그 strand에서만 실행됩니다. send_message()/close()는 어느 스레드에서
+ * 호출해도 strand로 post되므로 Beast 스트림에 동시에 접근하지 않습니다.
  */
-class WebSocketConnection {
+class WebSocketConnection : public std::enable_shared_from_this<WebSocketConnection> {
 public:
     using Ptr = std::shared_ptr<WebSocketConnection>;
     
+    /**
+     * @brief 분리된 송신 큐를 받는 콜백 (strand에서 호출)
+     */
+    using DetachCallback = std::function<void(std::vector<common::PendingFrame>)>;
+    
     WebSocketConnection(tcp::socket socket, const std::string& connection_id);
-    ~WebSocketConnection() = default;
+    ~WebSocketConnection();
     
     // 복사 및 이동 방지
     WebSocketConnection(const WebSocketConnection&) = delete;
@@ -34,9 +58,12 @@ public:
     WebSocketConnection& operator=(WebSocketConnection&&) = delete;
     
     /**
-     * @brief WebSocket 핸드셰이크 수행
+     * @brief WebSocket 핸드셰이크 수행 후 읽기 루프 시작
+     *
+     * COROUTINE이면 연결 strand에서 run_session()을 co_spawn합니다. 코루틴 프레임은 연결마다
+     * 한 번 할당되고 이후 읽기마다 완료 핸들러를 만들지 않습니다. 송신 경로는 두 방식이 같습니다.
      */
-    void perform_handshake();
+    void perform_handshake(SessionMode mode = SessionMode::CALLBACK_CHAIN);
     
     /**
      * @brief 메시지 읽기 시작
@@ -44,15 +71,45 @@ public:
     void start_reading();
     
     /**
-     * @brief 메시지 전송
+     * @brief 메시지 전송 (쓰기 큐에 추가)
+     * @param binary true면 바이너리 프레임, false면 텍스트 프레임
+     * @param priority LOW면 대역폭 한도를 넘을 때 NORMAL 프레임 뒤로 미룸
      */
-    void send_message(const std::string& message);
+    void send_message(const std::string& message, bool binary = false,
+                      SendPriority priority = SendPriority::NORMAL);
     
     /**
-     * @brief 연결 종료
+     * @brief 공유 버퍼 메시지 전송 (브로드캐스트 시 연결마다 복사하지 않음)
+     */
+    void send_message(std::shared_ptr<const std::string> message, bool binary = false,
+                      SendPriority priority = SendPriority::NORMAL);
+    
+    /**
+     * @brief 연결 종료 (여러 번 호출해도 종료 핸들러는 한 번만 호출됨)
      */
     void close();
     
+    /**
+     * @brief close 핸드셰이크 없이 소켓을 즉시 닫음 (응답 없는 상대 정리용)
+     */
+    void abort();
+    
+    /**
+     * @brief 세션 이전: 아직 쓰기 시작하지 않은 송신 큐를 떼어 내고 마지막 프레임을 보낸 뒤 종료
+     *
+     * 쓰기 중인 프레임 하나는 그대로 전송되고, 나머지는 on_detached로 넘어갑니다.
+     * 이후 send_message()로 들어온 프레임은 버려집니다.
+     */
+    void detach(std::shared_ptr<const std::string> final_frame, bool binary, DetachCallback on_detached);
+    
+    /**
+     * @brief 노드 종료 드레인: 송신 큐를 모두 보내고 마지막 프레임을 보낸 뒤 going_away로 종료
+     *
+     * detach()와 달리 큐를 떼어 내지 않고 이 연결로 끝까지 보냅니다.
+     * 이후 send_message()로 들어온 프레임은 버려집니다.
+     */
+    void drain(std::shared_ptr<const std::string> final_frame, bool binary);
+    
     /**
      * @brief 연결 ID 반환
      */
@@ -64,30 +121,159 @@ public:
     bool is_connected() const;
     
     /**
-     * @brief 메시지 핸들러 설정
+     * @brief 수신 메시지를 넘길 콜백 묶음 설정 (핸드셰이크 전에 한 번, 이후는 update_dispatch)
+     */
+    void set_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch);
+    
+    /**
+     * @brief 새로 게시된 콜백 묶음 적용 (strand로 post, 이후 수신 메시지부터 새 묶음으로 전달)
      */
-    void set_message_handler(std::function<void(const std::string&)> handler);
+    void update_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch);
     
     /**
      * @brief 연결 종료 핸들러 설정
      */
     void set_close_handler(std::function<void()> handler);
+    
+    /**
+     * @brief 메시지 타입별 통계 수집기 설정
+     */
+    void set_message_stats(MessageStats* stats);
+    
+    /**
+     * @brief 메모리 계정 설정 (핸드셰이크 전에 한 번, 계정은 연결보다 오래 살아야 함)
+     *
+     * 연결 객체 크기는 connections에, 수신 버퍼 용량과 송신 대기 프레임 바이트는 buffers에 기록합니다.
+     * 브로드캐스트 공유 버퍼도 연결마다 기록하므로 buffers는 연결들이 붙잡고 있는 양의 상한입니다.
+     */
+    void set_memory_accounts(common::MemoryAccount* connections, common::MemoryAccount* buffers);
+    
+    /**
+     * @brief 수신 검증 규칙과 거부 카운터 설정 (핸드셰이크 전에 한 번, 이후는 update_frame_policy)
+     */
+    void set_frame_policy(std::shared_ptr<const FramePolicy> policy, FrameRejectionStats* stats);
+    
+    /**
+     * @brief 새로 게시된 규칙 적용 (strand로 post, 쌓인 토큰은 유지)
+     */
+    void update_frame_policy(std::shared_ptr<const FramePolicy> policy);
+    
+    /**
+     * @brief 인증 상태 변경 (strand로 post) - 이후 프레임은 그 상태의 크기/opcode 규칙으로 검증
+     */
+    void set_authenticated(bool authenticated);
+    
+    /**
+     * @brief RTT 표본을 함께 기록할 노드 전체 히스토그램 설정 (핸드셰이크 전에 한 번)
+     */
+    void set_rtt_histogram(common::LatencyHistogram* histogram);
+    
+    /**
+     * @brief 노드 전체 송신 버킷 설정 (핸드셰이크 전에 한 번, 셰이퍼는 연결보다 오래 살아야 함)
+     */
+    void set_egress_shaper(NodeEgressShaper* shaper);
+    
+    /**
+     * @brief 연결별 송신 한도 변경 (strand로 post, 0이면 제한 없음)
+     */
+    void set_bandwidth_limit(uint64_t bytes_per_second);
+    
+    /**
+     * @brief RTT 측정용 핑 전송 (strand로 post)
+     *
+     * 페이로드는 보낸 시각(steady_clock ns)이고, 같은 페이로드의 퐁이 오면 표본 하나를 기록합니다.
+     * 이전 핑에 응답이 없으면 그 핑은 버리고 새 핑으로 대체합니다.
+     */
+    void send_ping();
+    
+    /**
+     * @brief RTT 추정값 (어느 스레드에서나 호출 가능)
+     */
+    RttSnapshot get_rtt() const;
+    
+    /**
+     * @brief 누적 트래픽 및 대기 중인 쓰기 수 반환
+     */
+    ConnectionTraffic get_traffic() const;
 
 private:
     void on_handshake(beast::error_code ec);
     void on_read(beast::error_code ec, std::size_t bytes_transferred);
     void on_write(beast::error_code ec, std::size_t bytes_transferred);
     void on_close(beast::error_code ec);
+    void on_pong(std::string_view payload);
+    
+    net::awaitable<void> run_session();
+    bool complete_handshake(beast::error_code ec);
+    bool complete_read(beast::error_code ec, std::size_t bytes_transferred);
+    
+    void do_ping();
+    void do_send(std::shared_ptr<const std::string> message, bool binary, SendPriority priority);
+    void do_close(websocket::close_code code = websocket::close_code::normal);
+    void do_detach(std::shared_ptr<const std::string> final_frame, bool binary, DetachCallback on_detached);
+    void do_drain(std::shared_ptr<const std::string> final_frame, bool binary);
+    void write_next();
+    void wait_for_bandwidth(common::TokenBucket::Clock::duration wait, size_t bytes);
+    void notify_closed();
+    void release_queued(size_t bytes);
+    void track_read_buffer();
+    void apply_frame_policy();
+    void reject_frame(FrameRejection rejection);
+    
+    // 느린 수신자 보호: 두 송신 큐 길이의 합이 이 값을 넘으면 연결을 끊음
+    static constexpr size_t kMaxPendingWrites = 4096;
     
     std::string connection_id_;
     websocket::stream<tcp::socket> ws_;
     beast::flat_buffer buffer_;
     std::atomic<bool> connected_{false};
+    std::atomic<bool> closed_{false};
+    
+    struct OutboundFrame {
+        std::shared_ptr<const std::string> payload;
+        bool binary = false;
+    };
+    
+    // strand에서만 접근 - 쓰기 중인 프레임은 writing_deferred_가 가리키는 큐의 맨 앞
+    std::deque<OutboundFrame> write_queue_;
+    std::deque<OutboundFrame> deferred_queue_;   // LOW 프레임 (write_queue_가 비었을 때만 전송)
+    bool writing_ = false;
+    bool writing_deferred_ = false;
+    bool closing_ = false;
+    bool detached_ = false;   // 송신 큐를 비우면 종료
+    websocket::close_code flushed_close_code_ = websocket::close_code::normal;   // detached_ 종료 시 코드
     
-    std::function<void(const std::string&)> message_handler_;
+    std::shared_ptr<const WebSocketDispatch> dispatch_;   // strand에서만 접근
     std::function<void()> close_handler_;
     
-    mutable std::mutex mutex_;
+    MessageStats* message_stats_ = nullptr;
+    common::MemoryAccount* connection_account_ = nullptr;
+    common::MemoryAccount* buffer_account_ = nullptr;
+    size_t charged_read_capacity_ = 0;   // strand에서만 접근
+    
+    // 수신 검증 (strand에서만 접근)
+    std::shared_ptr<const FramePolicy> frame_policy_;
+    FrameRejectionStats* rejection_stats_ = nullptr;
+    common::TokenBucket message_bucket_;
+    bool authenticated_ = false;
+    
+    // RTT 측정 - ping_sent_ns_와 ping_writing_은 strand에서만 접근
+    RttEstimator rtt_;
+    common::LatencyHistogram* rtt_histogram_ = nullptr;
+    uint64_t ping_sent_ns_ = 0;   // 응답을 기다리는 핑의 페이로드 (0이면 없음)
+    bool ping_writing_ = false;   // Beast는 핑을 한 번에 하나만 보낼 수 있음
+    
+    // 송신 대역폭 셰이핑 (strand에서만 접근)
+    common::TokenBucket egress_bucket_;
+    NodeEgressShaper* egress_shaper_ = nullptr;
+    net::steady_timer shaping_timer_{ws_.get_executor()};
+    bool shaping_wait_ = false;   // 토큰을 기다리는 중 (타이머가 write_next를 다시 호출)
+    
+    std::atomic<uint64_t> messages_in_{0};
+    std::atomic<uint64_t> bytes_in_{0};
+    std::atomic<uint64_t> messages_out_{0};
+    std::atomic<uint64_t> bytes_out_{0};
+    std::atomic<uint32_t> pending_writes_{0};
 };
 
 /**
@@ -96,11 +282,30 @@ private:
 class WebSocketHandler {
 public:
     using ConnectionPtr = WebSocketConnection::Ptr;
-    using MessageHandler = std::function<void(const std::string&, const std::string&)>;
-    using ConnectionHandler = std::function<void(const std::string&)>;
+    // 메시지 뷰 수명과 텍스트 프레임 규칙은 WebSocketDispatch::MessageHandler 참고
+    using MessageHandler = WebSocketDispatch::MessageHandler;
+    using ConnectionHandler = WebSocketDispatch::ConnectionHandler;
     
-    explicit WebSocketHandler(uint16_t port = 8080);
-    ~WebSocketHandler() = default;
+    /**
+     * @param port 리스닝 포트 (0이면 커널이 할당)
+     * @param worker_threads I/O 스레드 수 (0이면 하드웨어 코어 수, 샤드마다 최소 1개)
+     */
+    explicit WebSocketHandler(uint16_t port = 8080, uint32_t worker_threads = 0);
+    ~WebSocketHandler();
+    
+    /**
+     * @brief 소켓 I/O 백엔드 이름 (ENABLE_IO_URING 빌드면 "io_uring", 아니면 "epoll")
+     *
+     * io_uring 백엔드에서는 읽기/쓰기가 링에 제출되고 Asio가 run 루프마다 모아서 제출하므로
+     * 연결 수가 많을 때 작업당 syscall이 epoll보다 적습니다. 코드 경로는 양쪽이 같습니다.
+     */
+    static constexpr const char* get_io_backend() noexcept {
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+        return "io_uring";
+#else
+        return "epoll";
+#endif
+    }
     
     /**
      * @brief 서버 시작
@@ -114,13 +319,44 @@ public:
     
     /**
      * @brief 특정 연결에 메시지 전송
+     * @param priority LOW면 대역폭 한도를 넘을 때 미룸 (WebSocketConnection::send_message)
      */
-    void send_to_connection(const std::string& connection_id, const std::string& message);
+    void send_to_connection(const std::string& connection_id, const std::string& message, bool binary = false,
+                            SendPriority priority = SendPriority::NORMAL);
     
     /**
      * @brief 모든 연결에 브로드캐스트
      */
-    void broadcast(const std::string& message);
+    void broadcast(const std::string& message, bool binary = false,
+                   SendPriority priority = SendPriority::NORMAL);
+    
+    /**
+     * @brief 연결을 다른 노드로 보냄 (WebSocketConnection::detach)
+     * @return 연결이 있으면 true (on_detached는 I/O 스레드에서 호출됨)
+     */
+    bool detach_connection(const std::string& connection_id, const std::string& final_frame, bool binary,
+                           WebSocketConnection::DetachCallback on_detached);
+    
+    /**
+     * @brief 송신 큐를 비운 뒤 마지막 프레임과 함께 연결을 닫음 (WebSocketConnection::drain)
+     * @return 연결이 있으면 true
+     */
+    bool drain_connection(const std::string& connection_id, const std::string& final_frame, bool binary);
+    
+    /**
+     * @brief 새 연결 수락만 중지 (기존 연결은 유지, 노드 종료 드레인용)
+     */
+    void stop_accepting();
+    
+    /**
+     * @brief 현재 연결 ID 목록
+     */
+    std::vector<std::string> get_connection_ids() const;
+    
+    /**
+     * @brief 실제로 바인드된 포트 반환 (포트 0으로 시작한 경우 커널이 할당한 포트)
+     */
+    uint16_t get_port() const;
     
     /**
      * @brief 연결 수 반환
@@ -133,39 +369,168 @@ public:
     bool has_connection(const std::string& connection_id) const;
     
     /**
-     * @brief 메시지 핸들러 설정
+     * @brief 콜백 묶음을 한 번에 교체 (실행 중에도 호출 가능)
+     *
+     * 새 묶음은 모든 연결의 strand로 게시되므로 각 연결은 옛 묶음이나 새 묶음 중 하나만 봅니다.
+     * 교체 직전에 읽은 메시지는 옛 핸들러로 전달될 수 있으므로 옛 핸들러가 참조하는 객체는
+     * 교체 후에도 잠시 살아 있어야 합니다.
+     */
+    void set_handlers(WebSocketDispatch handlers);
+    
+    /**
+     * @brief 메시지 핸들러만 교체 (현재 묶음을 복사해 게시, set_handlers 참고)
      */
     void set_message_handler(MessageHandler handler);
     
     /**
-     * @brief 연결 핸들러 설정
+     * @brief 연결 핸들러만 교체
      */
     void set_connection_handler(ConnectionHandler handler);
     
     /**
-     * @brief 연결 해제 핸들러 설정
+     * @brief 연결 해제 핸들러만 교체
      */
     void set_disconnection_handler(ConnectionHandler handler);
+    
+    /**
+     * @brief 연결 메모리를 기록할 계정 설정 (start 이전에 호출, nullptr이면 기록하지 않음)
+     */
+    void set_memory_accounts(common::MemoryAccount* connections, common::MemoryAccount* buffers);
+    
+    /**
+     * @brief 수신 검증 규칙 게시 (언제든 호출 가능, 기존 연결에도 적용)
+     *
+     * 기본 규칙은 FramePolicy 기본값입니다 (상태와 관계없이 64KB, opcode/속도 제한 없음).
+     */
+    void set_frame_policy(FramePolicy policy);
+    
+    /**
+     * @brief 연결의 인증 상태 변경 (수신 검증 규칙 선택용)
+     * @return 연결이 있으면 true
+     */
+    bool set_connection_authenticated(const std::string& connection_id, bool authenticated);
+    
+    /**
+     * @brief 이유별 누적 프레임 거부 수 (거부된 연결은 끊김)
+     */
+    FrameRejectionCounts get_frame_rejections() const;
+    
+    /**
+     * @brief 새 연결의 세션 구동 방식 (start 이전에 호출, 기본 CALLBACK_CHAIN)
+     */
+    void set_session_mode(SessionMode mode);
+    
+    SessionMode get_session_mode() const noexcept;
+    
+    /**
+     * @brief 모든 연결에 RTT 측정 핑을 보내는 주기 (start 이전에 호출, 0이면 보내지 않음)
+     *
+     * 연결마다 타이머를 두지 않고 핸들러의 타이머 하나가 주기마다 전체 연결에 핑을 post합니다.
+     */
+    void set_ping_interval(std::chrono::milliseconds interval);
+    
+    /**
+     * @brief 연결의 RTT 추정값 (연결이 없으면 nullopt)
+     */
+    std::optional<RttSnapshot> get_connection_rtt(const std::string& connection_id) const;
+    
+    /**
+     * @brief 이 노드 전체 연결의 누적 RTT 분포
+     */
+    common::HistogramSnapshot get_rtt_histogram() const;
+    
+    /**
+     * @brief 연결별/노드 전체 송신 한도 변경 (언제든 호출 가능, 기존 연결에도 적용)
+     *
+     * NORMAL 프레임은 한도를 넘어도 바로 나가고 그 양만큼 LOW 프레임이 늦게 나갑니다.
+     */
+    void set_bandwidth_limits(const BandwidthLimits& limits);
+    
+    /**
+     * @brief 한도 때문에 미룬 LOW 프레임 누적 통계
+     */
+    EgressStats get_egress_stats() const;
+    
+    /**
+     * @brief 연결 하나의 누적 트래픽 (연결이 없으면 nullopt)
+     */
+    std::optional<ConnectionTraffic> get_connection_traffic(const std::string& connection_id) const;
+    
+    /**
+     * @brief 메시지 타입별 통계 반환
+     */
+    const MessageStats& get_message_stats() const;
+    
+    /**
+     * @brief 연결별 누적 트래픽 수집 (모니터링용)
+     */
+    std::vector<ConnectionTraffic> collect_connection_traffic() const;
+    
+    /**
+     * @brief 전체 연결의 대기 중인 쓰기 수 합계
+     */
+    size_t get_outbound_queue_depth() const;
+    
+    /**
+     * @brief I/O 샤드 수 (NUMA 노드 수, 단일 노드이거나 memory.numa가 꺼져 있으면 1)
+     */
+    size_t get_shard_count() const noexcept {
+        return shards_.size();
+    }
 
 private:
+    /**
+     * @brief NUMA 노드 하나의 io_context
+     *
+     * 샤드의 I/O 스레드는 노드 CPU에 고정되고, 연결 객체와 버퍼는 그 스레드에서 만들어지므로
+     * 노드 로컬 메모리에 놓입니다. 연결은 수락 시 샤드에 번갈아 배정되고 끝까지 그 샤드에서 처리됩니다.
+     */
+    struct IoShard {
+        net::io_context io_context;
+        std::unique_ptr<net::io_context::work> work;
+    };
+    
+    static std::vector<std::unique_ptr<IoShard>> make_shards();
+    
     void start_accept();
+    void schedule_ping();
+    void on_ping_timer(beast::error_code ec);
     void on_accept(beast::error_code ec, tcp::socket socket);
-    void on_message(const std::string& connection_id, const std::string& message);
-    void on_connection(const std::string& connection_id);
+    void create_connection(tcp::socket socket, const std::string& connection_id);
+    void publish_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch);
+    void on_connection(const std::string& connection_id, const WebSocketDispatch& dispatch);
     void on_disconnection(const std::string& connection_id);
     
+    std::vector<ConnectionPtr> snapshot_connections() const;
+    bool wait_for_connections_drained(std::chrono::milliseconds timeout) const;
+    
+    static constexpr std::chrono::milliseconds kShutdownGracePeriod{1000};
+    
     uint16_t port_;
-    net::io_context io_context_;
+    uint32_t worker_thread_count_;
+    std::vector<std::unique_ptr<IoShard>> shards_;
     tcp::acceptor acceptor_;
-    std::unique_ptr<net::io_context::work> work_;
+    size_t next_shard_ = 0;   // acceptor strand에서만 접근
+    net::steady_timer ping_timer_;
+    std::chrono::milliseconds ping_interval_{0};
+    SessionMode session_mode_ = SessionMode::CALLBACK_CHAIN;
     std::vector<std::thread> worker_threads_;
     
+    // 조회/순회는 잠금 없이, 추가/제거와 규칙·콜백 게시는 connections_mutex_로 직렬화
+    // (게시 순회와 새 연결 등록이 섞이면 새 연결이 옛 값을 받을 수 있음)
     mutable std::mutex connections_mutex_;
-    std::unordered_map<std::string, ConnectionPtr> connections_;
+    common::ConcurrentHashMap<std::string, ConnectionPtr> connections_;
+    
     
-    MessageHandler message_handler_;
-    ConnectionHandler connection_handler_;
-    ConnectionHandler disconnection_handler_;
+    MessageStats message_stats_;
+    FrameRejectionStats frame_rejections_;
+    common::LatencyHistogram rtt_histogram_;
+    NodeEgressShaper egress_shaper_;
+    BandwidthLimits bandwidth_limits_;                  // connections_mutex_로 보호
+    std::shared_ptr<const FramePolicy> frame_policy_;   // connections_mutex_로 보호
+    std::shared_ptr<const WebSocketDispatch> dispatch_;   // connections_mutex_로 보호 (nullptr 아님)
+    common::MemoryAccount* connection_account_ = nullptr;
+    common::MemoryAccount* buffer_account_ = nullptr;
     
     std::atomic<bool> running_{false};
     std::atomic<uint64_t> next_connection_id_{1};
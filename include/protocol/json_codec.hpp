@@ -0,0 +1,135 @@
+#pragma once
+
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace mmorpg::protocol::json {
+
+/**
+ * @brief 리더가 소유한 버퍼 위에서 동작하는 풀 할당자 (값 노드와 파서 스택에 사용)
+ */
+using PoolAllocator = rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator>;
+using Document = rapidjson::GenericDocument<rapidjson::UTF8<>, PoolAllocator, PoolAllocator>;
+using Value = Document::ValueType;
+
+/**
+ * @brief std::string에 바로 쓰는 RapidJSON 출력 스트림 (clear 후에도 용량 유지)
+ */
+class StringOutputStream {
+public:
+    using Ch = char;
+
+    explicit StringOutputStream(std::string& output)
+        : output_(&output) {
+    }
+
+    void Put(Ch c) { output_->push_back(c); }
+    void Flush() {}
+
+private:
+    std::string* output_;
+};
+
+using Writer = rapidjson::Writer<StringOutputStream>;
+
+/**
+ * @brief 재사용 in-situ JSON 디코더
+ *
+ * 수신 버퍼를 제자리에서 파싱하므로 문자열 값은 버퍼를 가리키고 복사되지 않습니다.
+ * 값 노드와 파서 스택은 리더 소유 버퍼 위의 풀에서 할당하고 메시지마다 풀을 비웁니다.
+ * 풀이 넘친 메시지가 있으면 다음 파싱 전에 버퍼를 키우므로 정상 상태에서는 메시지당
+ * 힙 할당이 없습니다. 스레드 안전하지 않습니다 (I/O 스레드마다 하나).
+ */
+class JsonReader {
+public:
+    /**
+     * @param initial_pool_size 값/스택 풀 각각의 초기 버퍼 크기
+     * @param max_pool_size 넘침 후 키울 수 있는 최대 버퍼 크기
+     */
+    explicit JsonReader(size_t initial_pool_size = 16 * 1024, size_t max_pool_size = 1024 * 1024);
+
+    JsonReader(const JsonReader&) = delete;
+    JsonReader& operator=(const JsonReader&) = delete;
+
+    /**
+     * @brief NUL 종단 버퍼를 제자리에서 파싱
+     * @param text 수정 가능한 NUL 종단 텍스트. 이스케이프가 제자리에서 풀리며 문자열 값이 이 버퍼를 가리킴
+     * @return 루트 문서, 파싱 실패 시 nullptr. 다음 parse_insitu() 호출 전까지 유효
+     */
+    const Document* parse_insitu(char* text);
+
+    /**
+     * @brief 마지막 파싱 오류 설명 (성공 시 빈 문자열)
+     */
+    std::string_view get_error() const;
+
+    size_t get_error_offset() const;
+
+    size_t get_pool_size() const { return pool_size_; }
+
+    uint64_t get_overflow_count() const { return overflow_count_; }
+
+private:
+    void rebuild(size_t pool_size);
+
+    size_t pool_size_;
+    size_t max_pool_size_;
+    uint64_t overflow_count_ = 0;
+
+    std::unique_ptr<char[]> value_buffer_;
+    std::unique_ptr<char[]> stack_buffer_;
+    std::optional<PoolAllocator> value_allocator_;
+    std::optional<PoolAllocator> stack_allocator_;
+    std::optional<Document> document_;  // 할당자보다 먼저 소멸해야 하므로 마지막에 선언
+};
+
+/**
+ * @brief 재사용 출력 버퍼에 쓰는 JSON 응답 빌더
+ *
+ * begin()이 출력 버퍼를 비우고 Writer를 초기화해 돌려줍니다. 버퍼와 Writer의
+ * 레벨 스택은 용량을 유지하므로 정상 상태에서는 메시지당 할당이 없습니다.
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(size_t reserve = 4 * 1024);
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    Writer& begin();
+
+    /**
+     * @brief 완성된 JSON 텍스트 (다음 begin() 전까지 유효)
+     */
+    const std::string& get_output() const { return output_; }
+
+private:
+    std::string output_;
+    StringOutputStream stream_;
+    Writer writer_;
+};
+
+/**
+ * @brief 객체의 문자열 멤버 (객체가 아니거나 멤버가 없거나 타입이 다르면 nullopt, 반환 뷰는 파싱한 버퍼를 가리킴)
+ */
+std::optional<std::string_view> get_string(const Value& object, const char* key);
+
+/**
+ * @brief 객체의 부호 없는 정수 멤버 (객체가 아니거나 멤버가 없거나 타입이 다르면 nullopt)
+ */
+std::optional<uint64_t> get_uint64(const Value& object, const char* key);
+
+/**
+ * @brief string_view를 JSON 문자열로 출력 (NUL 종단 불필요)
+ */
+inline void write_string(Writer& writer, std::string_view text) {
+    writer.String(text.data(), static_cast<rapidjson::SizeType>(text.size()));
+}
+
+} // namespace mmorpg::protocol::json
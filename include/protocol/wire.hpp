@@ -0,0 +1,207 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace mmorpg::protocol {
+
+/**
+ * @brief 프레임 디스패치 결과
+ */
+enum class DispatchResult {
+    OK,              // 핸들러 호출됨
+    MALFORMED,       // 헤더 또는 본문 길이가 스키마와 맞지 않음
+    UNKNOWN_OPCODE,  // 스키마에 없는 opcode
+    UNHANDLED        // 유효한 메시지지만 핸들러에 해당 오버로드가 없음
+};
+
+inline const char* to_string(DispatchResult result) noexcept {
+    switch (result) {
+        case DispatchResult::OK:             return "ok";
+        case DispatchResult::MALFORMED:      return "malformed";
+        case DispatchResult::UNKNOWN_OPCODE: return "unknown_opcode";
+        case DispatchResult::UNHANDLED:      return "unhandled";
+    }
+    return "unknown";
+}
+
+namespace wire {
+
+/**
+ * @brief 프레임 헤더 (u16 opcode) 크기
+ */
+constexpr size_t kHeaderSize = sizeof(uint16_t);
+
+/**
+ * @brief 가변 길이 필드의 길이 접두사 크기 및 최대 길이
+ */
+constexpr size_t kLengthPrefixSize = sizeof(uint16_t);
+constexpr size_t kMaxVariableFieldSize = UINT16_MAX;
+
+template <typename T>
+inline constexpr bool is_wire_scalar_v =
+    std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename T>
+using wire_uint_t = std::conditional_t<sizeof(T) == 1, uint8_t,
+                    std::conditional_t<sizeof(T) == 2, uint16_t,
+                    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+template <typename U>
+constexpr U byteswap(U value) noexcept {
+    if constexpr (sizeof(U) == 1) {
+        return value;
+    } else if constexpr (sizeof(U) == 2) {
+        return static_cast<U>(__builtin_bswap16(value));
+    } else if constexpr (sizeof(U) == 4) {
+        return static_cast<U>(__builtin_bswap32(value));
+    } else {
+        return static_cast<U>(__builtin_bswap64(value));
+    }
+}
+
+/**
+ * @brief 정렬되지 않은 위치에서 little-endian 값 읽기
+ *
+ * x86/ARM little-endian에서는 단일 mov로 컴파일됩니다.
+ */
+template <typename T>
+inline T load(const char* source) noexcept {
+    static_assert(is_wire_scalar_v<T>, "unsupported wire type");
+    using U = wire_uint_t<T>;
+
+    U raw;
+    std::memcpy(&raw, source, sizeof(U));
+    if constexpr (std::endian::native == std::endian::big) {
+        raw = byteswap(raw);
+    }
+
+    if constexpr (std::is_same_v<T, bool>) {
+        return raw != 0;
+    } else {
+        return std::bit_cast<T>(raw);
+    }
+}
+
+/**
+ * @brief 정렬되지 않은 위치에 little-endian 값 쓰기
+ */
+template <typename T>
+inline void store(char* destination, T value) noexcept {
+    static_assert(is_wire_scalar_v<T>, "unsupported wire type");
+    using U = wire_uint_t<T>;
+
+    U raw;
+    if constexpr (std::is_same_v<T, bool>) {
+        raw = value ? 1 : 0;
+    } else {
+        raw = std::bit_cast<U>(value);
+    }
+    if constexpr (std::endian::native == std::endian::big) {
+        raw = byteswap(raw);
+    }
+    std::memcpy(destination, &raw, sizeof(U));
+}
+
+/**
+ * @brief 프레임의 opcode 읽기 (길이가 부족하면 false)
+ */
+inline bool peek_opcode(std::string_view frame, uint16_t& opcode) noexcept {
+    if (frame.size() < kHeaderSize) {
+        return false;
+    }
+    opcode = load<uint16_t>(frame.data());
+    return true;
+}
+
+/**
+ * @brief 가변 길이 필드 쓰기 (길이 접두사 + 바이트), 다음 쓰기 위치 반환
+ *
+ * 길이는 encoded_size()에서 kMaxVariableFieldSize로 잘린 값과 일치해야 합니다.
+ */
+inline char* store_bytes(char* destination, std::string_view value) noexcept {
+    const auto size = static_cast<uint16_t>(value.size() < kMaxVariableFieldSize ? value.size()
+                                                                                 : kMaxVariableFieldSize);
+    store<uint16_t>(destination, size);
+    if (size != 0) {
+        std::memcpy(destination + kLengthPrefixSize, value.data(), size);
+    }
+    return destination + kLengthPrefixSize + size;
+}
+
+inline size_t bytes_wire_size(std::string_view value) noexcept {
+    return kLengthPrefixSize + (value.size() < kMaxVariableFieldSize ? value.size() : kMaxVariableFieldSize);
+}
+
+/**
+ * @brief 가변 길이 필드 경계 검사
+ *
+ * body[offset]에서 길이 접두사를 읽고 필드가 body 안에 들어오면 필드 시작 위치와 길이를
+ * 기록한 뒤 offset을 다음 필드로 옮깁니다.
+ */
+inline bool check_bytes(std::string_view body, size_t& offset, uint32_t& field_offset,
+                        uint16_t& field_size) noexcept {
+    if (body.size() - offset < kLengthPrefixSize) {
+        return false;
+    }
+    field_size = load<uint16_t>(body.data() + offset);
+    offset += kLengthPrefixSize;
+    if (body.size() - offset < field_size) {
+        return false;
+    }
+    field_offset = static_cast<uint32_t>(offset);
+    offset += field_size;
+    return true;
+}
+
+/**
+ * @brief 메시지를 출력 버퍼 끝에 직접 인코딩 (중간 버퍼 없음)
+ */
+template <typename Message>
+inline void append(std::string& out, const Message& message) {
+    const size_t offset = out.size();
+    out.resize(offset + message.encoded_size());
+    message.encode_to(out.data() + offset);
+}
+
+/**
+ * @brief 메시지 하나를 새 프레임으로 인코딩
+ */
+template <typename Message>
+inline std::string encode(const Message& message) {
+    std::string frame;
+    append(frame, message);
+    return frame;
+}
+
+} // namespace wire
+
+namespace detail {
+
+/**
+ * @brief 본문을 View로 검증한 뒤 handler.handle(view, context...) 호출
+ *
+ * 핸들러에 맞는 오버로드가 없으면 컴파일 시점에 UNHANDLED로 결정되어 검증도 하지 않습니다.
+ */
+template <typename View, typename Handler, typename... Context>
+inline DispatchResult dispatch_as(std::string_view body, Handler& handler, Context&... context) {
+    if constexpr (requires(const View& view) { handler.handle(view, context...); }) {
+        View view;
+        if (!view.bind(body)) {
+            return DispatchResult::MALFORMED;
+        }
+        handler.handle(view, context...);
+        return DispatchResult::OK;
+    } else {
+        return DispatchResult::UNHANDLED;
+    }
+}
+
+} // namespace detail
+
+} // namespace mmorpg::protocol
@@ -0,0 +1,45 @@
+#!/bin/bash
+
+# 두 커밋의 벤치마크 JSON 결과 비교
+# 사용법: ./scripts/compare_benchmarks.sh <기준.json> <비교.json>
+# Google Benchmark의 tools/compare.py가 있으면 사용하고, 없으면 간단한 표로 출력합니다.
+
+set -e
+
+BASELINE=$1
+CONTENDER=$2
+
+if [ -z "$BASELINE" ] || [ -z "$CONTENDER" ]; then
+    echo "사용법: $0 <baseline.json> <contender.json>"
+    exit 1
+fi
+
+if [ -n "$BENCHMARK_COMPARE_PY" ] && [ -f "$BENCHMARK_COMPARE_PY" ]; then
+    exec python3 "$BENCHMARK_COMPARE_PY" benchmarks "$BASELINE" "$CONTENDER"
+fi
+
+python3 - "$BASELINE" "$CONTENDER" <<'PY'
+import json
+import sys
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    result = {}
+    for bench in data["benchmarks"]:
+        if bench.get("aggregate_name", "mean") != "mean":
+            continue
+        result[bench.get("run_name", bench["name"])] = bench["real_time"]
+    return result
+
+base = load(sys.argv[1])
+new = load(sys.argv[2])
+
+print(f"{'benchmark':70} {'base':>12} {'new':>12} {'change':>9}")
+for name in sorted(base):
+    if name not in new:
+        continue
+    change = (new[name] - base[name]) / base[name] * 100.0 if base[name] else 0.0
+    flag = "  <-- regression" if change > 10.0 else ""
+    print(f"{name:70} {base[name]:12.1f} {new[name]:12.1f} {change:+8.1f}%{flag}")
+PY
@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# 마이크로벤치마크 실행 후 결과를 커밋별 JSON으로 저장
+# 사용법: ./scripts/run_benchmarks.sh <performance_test 경로> [결과 디렉토리] [추가 벤치마크 옵션...]
+
+set -e
+
+BENCH_BIN=${1:-build_release/tools/benchmark/performance_test}
+RESULT_DIR=${2:-benchmark_results}
+shift 2 2>/dev/null || shift $#
+
+if [ ! -x "$BENCH_BIN" ]; then
+    echo "[ERROR] 벤치마크 실행 파일을 찾을 수 없습니다: $BENCH_BIN"
+    exit 1
+fi
+
+mkdir -p "$RESULT_DIR"
+
+COMMIT=$(git rev-parse --short HEAD 2>/dev/null || echo "unknown")
+if ! git diff --quiet HEAD 2>/dev/null; then
+    COMMIT="${COMMIT}-dirty"
+fi
+OUTPUT="$RESULT_DIR/${COMMIT}.json"
+
+echo "[INFO] 벤치마크 실행: $BENCH_BIN"
+"$BENCH_BIN" \
+    --benchmark_out="$OUTPUT" \
+    --benchmark_out_format=json \
+    --benchmark_repetitions=3 \
+    --benchmark_report_aggregates_only=true \
+    "$@"
+
+echo "[INFO] 결과 저장: $OUTPUT"
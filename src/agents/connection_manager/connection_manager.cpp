@@ -1,46 +1,103 @@
 #include "agents/connection_manager/connection_manager.hpp"
 #include "common/logger.hpp"
+#include "common/profiler.hpp"
+#include "protocol/game_protocol.hpp"
+#include "protocol/json_codec.hpp"
 #include <algorithm>
+#include <random>
 #include <thread>
 #include <stdexcept>
 
 namespace mmorpg::agents::connection_manager {
 
-ConnectionManagerAgent::ConnectionManagerAgent(uint32_t max_connections)
+/**
+ * @brief 연결 계층에서 처리하는 프로토콜 메시지 핸들러
+ *
+ * 게임 로직 메시지(이동, 전투, 채팅)는 오버로드가 없으므로 UNHANDLED로 돌아갑니다.
+ */
+class ConnectionManagerAgent::ClientMessageHandler {
+public:
+    explicit ClientMessageHandler(ConnectionManagerAgent& agent)
+        : agent_(agent) {
+    }
+    
+    void handle(const protocol::HeartbeatView& heartbeat, const std::string& connection_id) {
+        agent_.update_activity(connection_id);
+        
+        protocol::HeartbeatAck ack;
+        ack.client_time_ms = heartbeat.client_time_ms();
+        ack.server_time_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        agent_.websocket_handler_->send_to_connection(connection_id, protocol::wire::encode(ack), true);
+    }
+    
+    void handle(const protocol::ResumeRequestView& request, const std::string& connection_id) {
+        agent_.resume_connection(connection_id, request.token());
+    }
+
+private:
+    ConnectionManagerAgent& agent_;
+};
+
+ConnectionManagerAgent::ConnectionManagerAgent(uint32_t max_connections,
+                                               uint16_t port,
+                                               uint32_t worker_threads)
     : BaseAgent("ConnectionManager")
     , max_connections_(max_connections)
-    , websocket_handler_(std::make_unique<network::WebSocketHandler>(8080))
+    , connection_memory_(memory_account(common::MemoryCategory::CONNECTIONS))
+    , buffer_memory_(memory_account(common::MemoryCategory::BUFFERS))
+    , websocket_handler_(std::make_unique<network::WebSocketHandler>(port, worker_threads))
     , load_balancer_(std::make_unique<network::LoadBalancer>())
     , work_(std::make_unique<boost::asio::io_context::work>(io_context_)) {
+    websocket_handler_->set_memory_accounts(&connection_memory_, &buffer_memory_);
+    set_frame_limits(kDefaultMaxFramePreAuth, kDefaultMaxFrame, 0, 0);
+    websocket_handler_->set_message_handler(
+        [this](const std::string& connection_id, std::string_view message, bool is_binary) {
+            on_client_message(connection_id, message, is_binary);
+        }
+    );
 }
 
 void ConnectionManagerAgent::start() {
     LOG_INFO("Connection Manager Agent 시작");
     
     running_.store(true, std::memory_order_release);
+    draining_.store(false, std::memory_order_release);
     start_time_ = std::chrono::high_resolution_clock::now();
     
     // 워커 스레드 시작
     start_worker_threads();
     
-    // WebSocket 핸들러 시작
-    websocket_handler_->start();
-    
     // 로드 밸런서 시작
     load_balancer_->start();
     
+    // UDP 보조 채널 - 바인드에 실패하면 WebSocket만으로 동작
+    if (udp_channel_ && !udp_channel_->start()) {
+        LOG_ERROR("UDP 보조 채널 시작 실패, WebSocket만 사용");
+        udp_channel_.reset();
+    }
+    
+    // WebSocket 핸들러 시작 - 리스너는 뒤에서 처리할 구성 요소가 모두 동작한 뒤 마지막에 엶
+    websocket_handler_->start();
+    
     update_metric("startup_time", std::chrono::duration<double>(
         std::chrono::high_resolution_clock::now() - start_time_).count());
+    mark_ready();
 }
 
 void ConnectionManagerAgent::stop() {
     LOG_INFO("Connection Manager Agent 중지");
     
     running_.store(false, std::memory_order_release);
+    clear_ready();
     
     // WebSocket 핸들러 중지
     websocket_handler_->stop();
     
+    if (udp_channel_) {
+        udp_channel_->stop();
+    }
+    
     // 로드 밸런서 중지
     load_balancer_->stop();
     
@@ -50,18 +107,16 @@ void ConnectionManagerAgent::stop() {
     // 모든 연결 정리
     {
         std::lock_guard<std::mutex> lock(connections_mutex_);
+        connection_memory_.release(connections_.size() * sizeof(ConnectionInfo));
         connections_.clear();
         current_connections_.store(0, std::memory_order_release);
+        authenticated_connections_.store(0, std::memory_order_release);
     }
 }
 
 bool ConnectionManagerAgent::handle_new_connection(const std::string& connection_id, 
                                                   const std::string& ip_address) {
-    if (current_connections_.load(std::memory_order_acquire) >= max_connections_) {
-        LOG_WARNING("최대 연결 수 초과: {}", max_connections_);
-        update_metric("connection_rejected", 1.0);
-        return false;
-    }
+    PROFILE_ZONE_CAT("cm.handle_new_connection", "connection_manager");
     
     auto connection_info = std::make_unique<ConnectionInfo>();
     connection_info->connection_id = connection_id;
@@ -70,9 +125,38 @@ bool ConnectionManagerAgent::handle_new_connection(const std::string& connection
     connection_info->last_activity = connection_info->connected_at;
     
     {
+        // 한도 검사와 삽입을 같은 임계 구역에서 수행해야 동시 접속 시 한도를 넘지 않음
         std::lock_guard<std::mutex> lock(connections_mutex_);
-        connections_[connection_id] = std::move(connection_info);
+        
+        if (draining_.load(std::memory_order_acquire)) {
+            LOG_WARNING("종료 드레인 중 연결 거부: {}", connection_id);
+            update_metric("connection_rejected", 1.0);
+            return false;
+        }
+        
+        const uint32_t max_connections = max_connections_.load(std::memory_order_relaxed);
+        if (current_connections_.load(std::memory_order_acquire) >= max_connections) {
+            LOG_WARNING("최대 연결 수 초과: {}", max_connections);
+            update_metric("connection_rejected", 1.0);
+            return false;
+        }
+        
+        // 메모리 예산을 넘은 동안은 새 연결을 받지 않음 (기존 연결은 유지)
+        if (connection_memory_.over_budget() || buffer_memory_.over_budget()) {
+            LOG_WARNING("메모리 예산 초과로 연결 거부: {} (연결 {} / 버퍼 {} bytes)", connection_id,
+                        connection_memory_.get_bytes(), buffer_memory_.get_bytes());
+            update_metric("connection_rejected", 1.0);
+            update_metric("connection_rejected_memory", 1.0);
+            return false;
+        }
+        
+        if (!connections_.emplace(connection_id, std::move(connection_info)).second) {
+            LOG_WARNING("중복 연결 ID 거부: {}", connection_id);
+            update_metric("connection_rejected", 1.0);
+            return false;
+        }
         current_connections_.fetch_add(1, std::memory_order_acq_rel);
+        connection_memory_.charge(sizeof(ConnectionInfo));
     }
     
     LOG_INFO("새 연결 수락: {} from {}", connection_id, ip_address);
@@ -83,36 +167,372 @@ bool ConnectionManagerAgent::handle_new_connection(const std::string& connection
 }
 
 void ConnectionManagerAgent::handle_disconnection(const std::string& connection_id) {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
+    PROFILE_ZONE_CAT("cm.handle_disconnection", "connection_manager");
     
-    auto it = connections_.find(connection_id);
-    if (it != connections_.end()) {
+    std::string logged_out_user;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        
+        auto it = connections_.find(connection_id);
+        if (it == connections_.end()) {
+            return;
+        }
+        if (it->second->is_authenticated) {
+            authenticated_connections_.fetch_sub(1, std::memory_order_acq_rel);
+            logged_out_user = std::move(it->second->user_id);
+        }
         connections_.erase(it);
         current_connections_.fetch_sub(1, std::memory_order_acq_rel);
+        connection_memory_.release(sizeof(ConnectionInfo));
+        if (udp_channel_) {
+            udp_channel_->close_session(connection_id);
+        }
         
         LOG_INFO("연결 해제: {}", connection_id);
         update_metric("connections_total", current_connections_.load(std::memory_order_acquire));
         update_metric("connection_disconnected", 1.0);
     }
+    
+    if (session_listener_ && !logged_out_user.empty()) {
+        session_listener_(logged_out_user, false);
+    }
 }
 
 void ConnectionManagerAgent::authenticate_connection(const std::string& connection_id, 
                                                     const std::string& user_id) {
+    PROFILE_ZONE_CAT("cm.authenticate_connection", "connection_manager");
+    
+    std::string previous_user;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        
+        auto it = connections_.find(connection_id);
+        if (it == connections_.end()) {
+            return;
+        }
+        if (it->second->is_authenticated) {
+            previous_user = it->second->user_id;
+        } else {
+            it->second->is_authenticated = true;
+            authenticated_connections_.fetch_add(1, std::memory_order_acq_rel);
+        }
+        it->second->user_id = user_id;
+        
+        LOG_INFO("연결 인증 완료: {} -> {}", connection_id, user_id);
+        update_metric("authenticated_connections",
+                     authenticated_connections_.load(std::memory_order_acquire));
+    }
+    
+    // 이후 프레임은 인증 후 규칙(크기, opcode)으로 검증
+    websocket_handler_->set_connection_authenticated(connection_id, true);
+    
+    if (previous_user != user_id) {
+        offer_udp_channel(connection_id);
+    }
+    
+    if (!session_listener_ || previous_user == user_id) {
+        return;
+    }
+    // 같은 연결에서 다른 사용자로 재인증하면 이전 사용자는 로그아웃
+    if (!previous_user.empty()) {
+        session_listener_(previous_user, false);
+    }
+    session_listener_(user_id, true);
+}
+
+void ConnectionManagerAgent::set_session_listener(SessionListener listener) {
+    session_listener_ = std::move(listener);
+}
+
+void ConnectionManagerAgent::set_frame_limits(size_t max_frame_pre_auth, size_t max_frame,
+                                              uint32_t messages_per_second, uint32_t message_burst) {
+    network::FramePolicy policy;
+    policy.max_frame_pre_auth = max_frame_pre_auth;
+    policy.max_frame_authenticated = max_frame;
+    policy.messages_per_second = messages_per_second;
+    policy.message_burst = message_burst;
+    
+    const auto opcode = [](auto message) { return static_cast<uint16_t>(decltype(message)::kOpcode); };
+    policy.allow_pre_auth({opcode(protocol::Heartbeat{}), opcode(protocol::LoginRequest{}),
+                           opcode(protocol::ResumeRequest{})});
+    policy.allow_authenticated({opcode(protocol::Heartbeat{}), opcode(protocol::LoginRequest{}),
+                                opcode(protocol::MoveInput{}), opcode(protocol::AttackRequest{}),
+                                opcode(protocol::ChatSend{})});
+    websocket_handler_->set_frame_policy(std::move(policy));
+}
+
+void ConnectionManagerAgent::set_ping_interval(std::chrono::milliseconds interval) {
+    websocket_handler_->set_ping_interval(interval);
+}
+
+void ConnectionManagerAgent::set_session_mode(network::SessionMode mode) {
+    websocket_handler_->set_session_mode(mode);
+}
+
+void ConnectionManagerAgent::set_bandwidth_limits(uint64_t connection_bytes_per_second,
+                                                  uint64_t node_bytes_per_second) {
+    network::BandwidthLimits limits;
+    limits.connection_bytes_per_second = connection_bytes_per_second;
+    limits.node_bytes_per_second = node_bytes_per_second;
+    websocket_handler_->set_bandwidth_limits(limits);
+}
+
+void ConnectionManagerAgent::enable_udp_channel(network::UdpChannelOptions options) {
+    udp_channel_ = std::make_unique<network::UdpChannel>(std::move(options));
+    udp_channel_->set_receive_handler(
+        [this](const std::string& connection_id, uint16_t, std::string_view payload) {
+            record_datagram_bytes(connection_id, 0, payload.size());
+            on_client_message(connection_id, payload, true);
+        }
+    );
+}
+
+void ConnectionManagerAgent::offer_udp_channel(const std::string& connection_id) {
+    if (!udp_channel_) {
+        return;
+    }
+    
+    // 재인증(다른 사용자)이면 새 토큰으로 교체되어 이전 바인드는 끊김
+    protocol::UdpOffer offer;
+    offer.port = udp_channel_->get_port();
+    offer.token = udp_channel_->open_session(connection_id);
+    websocket_handler_->send_to_connection(connection_id, protocol::wire::encode(offer), true);
+}
+
+void ConnectionManagerAgent::send_datagram(const std::string& connection_id, uint16_t lane,
+                                           const std::string& frame, bool reliable) {
+    if (udp_channel_ && udp_channel_->send(connection_id, lane, frame, reliable)) {
+        record_datagram_bytes(connection_id, frame.size(), 0);
+        return;
+    }
+    // 비신뢰 프레임은 곧 새 값으로 대체되므로 대역폭 한도에 걸리면 먼저 미룸
+    websocket_handler_->send_to_connection(connection_id, frame, true,
+                                           reliable ? network::SendPriority::NORMAL : network::SendPriority::LOW);
+}
+
+void ConnectionManagerAgent::record_datagram_bytes(const std::string& connection_id, size_t sent,
+                                                   size_t received) {
     std::lock_guard<std::mutex> lock(connections_mutex_);
     
     auto it = connections_.find(connection_id);
     if (it != connections_.end()) {
-        it->second->user_id = user_id;
-        it->second->is_authenticated = true;
+        it->second->bytes_sent.fetch_add(sent, std::memory_order_relaxed);
+        it->second->bytes_received.fetch_add(received, std::memory_order_relaxed);
+    }
+}
+
+const network::UdpChannel* ConnectionManagerAgent::get_udp_channel() const {
+    return udp_channel_.get();
+}
+
+bool ConnectionManagerAgent::migrate_connection(const std::string& connection_id, const std::string& host,
+                                                uint16_t port, const std::string& token, std::string state,
+                                                HandoffCallback on_handoff) {
+    PROFILE_ZONE_CAT("cm.migrate_connection", "connection_manager");
+    
+    common::SessionHandoff handoff;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
         
-        LOG_INFO("연결 인증 완료: {} -> {}", connection_id, user_id);
-        update_metric("authenticated_connections", 
-                     std::count_if(connections_.begin(), connections_.end(),
-                                  [](const auto& pair) { return pair.second->is_authenticated; }));
+        auto it = connections_.find(connection_id);
+        if (it == connections_.end() || !it->second->is_authenticated) {
+            return false;
+        }
+        handoff.user_id = it->second->user_id;
+    }
+    handoff.token = token;
+    handoff.state = std::move(state);
+    
+    protocol::MigrateRedirect redirect;
+    redirect.port = port;
+    redirect.host = host;
+    redirect.token = token;
+    
+    const bool detached = websocket_handler_->detach_connection(
+        connection_id, protocol::wire::encode(redirect), true,
+        [handoff = std::move(handoff), on_handoff = std::move(on_handoff)](
+            std::vector<common::PendingFrame> pending_frames) mutable {
+            handoff.pending_frames = std::move(pending_frames);
+            on_handoff(std::move(handoff));
+        });
+    if (!detached) {
+        return false;
+    }
+    
+    LOG_INFO("세션 이전 시작: {} -> {}:{}", connection_id, host, port);
+    update_metric("sessions_migrated_out", 1.0);
+    return true;
+}
+
+void ConnectionManagerAgent::begin_drain() {
+    if (draining_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    LOG_INFO("종료 드레인 시작: 새 연결 수락 중지 (현재 연결 {}개)", websocket_handler_->get_connection_count());
+    websocket_handler_->stop_accepting();
+    clear_ready();
+}
+
+bool ConnectionManagerAgent::is_draining() const {
+    return draining_.load(std::memory_order_acquire);
+}
+
+size_t ConnectionManagerAgent::drain_connections(std::chrono::milliseconds reconnect_spread,
+                                                 const std::string& exclude_node_id) {
+    PROFILE_ZONE_CAT("cm.drain_connections", "connection_manager");
+    
+    const auto connection_ids = websocket_handler_->get_connection_ids();
+    const auto targets = load_balancer_->select_servers(connection_ids.size(), exclude_node_id);
+    const auto servers = load_balancer_->get_all_servers();
+    
+    std::mt19937 random(std::random_device{}());
+    std::uniform_int_distribution<uint32_t> delay(0, static_cast<uint32_t>(reconnect_spread.count()));
+    
+    size_t drained = 0;
+    for (size_t i = 0; i < connection_ids.size(); ++i) {
+        protocol::Reconnect reconnect;
+        reconnect.delay_ms = delay(random);
+        if (!targets.empty()) {
+            const auto target = std::find_if(servers.begin(), servers.end(), [&](const network::ServerNode& server) {
+                return server.id == targets[i];
+            });
+            if (target != servers.end()) {
+                reconnect.host = target->host;
+                reconnect.port = target->port;
+            }
+        }
+        if (websocket_handler_->drain_connection(connection_ids[i], protocol::wire::encode(reconnect), true)) {
+            ++drained;
+        }
+    }
+    
+    LOG_INFO("종료 드레인: 연결 {}개에 재접속 안내 ({})", drained,
+             targets.empty() ? "같은 주소" : "다른 노드로 분산");
+    return drained;
+}
+
+void ConnectionManagerAgent::accept_handoff(common::SessionHandoff handoff) {
+    std::optional<std::string> waiting_connection;
+    {
+        std::lock_guard<std::mutex> lock(handoffs_mutex_);
+        
+        auto parked = parked_resumes_.find(handoff.token);
+        if (parked != parked_resumes_.end()) {
+            waiting_connection = std::move(parked->second.connection_id);
+            parked_resumes_.erase(parked);
+        } else {
+            const auto expires_at = std::chrono::steady_clock::now() + kHandoffTimeout;
+            std::string token = handoff.token;
+            handoffs_.insert_or_assign(std::move(token), PendingHandoff{std::move(handoff), expires_at});
+            return;
+        }
+    }
+    complete_resume(*waiting_connection, std::move(handoff));
+}
+
+void ConnectionManagerAgent::set_resume_listener(ResumeListener listener) {
+    resume_listener_ = std::move(listener);
+}
+
+std::vector<std::string> ConnectionManagerAgent::get_authenticated_connection_ids(size_t limit) const {
+    std::vector<std::string> ids;
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    
+    for (const auto& [connection_id, info] : connections_) {
+        if (ids.size() >= limit) {
+            break;
+        }
+        if (info->is_authenticated) {
+            ids.push_back(connection_id);
+        }
+    }
+    return ids;
+}
+
+void ConnectionManagerAgent::resume_connection(const std::string& connection_id, std::string_view token) {
+    PROFILE_ZONE_CAT("cm.resume_connection", "connection_manager");
+    
+    std::optional<common::SessionHandoff> handoff;
+    {
+        std::lock_guard<std::mutex> lock(handoffs_mutex_);
+        
+        auto it = handoffs_.find(std::string(token));
+        if (it != handoffs_.end()) {
+            handoff = std::move(it->second.handoff);
+            handoffs_.erase(it);
+        } else {
+            // 클라이언트 재접속이 노드 간 전송보다 빠를 수 있음 - 세션 도착까지 대기
+            parked_resumes_.insert_or_assign(std::string(token), ParkedResume{
+                connection_id, std::chrono::steady_clock::now() + kResumeWaitTimeout});
+            return;
+        }
+    }
+    complete_resume(connection_id, std::move(*handoff));
+}
+
+void ConnectionManagerAgent::complete_resume(const std::string& connection_id, common::SessionHandoff handoff) {
+    authenticate_connection(connection_id, handoff.user_id);
+    
+    protocol::ResumeResponse response;
+    response.result = 0;
+    response.user_id = handoff.user_id;
+    websocket_handler_->send_to_connection(connection_id, protocol::wire::encode(response), true);
+    
+    // 이전 노드가 보내지 못한 프레임을 원래 순서대로
+    for (const auto& frame : handoff.pending_frames) {
+        websocket_handler_->send_to_connection(connection_id, frame.payload, frame.binary);
+    }
+    
+    LOG_INFO("세션 재개: {} ({}, 미전송 프레임 {}개)", connection_id, handoff.user_id, handoff.pending_frames.size());
+    update_metric("sessions_resumed", 1.0);
+    
+    if (resume_listener_) {
+        resume_listener_(connection_id, handoff);
+    }
+}
+
+void ConnectionManagerAgent::send_resume_failure(const std::string& connection_id) {
+    protocol::ResumeResponse response;
+    response.result = 1;
+    websocket_handler_->send_to_connection(connection_id, protocol::wire::encode(response), true);
+}
+
+void ConnectionManagerAgent::expire_handoffs() {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::string> timed_out;
+    size_t expired = 0;
+    {
+        std::lock_guard<std::mutex> lock(handoffs_mutex_);
+        
+        for (auto it = handoffs_.begin(); it != handoffs_.end();) {
+            if (it->second.expires_at <= now) {
+                it = handoffs_.erase(it);
+                ++expired;
+            } else {
+                ++it;
+            }
+        }
+        for (auto it = parked_resumes_.begin(); it != parked_resumes_.end();) {
+            if (it->second.expires_at <= now) {
+                timed_out.push_back(std::move(it->second.connection_id));
+                it = parked_resumes_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    
+    for (const auto& connection_id : timed_out) {
+        send_resume_failure(connection_id);
+    }
+    if (expired > 0 || !timed_out.empty()) {
+        LOG_WARNING("세션 이전 만료: 미사용 세션 {}개, 재개 실패 {}개", expired, timed_out.size());
     }
 }
 
 void ConnectionManagerAgent::update_activity(const std::string& connection_id) {
+    PROFILE_ZONE_CAT("cm.update_activity", "connection_manager");
+    
     std::lock_guard<std::mutex> lock(connections_mutex_);
     
     auto it = connections_.find(connection_id);
@@ -125,32 +545,62 @@ std::unordered_map<std::string, double> ConnectionManagerAgent::get_connection_s
     std::lock_guard<std::mutex> lock(connections_mutex_);
     
     uint32_t total_connections = current_connections_.load(std::memory_order_acquire);
-    uint32_t authenticated_connections = std::count_if(
-        connections_.begin(), connections_.end(),
-        [](const auto& pair) { return pair.second->is_authenticated; }
-    );
+    uint32_t max_connections = max_connections_.load(std::memory_order_relaxed);
+    uint32_t authenticated_connections = authenticated_connections_.load(std::memory_order_acquire);
     
-    return {
+    std::unordered_map<std::string, double> stats = {
         {"total_connections", static_cast<double>(total_connections)},
         {"authenticated_connections", static_cast<double>(authenticated_connections)},
-        {"max_connections", static_cast<double>(max_connections_)},
-        {"connection_utilization", static_cast<double>(total_connections) / max_connections_}
+        {"max_connections", static_cast<double>(max_connections)},
+        {"connection_utilization", static_cast<double>(total_connections) / max_connections}
     };
+    
+    if (udp_channel_) {
+        const auto udp = udp_channel_->get_stats();
+        stats["udp_sessions"] = static_cast<double>(udp_channel_->get_session_count());
+        stats["udp_packets_received"] = static_cast<double>(udp.packets_received);
+        stats["udp_stale_dropped"] = static_cast<double>(udp.stale_dropped);
+        stats["udp_rejected"] = static_cast<double>(udp.rejected);
+        stats["udp_resends"] = static_cast<double>(udp.resends);
+        stats["udp_reliable_expired"] = static_cast<double>(udp.reliable_expired);
+    }
+    
+    const auto rtt = websocket_handler_->get_rtt_histogram();
+    if (rtt.count != 0) {
+        stats["rtt_p50_ms"] = rtt.percentile(0.50) / 1e6;
+        stats["rtt_p99_ms"] = rtt.percentile(0.99) / 1e6;
+    }
+    
+    const auto egress = websocket_handler_->get_egress_stats();
+    stats["egress_deferred_frames"] = static_cast<double>(egress.deferred_frames);
+    stats["egress_deferred_bytes"] = static_cast<double>(egress.deferred_bytes);
+    return stats;
 }
 
 std::optional<ConnectionInfo> ConnectionManagerAgent::get_connection_info(
     const std::string& connection_id) const {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
-    
-    auto it = connections_.find(connection_id);
-    if (it != connections_.end()) {
-        return *it->second;
+    std::optional<ConnectionInfo> info;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        
+        auto it = connections_.find(connection_id);
+        if (it == connections_.end()) {
+            return std::nullopt;
+        }
+        info.emplace(*it->second);
     }
     
-    return std::nullopt;
+    // WebSocket 바이트는 연결이 읽기/쓰기 완료 시점에 센 값을 더함
+    if (const auto traffic = websocket_handler_->get_connection_traffic(connection_id)) {
+        info->bytes_sent.fetch_add(traffic->bytes_out, std::memory_order_relaxed);
+        info->bytes_received.fetch_add(traffic->bytes_in, std::memory_order_relaxed);
+    }
+    return info;
 }
 
 void ConnectionManagerAgent::cleanup_inactive_connections(std::chrono::seconds timeout) {
+    PROFILE_ZONE_CAT("cm.cleanup_inactive_connections", "connection_manager");
+    
     auto now = std::chrono::high_resolution_clock::now();
     std::vector<std::string> to_remove;
     
@@ -170,17 +620,108 @@ void ConnectionManagerAgent::cleanup_inactive_connections(std::chrono::seconds t
         LOG_INFO("비활성 연결 정리: {}", connection_id);
     }
     
+    expire_handoffs();
+    
     if (!to_remove.empty()) {
         update_metric("connections_cleaned", static_cast<double>(to_remove.size()));
     }
 }
 
+void ConnectionManagerAgent::set_max_connections(uint32_t max_connections) {
+    const uint32_t previous = max_connections_.exchange(max_connections, std::memory_order_relaxed);
+    if (previous != max_connections) {
+        LOG_INFO("최대 연결 수 변경: {} -> {}", previous, max_connections);
+        update_metric("max_connections", static_cast<double>(max_connections));
+    }
+}
+
+uint32_t ConnectionManagerAgent::get_max_connections() const {
+    return max_connections_.load(std::memory_order_relaxed);
+}
+
+uint32_t ConnectionManagerAgent::get_connection_count() const {
+    return current_connections_.load(std::memory_order_relaxed);
+}
+
+const network::WebSocketHandler& ConnectionManagerAgent::get_websocket_handler() const {
+    return *websocket_handler_;
+}
+
+network::LoadBalancer& ConnectionManagerAgent::get_load_balancer() {
+    return *load_balancer_;
+}
+
+void ConnectionManagerAgent::on_client_message(const std::string& connection_id,
+                                               std::string_view message,
+                                               bool is_binary) {
+    PROFILE_ZONE_CAT("cm.on_client_message", "connection_manager");
+    
+    if (!is_binary) {
+        on_json_message(connection_id, message);
+        return;
+    }
+    
+    ClientMessageHandler handler(*this);
+    const auto result = protocol::dispatch(message, handler, connection_id);
+    
+    if (result == protocol::DispatchResult::MALFORMED || result == protocol::DispatchResult::UNKNOWN_OPCODE) {
+        reject_frame(connection_id, protocol::to_string(result), message.size());
+    }
+}
+
+void ConnectionManagerAgent::on_json_message(const std::string& connection_id, std::string_view message) {
+    PROFILE_ZONE_CAT("cm.on_json_message", "connection_manager");
+    
+    // I/O 스레드마다 리더/라이터를 재사용 (정상 상태에서 메시지당 할당 없음)
+    thread_local protocol::json::JsonReader reader;
+    thread_local protocol::json::JsonWriter writer;
+    
+    // 텍스트 프레임은 NUL 종단이고 핸들러 반환 전까지 수정 가능 (WebSocketDispatch::MessageHandler)
+    const auto* document = reader.parse_insitu(const_cast<char*>(message.data()));
+    if (!document) {
+        reject_frame(connection_id, reader.get_error(), message.size());
+        return;
+    }
+    
+    const auto type = protocol::json::get_string(*document, "type");
+    if (!type) {
+        reject_frame(connection_id, "missing type", message.size());
+        return;
+    }
+    
+    if (*type == "heartbeat") {
+        update_activity(connection_id);
+        
+        auto& out = writer.begin();
+        out.StartObject();
+        out.Key("type");
+        out.String("heartbeat_ack");
+        out.Key("client_time_ms");
+        out.Uint64(protocol::json::get_uint64(*document, "client_time_ms").value_or(0));
+        out.Key("server_time_ms");
+        out.Uint64(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count()));
+        out.EndObject();
+        websocket_handler_->send_to_connection(connection_id, writer.get_output());
+        return;
+    }
+    
+    reject_frame(connection_id, "unknown type", message.size());
+}
+
+void ConnectionManagerAgent::reject_frame(const std::string& connection_id, std::string_view reason, size_t size) {
+    LOG_DEBUG("잘못된 프레임 거부: {} ({}, {} bytes)", connection_id, reason, size);
+    update_metric("protocol_rejected_frames",
+                 static_cast<double>(rejected_frames_.fetch_add(1, std::memory_order_relaxed) + 1));
+}
+
 void ConnectionManagerAgent::start_worker_threads() {
     const size_t num_threads = std::thread::hardware_concurrency();
     worker_threads_.reserve(num_threads);
     
     for (size_t i = 0; i < num_threads; ++i) {
-        worker_threads_.emplace_back([this]() {
+        worker_threads_.emplace_back([this, i]() {
+            mmorpg::common::Profiler::instance().set_thread_name("cm_worker_" + std::to_string(i));
             io_context_.run();
         });
     }
@@ -0,0 +1,212 @@
+#include "agents/connection_manager/session_migrator.hpp"
+#include "agents/connection_manager/connection_manager.hpp"
+#include "cluster/cluster_transport.hpp"
+#include "common/logger.hpp"
+#include "common/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace mmorpg::agents::connection_manager {
+
+SessionMigrator::SessionMigrator(ConnectionManagerAgent& connection_manager, cluster::ClusterTransport& transport)
+    : connection_manager_(connection_manager)
+    , transport_(transport) {
+}
+
+void SessionMigrator::set_state_provider(StateProvider provider) {
+    state_provider_ = std::move(provider);
+}
+
+bool SessionMigrator::migrate(const std::string& connection_id, const std::string& target_node) {
+    PROFILE_ZONE_CAT("migrator.migrate", "connection_manager");
+
+    if (target_node == transport_.get_node_id() || !transport_.has_peer(target_node)) {
+        return false;
+    }
+
+    // get_server()의 포인터는 가십 스레드가 노드를 제거하면 무효가 되므로 복사본에서 찾음
+    const auto servers = connection_manager_.get_load_balancer().get_all_servers();
+    const auto target = std::find_if(servers.begin(), servers.end(), [&](const network::ServerNode& server) {
+        return server.id == target_node;
+    });
+    if (target == servers.end()) {
+        return false;
+    }
+    const std::string host = target->host;
+    const uint16_t port = target->port;
+
+    std::string state;
+    if (state_provider_) {
+        const auto info = connection_manager_.get_connection_info(connection_id);
+        if (!info || !info->is_authenticated) {
+            return false;
+        }
+        state = state_provider_(info->user_id);
+    }
+
+    const bool started = connection_manager_.migrate_connection(
+        connection_id, host, port, generate_token(), std::move(state),
+        [this, target_node](common::SessionHandoff handoff) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            outbox_.emplace_back(target_node, std::move(handoff));
+        });
+    if (started) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.started;
+    }
+    return started;
+}
+
+size_t SessionMigrator::rebalance(size_t max_sessions, double threshold) {
+    PROFILE_ZONE_CAT("migrator.rebalance", "connection_manager");
+
+    const auto servers = connection_manager_.get_load_balancer().get_all_servers();
+    const auto self = std::find_if(servers.begin(), servers.end(), [&](const network::ServerNode& server) {
+        return server.id == transport_.get_node_id();
+    });
+    if (self == servers.end()) {
+        return 0;
+    }
+
+    const network::ServerNode* idlest = nullptr;
+    for (const auto& server : servers) {
+        if (server.id == self->id || !server.can_accept_connection() || !transport_.has_peer(server.id)) {
+            continue;
+        }
+        if (!idlest || server.get_load_score() < idlest->get_load_score()) {
+            idlest = &server;
+        }
+    }
+    if (!idlest || self->get_load_score() - idlest->get_load_score() < threshold) {
+        return 0;
+    }
+
+    const uint32_t self_connections = self->current_connections.load();
+    const uint32_t target_connections = idlest->current_connections.load();
+    if (self_connections <= target_connections) {
+        return 0;
+    }
+    const size_t to_move = std::min<size_t>(max_sessions, (self_connections - target_connections) / 2);
+
+    size_t started = 0;
+    for (const auto& connection_id : connection_manager_.get_authenticated_connection_ids(to_move)) {
+        if (migrate(connection_id, idlest->id)) {
+            ++started;
+        }
+    }
+    if (started > 0) {
+        LOG_INFO("세션 재분배: {}개 -> {} (부하 {:.2f} / {:.2f})",
+                 started, idlest->id, self->get_load_score(), idlest->get_load_score());
+    }
+    return started;
+}
+
+size_t SessionMigrator::evacuate() {
+    PROFILE_ZONE_CAT("migrator.evacuate", "connection_manager");
+
+    const auto connection_ids = connection_manager_.get_authenticated_connection_ids(SIZE_MAX);
+    const auto targets = connection_manager_.get_load_balancer().select_servers(connection_ids.size(),
+                                                                                transport_.get_node_id());
+    if (targets.empty()) {
+        return 0;
+    }
+
+    size_t started = 0;
+    for (size_t i = 0; i < connection_ids.size(); ++i) {
+        if (migrate(connection_ids[i], targets[i])) {
+            ++started;
+        }
+    }
+    LOG_INFO("종료 드레인: 세션 {}/{}개 이전 시작", started, connection_ids.size());
+    return started;
+}
+
+void SessionMigrator::on_batch(const cluster::ClusterBatch& batch) {
+    for (const auto& message : batch.messages()) {
+        if (message.body_case() != cluster::ClusterMessage::kSessionTransfer) {
+            continue;
+        }
+
+        const auto& transfer = message.session_transfer();
+        common::SessionHandoff handoff;
+        handoff.token = transfer.token();
+        handoff.user_id = transfer.user_id();
+        handoff.state = transfer.state();
+        handoff.pending_frames.reserve(static_cast<size_t>(transfer.pending_frames_size()));
+        for (const auto& frame : transfer.pending_frames()) {
+            handoff.pending_frames.push_back(common::PendingFrame{frame.payload(), frame.binary()});
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.received;
+        }
+        connection_manager_.accept_handoff(std::move(handoff));
+    }
+}
+
+void SessionMigrator::poll() {
+    std::vector<std::pair<std::string, common::SessionHandoff>> outgoing;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        outgoing.swap(outbox_);
+    }
+    if (outgoing.empty()) {
+        return;
+    }
+
+    uint64_t sent = 0;
+    uint64_t failed = 0;
+    uint64_t frames = 0;
+    for (auto& [node_id, handoff] : outgoing) {
+        cluster::ClusterMessage* message = transport_.add_message(node_id);
+        if (!message) {
+            LOG_WARNING("세션 전송 실패: {} -> {}", handoff.user_id, node_id);
+            ++failed;
+            continue;
+        }
+        message->set_sent_at_us(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count()));
+
+        auto* transfer = message->mutable_session_transfer();
+        transfer->mutable_token()->assign(handoff.token);
+        transfer->mutable_user_id()->assign(handoff.user_id);
+        transfer->mutable_state()->assign(handoff.state);
+        for (const auto& frame : handoff.pending_frames) {
+            auto* pending = transfer->add_pending_frames();
+            pending->mutable_payload()->assign(frame.payload);
+            pending->set_binary(frame.binary);
+        }
+        frames += handoff.pending_frames.size();
+        ++sent;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.sent += sent;
+    stats_.failed += failed;
+    stats_.pending_frames += frames;
+}
+
+MigrationStats SessionMigrator::get_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+std::string SessionMigrator::generate_token() {
+    static constexpr char kHex[] = "0123456789abcdef";
+
+    // 128비트
+    std::string token;
+    token.reserve(32);
+    for (int word = 0; word < 4; ++word) {
+        uint32_t bits = random_();
+        for (int nibble = 0; nibble < 8; ++nibble) {
+            token.push_back(kHex[bits & 0xF]);
+            bits >>= 4;
+        }
+    }
+    return token;
+}
+
+} // namespace mmorpg::agents::connection_manager
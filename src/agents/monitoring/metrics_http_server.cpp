@@ -0,0 +1,171 @@
+#include "agents/monitoring/metrics_http_server.hpp"
+#include "common/logger.hpp"
+#include <chrono>
+
+namespace mmorpg::agents::monitoring {
+
+/**
+ * @brief HTTP 연결 하나 (요청 1회 처리 후 종료)
+ */
+class MetricsHttpServer::Session : public std::enable_shared_from_this<MetricsHttpServer::Session> {
+public:
+    Session(tcp::socket socket, const MetricsHttpServer& server)
+        : stream_(std::move(socket))
+        , server_(server) {
+    }
+
+    void run() {
+        stream_.expires_after(std::chrono::seconds(5));
+        http::async_read(stream_, buffer_, request_,
+            [self = shared_from_this()](beast::error_code ec, std::size_t) {
+                self->on_read(ec);
+            });
+    }
+
+private:
+    void on_read(beast::error_code ec) {
+        if (ec) {
+            return;
+        }
+
+        response_ = server_.handle_request(request_);
+        http::async_write(stream_, response_,
+            [self = shared_from_this()](beast::error_code, std::size_t) {
+                beast::error_code shutdown_ec;
+                self->stream_.socket().shutdown(tcp::socket::shutdown_send, shutdown_ec);
+            });
+    }
+
+    beast::tcp_stream stream_;
+    beast::flat_buffer buffer_;
+    http::request<http::string_body> request_;
+    http::response<http::string_body> response_;
+    const MetricsHttpServer& server_;
+};
+
+MetricsHttpServer::MetricsHttpServer(uint16_t port)
+    : port_(port)
+    , acceptor_(io_context_) {
+}
+
+MetricsHttpServer::~MetricsHttpServer() {
+    stop();
+}
+
+void MetricsHttpServer::add_route(const std::string& path, const std::string& content_type, Provider provider) {
+    routes_[path] = Route{content_type, std::move(provider)};
+}
+
+bool MetricsHttpServer::start() {
+    if (running_.load(std::memory_order_acquire)) {
+        return true;
+    }
+
+    beast::error_code ec;
+    tcp::endpoint endpoint(tcp::v4(), port_);
+
+    acceptor_.open(endpoint.protocol(), ec);
+    if (!ec) {
+        acceptor_.set_option(net::socket_base::reuse_address(true), ec);
+    }
+    if (!ec) {
+        acceptor_.bind(endpoint, ec);
+    }
+    if (!ec) {
+        acceptor_.listen(net::socket_base::max_listen_connections, ec);
+    }
+    if (ec) {
+        LOG_ERROR("Failed to start metrics HTTP server on port {}: {}", port_, ec.message());
+        return false;
+    }
+
+    running_.store(true, std::memory_order_release);
+    start_accept();
+
+    thread_ = std::thread([this]() {
+        io_context_.run();
+    });
+
+    LOG_INFO("Metrics HTTP server listening on port {}", get_port());
+    return true;
+}
+
+void MetricsHttpServer::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    net::post(io_context_, [this]() {
+        beast::error_code ec;
+        acceptor_.close(ec);
+    });
+    io_context_.stop();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    LOG_INFO("Metrics HTTP server stopped");
+}
+
+uint16_t MetricsHttpServer::get_port() const {
+    beast::error_code ec;
+    auto endpoint = acceptor_.local_endpoint(ec);
+    return ec ? port_ : endpoint.port();
+}
+
+void MetricsHttpServer::start_accept() {
+    acceptor_.async_accept(
+        [this](beast::error_code ec, tcp::socket socket) {
+            if (ec) {
+                if (running_.load(std::memory_order_acquire)) {
+                    LOG_WARNING("Metrics HTTP accept error: {}", ec.message());
+                }
+            } else {
+                std::make_shared<Session>(std::move(socket), *this)->run();
+            }
+
+            if (running_.load(std::memory_order_acquire)) {
+                start_accept();
+            }
+        }
+    );
+}
+
+http::response<http::string_body> MetricsHttpServer::handle_request(
+    const http::request<http::string_body>& request) const {
+    http::response<http::string_body> response;
+    response.version(request.version());
+    response.keep_alive(false);
+    response.set(http::field::server, "mmorpg-monitoring");
+
+    if (request.method() != http::verb::get) {
+        response.result(http::status::method_not_allowed);
+        response.set(http::field::content_type, "text/plain");
+        response.body() = "method not allowed\n";
+        response.prepare_payload();
+        return response;
+    }
+
+    std::string path(request.target());
+    auto query = path.find('?');
+    if (query != std::string::npos) {
+        path.resize(query);
+    }
+
+    auto it = routes_.find(path);
+    if (it == routes_.end()) {
+        response.result(http::status::not_found);
+        response.set(http::field::content_type, "text/plain");
+        response.body() = "not found\n";
+    } else {
+        response.result(http::status::ok);
+        response.set(http::field::content_type, it->second.content_type);
+        response.body() = it->second.provider();
+    }
+
+    response.prepare_payload();
+    return response;
+}
+
+} // namespace mmorpg::agents::monitoring
@@ -0,0 +1,578 @@
+#include "agents/monitoring/monitoring_agent.hpp"
+#include "common/logger.hpp"
+#include "common/profiler.hpp"
+#include <algorithm>
+#include <sstream>
+
+namespace mmorpg::agents::monitoring {
+
+using mmorpg::common::HistogramSnapshot;
+using mmorpg::common::escape_prometheus_label;
+using network::MessageStats;
+
+namespace {
+
+constexpr double kNanosPerMicro = 1000.0;
+
+} // namespace
+
+MonitoringAgent::MonitoringAgent(std::chrono::seconds interval, uint16_t http_port, size_t top_talker_count)
+    : BaseAgent("Monitoring")
+    , interval_(interval)
+    , http_port_(http_port)
+    , top_talker_count_(top_talker_count)
+    , previous_time_(std::chrono::steady_clock::now()) {
+}
+
+MonitoringAgent::~MonitoringAgent() {
+    if (running_.load(std::memory_order_acquire)) {
+        stop();
+    }
+}
+
+void MonitoringAgent::start() {
+    if (running_.load(std::memory_order_acquire)) {
+        LOG_WARNING("Monitoring Agent 이미 실행 중");
+        return;
+    }
+
+    LOG_INFO("Monitoring Agent 시작 (집계 주기 {}초)", interval_.count());
+
+    running_.store(true, std::memory_order_release);
+    start_time_ = Clock::now();
+
+    if (http_port_ != 0) {
+        http_server_ = std::make_unique<MetricsHttpServer>(http_port_);
+        http_server_->add_route("/metrics", "text/plain; version=0.0.4",
+            [this]() { return render_prometheus(); });
+        http_server_->add_route("/health", "text/plain",
+            [this]() { return std::string(is_running() ? "ok\n" : "stopping\n"); });
+        if (!http_server_->start()) {
+            http_server_.reset();
+        }
+    }
+
+    aggregation_thread_ = std::thread([this]() {
+        mmorpg::common::Profiler::instance().set_thread_name("monitoring");
+        run_aggregation_loop();
+    });
+
+    update_metric("startup_time", std::chrono::duration<double>(Clock::now() - start_time_).count());
+    mark_ready();
+}
+
+void MonitoringAgent::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    LOG_INFO("Monitoring Agent 중지");
+    clear_ready();
+
+    {
+        std::lock_guard<std::mutex> lock(wakeup_mutex_);
+    }
+    wakeup_cv_.notify_all();
+
+    if (aggregation_thread_.joinable()) {
+        aggregation_thread_.join();
+    }
+
+    if (http_server_) {
+        http_server_->stop();
+        http_server_.reset();
+    }
+}
+
+void MonitoringAgent::register_agent(const mmorpg::common::BaseAgent* agent) {
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    if (std::find(agents_.begin(), agents_.end(), agent) == agents_.end()) {
+        agents_.push_back(agent);
+    }
+}
+
+void MonitoringAgent::unregister_agent(const mmorpg::common::BaseAgent* agent) {
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    agents_.erase(std::remove(agents_.begin(), agents_.end(), agent), agents_.end());
+}
+
+void MonitoringAgent::attach_network(const network::WebSocketHandler* handler) {
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    network_ = handler;
+}
+
+void MonitoringAgent::attach_cluster(const cluster::ClusterTransport* transport) {
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    cluster_ = transport;
+}
+
+void MonitoringAgent::run_aggregation_loop() {
+    while (running_.load(std::memory_order_acquire)) {
+        {
+            std::unique_lock<std::mutex> lock(wakeup_mutex_);
+            wakeup_cv_.wait_for(lock, interval_, [this]() {
+                return !running_.load(std::memory_order_acquire);
+            });
+        }
+
+        if (!running_.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        aggregate();
+        LOG_INFO("{}", render_summary());
+    }
+}
+
+void MonitoringAgent::aggregate_now() {
+    aggregate();
+}
+
+void MonitoringAgent::aggregate() {
+    PROFILE_ZONE_CAT("monitoring.aggregate", "monitoring");
+
+    std::lock_guard<std::mutex> aggregate_lock(aggregate_mutex_);
+
+    const auto now = std::chrono::steady_clock::now();
+    const double seconds = std::max(std::chrono::duration<double>(now - previous_time_).count(), 1e-6);
+    previous_time_ = now;
+
+    MonitoringSnapshot snapshot;
+    snapshot.interval_seconds = seconds;
+
+    std::array<network::OpcodeStatsSnapshot, MessageStats::kSlots> totals{};
+    std::vector<network::ConnectionTraffic> traffic;
+    std::vector<cluster::PeerStats> peers;
+    std::vector<cluster::InboundStats> inbound;
+
+    {
+        std::lock_guard<std::mutex> lock(sources_mutex_);
+
+        for (const auto* agent : agents_) {
+            auto metrics = agent->snapshot_metrics();
+            metrics["is_running"] = agent->is_running() ? 1.0 : 0.0;
+            metrics["is_ready"] = agent->is_ready() ? 1.0 : 0.0;
+            metrics["uptime_seconds"] = agent->get_uptime().count();
+            snapshot.agent_metrics[agent->get_agent_id()] = std::move(metrics);
+        }
+
+        if (network_) {
+            totals = network_->get_message_stats().snapshot();
+            traffic = network_->collect_connection_traffic();
+            snapshot.frame_rejections = network_->get_frame_rejections();
+            snapshot.client_rtt = network_->get_rtt_histogram();
+            snapshot.egress = network_->get_egress_stats();
+        }
+
+        if (cluster_) {
+            peers = cluster_->get_peer_stats();
+            inbound = cluster_->get_inbound_stats();
+        }
+    }
+
+    // opcode별 구간 처리량 및 지연 시간
+    HistogramSnapshot all_latency;
+    for (size_t i = 0; i < MessageStats::kSlots; ++i) {
+        const auto& current = totals[i];
+        const auto& previous = previous_opcodes_[i];
+
+        const uint64_t inbound = current.inbound_count - previous.inbound_count;
+        const uint64_t outbound = current.outbound_count - previous.outbound_count;
+        if (inbound == 0 && outbound == 0) {
+            continue;
+        }
+
+        const HistogramSnapshot latency = current.handler_latency - previous.handler_latency;
+        all_latency += latency;
+
+        OpcodeRate rate;
+        rate.opcode = MessageStats::slot_name(static_cast<uint16_t>(i));
+        rate.inbound_per_second = static_cast<double>(inbound) / seconds;
+        rate.inbound_bytes_per_second = static_cast<double>(current.inbound_bytes - previous.inbound_bytes) / seconds;
+        rate.outbound_per_second = static_cast<double>(outbound) / seconds;
+        rate.outbound_bytes_per_second = static_cast<double>(current.outbound_bytes - previous.outbound_bytes) / seconds;
+        rate.handler_p50_us = latency.percentile(0.50) / kNanosPerMicro;
+        rate.handler_p99_us = latency.percentile(0.99) / kNanosPerMicro;
+
+        snapshot.inbound_per_second += rate.inbound_per_second;
+        snapshot.outbound_per_second += rate.outbound_per_second;
+        snapshot.inbound_bytes_per_second += rate.inbound_bytes_per_second;
+        snapshot.outbound_bytes_per_second += rate.outbound_bytes_per_second;
+        snapshot.opcodes.push_back(std::move(rate));
+    }
+    snapshot.handler_p50_us = all_latency.percentile(0.50) / kNanosPerMicro;
+    snapshot.handler_p99_us = all_latency.percentile(0.99) / kNanosPerMicro;
+    previous_opcodes_ = totals;
+
+    // 클라이언트 RTT (핑 주기마다 연결당 표본 하나)
+    const HistogramSnapshot rtt = snapshot.client_rtt - previous_rtt_;
+    snapshot.rtt_p50_ms = rtt.percentile(0.50) / 1e6;
+    snapshot.rtt_p99_ms = rtt.percentile(0.99) / 1e6;
+    previous_rtt_ = snapshot.client_rtt;
+
+    // 연결별 트래픽 - 구간 증가량 기준 상위 연결
+    std::unordered_map<std::string, network::ConnectionTraffic> current_traffic;
+    current_traffic.reserve(traffic.size());
+    snapshot.connection_count = traffic.size();
+
+    for (auto& entry : traffic) {
+        snapshot.outbound_queue_depth += entry.pending_writes;
+
+        network::ConnectionTraffic base;
+        auto previous = previous_traffic_.find(entry.connection_id);
+        if (previous != previous_traffic_.end()) {
+            base = previous->second;
+        }
+
+        TopTalker talker;
+        talker.connection_id = entry.connection_id;
+        talker.messages_per_second = static_cast<double>(
+            (entry.messages_in - base.messages_in) + (entry.messages_out - base.messages_out)) / seconds;
+        talker.bytes_per_second = static_cast<double>(
+            (entry.bytes_in - base.bytes_in) + (entry.bytes_out - base.bytes_out)) / seconds;
+        if (talker.bytes_per_second > 0.0) {
+            snapshot.top_talkers.push_back(std::move(talker));
+        }
+
+        current_traffic.emplace(entry.connection_id, std::move(entry));
+    }
+    previous_traffic_ = std::move(current_traffic);
+
+    const size_t top_count = std::min(top_talker_count_, snapshot.top_talkers.size());
+    std::partial_sort(snapshot.top_talkers.begin(),
+                      snapshot.top_talkers.begin() + static_cast<std::ptrdiff_t>(top_count),
+                      snapshot.top_talkers.end(),
+                      [](const TopTalker& a, const TopTalker& b) { return a.bytes_per_second > b.bytes_per_second; });
+    snapshot.top_talkers.resize(top_count);
+
+    aggregate_cluster(snapshot, seconds, peers, inbound);
+
+    // 노드별 상주 페이지와 원격 노드 할당 (메모리가 어느 소켓에 놓였는지)
+    snapshot.numa = mmorpg::common::sample_numa_stats();
+
+    // 예산을 넘은 계정의 압박 리스너(캐시 축소 등)를 실행한 뒤 값을 기록
+    auto& memory = mmorpg::common::MemoryRegistry::instance();
+    snapshot.memory_over_budget = memory.check_budgets();
+    snapshot.memory = memory.snapshot();
+
+    std::string prometheus = build_prometheus(snapshot, totals, peers, inbound);
+    std::string summary = build_summary(snapshot);
+
+    update_metric("inbound_per_second", snapshot.inbound_per_second);
+    update_metric("outbound_per_second", snapshot.outbound_per_second);
+    update_metric("outbound_queue_depth", static_cast<double>(snapshot.outbound_queue_depth));
+    update_metric("memory_over_budget", static_cast<double>(snapshot.memory_over_budget));
+
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    last_snapshot_ = std::move(snapshot);
+    prometheus_text_ = std::move(prometheus);
+    summary_text_ = std::move(summary);
+}
+
+void MonitoringAgent::aggregate_cluster(MonitoringSnapshot& snapshot, double seconds,
+                                        const std::vector<cluster::PeerStats>& peers,
+                                        const std::vector<cluster::InboundStats>& inbound) {
+    std::unordered_map<std::string, cluster::PeerStats> current_peers;
+    std::unordered_map<std::string, cluster::InboundStats> current_inbound;
+
+    for (const auto& stats : inbound) {
+        current_inbound[stats.node_id] = stats;
+    }
+
+    // 송신 피어 기준으로 행을 만들고, 같은 노드에서 받은 양을 합침
+    for (const auto& stats : peers) {
+        const auto& previous = previous_peers_[stats.node_id];
+        const HistogramSnapshot latency = stats.ack_latency - previous.ack_latency;
+
+        ClusterPeerRate rate;
+        rate.node_id = stats.node_id;
+        rate.connected = stats.connected;
+        rate.sent_messages_per_second = static_cast<double>(stats.messages_sent - previous.messages_sent) / seconds;
+        rate.sent_bytes_per_second = static_cast<double>(stats.bytes_sent - previous.bytes_sent) / seconds;
+        rate.in_flight_batches = stats.in_flight_batches;
+        rate.ack_p50_us = latency.percentile(0.50) / kNanosPerMicro;
+        rate.ack_p99_us = latency.percentile(0.99) / kNanosPerMicro;
+
+        if (auto it = current_inbound.find(stats.node_id); it != current_inbound.end()) {
+            const auto& received = previous_inbound_[stats.node_id];
+            rate.received_messages_per_second =
+                static_cast<double>(it->second.messages_received - received.messages_received) / seconds;
+            rate.received_bytes_per_second =
+                static_cast<double>(it->second.bytes_received - received.bytes_received) / seconds;
+        }
+
+        snapshot.cluster_peers.push_back(std::move(rate));
+        current_peers[stats.node_id] = stats;
+    }
+
+    // 피어에서 제거된 노드의 이전 값은 버림
+    previous_peers_ = std::move(current_peers);
+    previous_inbound_ = std::move(current_inbound);
+}
+
+std::string MonitoringAgent::build_prometheus(
+    const MonitoringSnapshot& snapshot,
+    const std::array<network::OpcodeStatsSnapshot, MessageStats::kSlots>& totals,
+    const std::vector<cluster::PeerStats>& peers,
+    const std::vector<cluster::InboundStats>& inbound) const {
+    std::ostringstream out;
+
+    out << "# TYPE mmorpg_agent_metric gauge\n";
+    for (const auto& [agent_id, metrics] : snapshot.agent_metrics) {
+        const std::string agent = escape_prometheus_label(agent_id);
+        for (const auto& [key, value] : metrics) {
+            out << "mmorpg_agent_metric{agent=\"" << agent << "\",key=\""
+                << escape_prometheus_label(key) << "\"} " << value << '\n';
+        }
+    }
+
+    out << "# TYPE mmorpg_connections gauge\n"
+        << "mmorpg_connections " << snapshot.connection_count << '\n'
+        << "# TYPE mmorpg_outbound_queue_depth gauge\n"
+        << "mmorpg_outbound_queue_depth " << snapshot.outbound_queue_depth << '\n';
+
+    out << "# TYPE mmorpg_frames_rejected_total counter\n";
+    for (size_t i = 0; i < network::kFrameRejectionCount; ++i) {
+        out << "mmorpg_frames_rejected_total{reason=\"" << network::to_string(static_cast<network::FrameRejection>(i))
+            << "\"} " << snapshot.frame_rejections[i] << '\n';
+    }
+
+    out << "# TYPE mmorpg_egress_deferred_total counter\n"
+        << "mmorpg_egress_deferred_total " << snapshot.egress.deferred_frames << '\n'
+        << "# TYPE mmorpg_egress_deferred_bytes_total counter\n"
+        << "mmorpg_egress_deferred_bytes_total " << snapshot.egress.deferred_bytes << '\n';
+
+    if (snapshot.client_rtt.count != 0) {
+        const auto& rtt = snapshot.client_rtt;
+        out << "# TYPE mmorpg_client_rtt_seconds histogram\n";
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+            cumulative += rtt.counts[i];
+            out << "mmorpg_client_rtt_seconds_bucket{le=\""
+                << static_cast<double>(HistogramSnapshot::bucket_upper_bound_ns(i)) / 1e9 << "\"} " << cumulative << '\n';
+        }
+        out << "mmorpg_client_rtt_seconds_bucket{le=\"+Inf\"} " << rtt.count << '\n'
+            << "mmorpg_client_rtt_seconds_sum " << static_cast<double>(rtt.sum_ns) / 1e9 << '\n'
+            << "mmorpg_client_rtt_seconds_count " << rtt.count << '\n';
+    }
+
+    out << "# TYPE mmorpg_messages_total counter\n";
+    for (const auto& stats : totals) {
+        if (stats.inbound_count == 0 && stats.outbound_count == 0) {
+            continue;
+        }
+        const std::string opcode = MessageStats::slot_name(stats.slot);
+        out << "mmorpg_messages_total{direction=\"in\",opcode=\"" << opcode << "\"} " << stats.inbound_count << '\n'
+            << "mmorpg_messages_total{direction=\"out\",opcode=\"" << opcode << "\"} " << stats.outbound_count << '\n';
+    }
+
+    out << "# TYPE mmorpg_message_bytes_total counter\n";
+    for (const auto& stats : totals) {
+        if (stats.inbound_count == 0 && stats.outbound_count == 0) {
+            continue;
+        }
+        const std::string opcode = MessageStats::slot_name(stats.slot);
+        out << "mmorpg_message_bytes_total{direction=\"in\",opcode=\"" << opcode << "\"} " << stats.inbound_bytes << '\n'
+            << "mmorpg_message_bytes_total{direction=\"out\",opcode=\"" << opcode << "\"} " << stats.outbound_bytes << '\n';
+    }
+
+    out << "# TYPE mmorpg_handler_latency_seconds histogram\n";
+    for (const auto& stats : totals) {
+        const auto& latency = stats.handler_latency;
+        if (latency.count == 0) {
+            continue;
+        }
+        const std::string opcode = MessageStats::slot_name(stats.slot);
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+            cumulative += latency.counts[i];
+            out << "mmorpg_handler_latency_seconds_bucket{opcode=\"" << opcode << "\",le=\""
+                << static_cast<double>(HistogramSnapshot::bucket_upper_bound_ns(i)) / 1e9 << "\"} "
+                << cumulative << '\n';
+        }
+        out << "mmorpg_handler_latency_seconds_bucket{opcode=\"" << opcode << "\",le=\"+Inf\"} " << latency.count << '\n'
+            << "mmorpg_handler_latency_seconds_sum{opcode=\"" << opcode << "\"} "
+            << static_cast<double>(latency.sum_ns) / 1e9 << '\n'
+            << "mmorpg_handler_latency_seconds_count{opcode=\"" << opcode << "\"} " << latency.count << '\n';
+    }
+
+    out << "# TYPE mmorpg_top_talker_bytes_per_second gauge\n";
+    for (const auto& talker : snapshot.top_talkers) {
+        out << "mmorpg_top_talker_bytes_per_second{connection=\""
+            << escape_prometheus_label(talker.connection_id) << "\"} " << talker.bytes_per_second << '\n';
+    }
+
+    out << "# TYPE mmorpg_numa_resident_pages gauge\n";
+    for (size_t node = 0; node < snapshot.numa.resident_pages.size(); ++node) {
+        out << "mmorpg_numa_resident_pages{node=\"" << mmorpg::common::NumaTopology::instance().get_node_id(node)
+            << "\"} " << snapshot.numa.resident_pages[node] << '\n';
+    }
+    out << "# TYPE mmorpg_numa_allocations_total counter\n"
+        << "mmorpg_numa_allocations_total{placement=\"local\"} " << snapshot.numa.local_allocations << '\n'
+        << "mmorpg_numa_allocations_total{placement=\"remote\"} " << snapshot.numa.remote_allocations << '\n';
+
+    out << "# TYPE mmorpg_memory_bytes gauge\n";
+    for (const auto& usage : snapshot.memory) {
+        out << "mmorpg_memory_bytes{owner=\"" << escape_prometheus_label(usage.owner) << "\",category=\""
+            << mmorpg::common::to_string(usage.category) << "\"} " << usage.bytes << '\n';
+    }
+    out << "# TYPE mmorpg_memory_peak_bytes gauge\n";
+    for (const auto& usage : snapshot.memory) {
+        out << "mmorpg_memory_peak_bytes{owner=\"" << escape_prometheus_label(usage.owner) << "\",category=\""
+            << mmorpg::common::to_string(usage.category) << "\"} " << usage.peak << '\n';
+    }
+    out << "# TYPE mmorpg_memory_budget_bytes gauge\n";
+    for (const auto& usage : snapshot.memory) {
+        if (usage.budget == 0) {
+            continue;
+        }
+        out << "mmorpg_memory_budget_bytes{owner=\"" << escape_prometheus_label(usage.owner) << "\",category=\""
+            << mmorpg::common::to_string(usage.category) << "\"} " << usage.budget << '\n';
+    }
+
+    if (peers.empty() && inbound.empty()) {
+        return out.str();
+    }
+
+    out << "# TYPE mmorpg_cluster_peer_connected gauge\n";
+    for (const auto& stats : peers) {
+        out << "mmorpg_cluster_peer_connected{peer=\"" << escape_prometheus_label(stats.node_id) << "\"} "
+            << (stats.connected ? 1 : 0) << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_messages_total counter\n";
+    for (const auto& stats : peers) {
+        out << "mmorpg_cluster_messages_total{direction=\"out\",peer=\"" << escape_prometheus_label(stats.node_id)
+            << "\"} " << stats.messages_sent << '\n';
+    }
+    for (const auto& stats : inbound) {
+        out << "mmorpg_cluster_messages_total{direction=\"in\",peer=\"" << escape_prometheus_label(stats.node_id)
+            << "\"} " << stats.messages_received << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_bytes_total counter\n";
+    for (const auto& stats : peers) {
+        out << "mmorpg_cluster_bytes_total{direction=\"out\",peer=\"" << escape_prometheus_label(stats.node_id)
+            << "\"} " << stats.bytes_sent << '\n';
+    }
+    for (const auto& stats : inbound) {
+        out << "mmorpg_cluster_bytes_total{direction=\"in\",peer=\"" << escape_prometheus_label(stats.node_id)
+            << "\"} " << stats.bytes_received << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_batches_total counter\n";
+    for (const auto& stats : peers) {
+        const std::string peer = escape_prometheus_label(stats.node_id);
+        out << "mmorpg_cluster_batches_total{direction=\"out\",peer=\"" << peer << "\"} " << stats.batches_sent << '\n';
+    }
+    for (const auto& stats : inbound) {
+        const std::string peer = escape_prometheus_label(stats.node_id);
+        out << "mmorpg_cluster_batches_total{direction=\"in\",peer=\"" << peer << "\"} " << stats.batches_received << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_dropped_messages_total counter\n";
+    for (const auto& stats : peers) {
+        out << "mmorpg_cluster_dropped_messages_total{peer=\"" << escape_prometheus_label(stats.node_id) << "\"} "
+            << stats.dropped_messages << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_in_flight_batches gauge\n";
+    for (const auto& stats : peers) {
+        out << "mmorpg_cluster_in_flight_batches{peer=\"" << escape_prometheus_label(stats.node_id) << "\"} "
+            << stats.in_flight_batches << '\n';
+    }
+
+    out << "# TYPE mmorpg_cluster_ack_latency_seconds histogram\n";
+    for (const auto& stats : peers) {
+        const auto& latency = stats.ack_latency;
+        if (latency.count == 0) {
+            continue;
+        }
+        const std::string peer = escape_prometheus_label(stats.node_id);
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+            cumulative += latency.counts[i];
+            out << "mmorpg_cluster_ack_latency_seconds_bucket{peer=\"" << peer << "\",le=\""
+                << static_cast<double>(HistogramSnapshot::bucket_upper_bound_ns(i)) / 1e9 << "\"} "
+                << cumulative << '\n';
+        }
+        out << "mmorpg_cluster_ack_latency_seconds_bucket{peer=\"" << peer << "\",le=\"+Inf\"} " << latency.count << '\n'
+            << "mmorpg_cluster_ack_latency_seconds_sum{peer=\"" << peer << "\"} "
+            << static_cast<double>(latency.sum_ns) / 1e9 << '\n'
+            << "mmorpg_cluster_ack_latency_seconds_count{peer=\"" << peer << "\"} " << latency.count << '\n';
+    }
+
+    return out.str();
+}
+
+std::string MonitoringAgent::build_summary(const MonitoringSnapshot& snapshot) {
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(1);
+
+    out << "Monitor - conns=" << snapshot.connection_count
+        << " in=" << snapshot.inbound_per_second << "msg/s(" << snapshot.inbound_bytes_per_second / 1024.0 << "KB/s)"
+        << " out=" << snapshot.outbound_per_second << "msg/s(" << snapshot.outbound_bytes_per_second / 1024.0 << "KB/s)"
+        << " handler_p50/p99=" << snapshot.handler_p50_us << "/" << snapshot.handler_p99_us << "us"
+        << " queue=" << snapshot.outbound_queue_depth;
+    if (snapshot.rtt_p99_ms > 0.0) {
+        out << " rtt_p50/p99=" << snapshot.rtt_p50_ms << "/" << snapshot.rtt_p99_ms << "ms";
+    }
+
+    size_t memory_bytes = 0;
+    for (const auto& usage : snapshot.memory) {
+        memory_bytes += usage.bytes;
+    }
+    out << " mem=" << static_cast<double>(memory_bytes) / (1024.0 * 1024.0) << "MB";
+    if (snapshot.memory_over_budget != 0) {
+        out << "(over_budget=" << snapshot.memory_over_budget << ")";
+    }
+
+    if (!snapshot.top_talkers.empty()) {
+        const auto& top = snapshot.top_talkers.front();
+        out << " top=" << top.connection_id << "(" << top.bytes_per_second / 1024.0 << "KB/s)";
+    }
+
+    for (const auto& peer : snapshot.cluster_peers) {
+        out << " peer." << peer.node_id << "=" << (peer.connected ? "" : "down,")
+            << peer.sent_messages_per_second << "/" << peer.received_messages_per_second << "msg/s"
+            << " ack_p99=" << peer.ack_p99_us << "us";
+    }
+
+    for (const auto& [agent_id, metrics] : snapshot.agent_metrics) {
+        auto it = metrics.find("connections_total");
+        if (it != metrics.end()) {
+            out << " " << agent_id << ".connections=" << static_cast<uint64_t>(it->second);
+        }
+    }
+
+    return out.str();
+}
+
+MonitoringSnapshot MonitoringAgent::get_last_snapshot() const {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    return last_snapshot_;
+}
+
+std::string MonitoringAgent::render_prometheus() const {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    return prometheus_text_;
+}
+
+std::string MonitoringAgent::render_summary() const {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    return summary_text_;
+}
+
+std::unordered_map<std::string, std::string> MonitoringAgent::health_check() const {
+    auto health = BaseAgent::health_check();
+
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    health["monitored_agents"] = std::to_string(agents_.size());
+    health["network_attached"] = network_ ? "true" : "false";
+    health["http_port"] = std::to_string(http_port_);
+
+    return health;
+}
+
+} // namespace mmorpg::agents::monitoring
@@ -0,0 +1,52 @@
+#include "cluster/cluster_codec.hpp"
+#include "common/profiler.hpp"
+
+namespace mmorpg::cluster {
+
+common::PooledBuffer encode_batch(const ClusterBatch& batch, common::BufferPool& pool) {
+    PROFILE_ZONE_CAT("cluster.encode_batch", "cluster");
+
+    const size_t size = batch.ByteSizeLong();
+    auto buffer = pool.acquire(size);
+    buffer->resize(size);
+    batch.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(buffer->data()));
+    return buffer;
+}
+
+ClusterBatch* decode_batch(std::string_view frame, MessageArena& arena) {
+    PROFILE_ZONE_CAT("cluster.decode_batch", "cluster");
+
+    auto* batch = arena.create<ClusterBatch>();
+    if (!batch->ParseFromArray(frame.data(), static_cast<int>(frame.size()))) {
+        return nullptr;
+    }
+    return batch;
+}
+
+ClusterBatchWriter::ClusterBatchWriter(std::string source_node, size_t initial_arena_block_size)
+    : source_node_(std::move(source_node))
+    , arena_(initial_arena_block_size) {
+    begin_batch();
+}
+
+ClusterMessage* ClusterBatchWriter::add_message() {
+    auto* message = batch_->add_messages();
+    message->set_sequence(next_sequence_++);
+    return message;
+}
+
+common::PooledBuffer ClusterBatchWriter::flush(uint64_t tick, common::BufferPool& pool) {
+    batch_->set_tick(tick);
+    auto buffer = encode_batch(*batch_, pool);
+
+    arena_.reset();
+    begin_batch();
+    return buffer;
+}
+
+void ClusterBatchWriter::begin_batch() {
+    batch_ = arena_.create<ClusterBatch>();
+    batch_->set_source_node(source_node_);
+}
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,109 @@
+#include "cluster/cluster_router.hpp"
+#include <chrono>
+
+namespace mmorpg::cluster {
+
+namespace {
+
+uint64_t now_us() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+ClusterRouter::ClusterRouter(ClusterTransport& transport)
+    : transport_(transport) {
+}
+
+void ClusterRouter::set_player_locator(PlayerLocator locator) {
+    player_locator_ = std::move(locator);
+}
+
+void ClusterRouter::assign_zone(uint32_t zone_id, const std::string& node_id) {
+    zone_owners_[zone_id] = node_id;
+}
+
+std::optional<std::string> ClusterRouter::get_zone_owner(uint32_t zone_id) const {
+    auto it = zone_owners_.find(zone_id);
+    if (it == zone_owners_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+ClusterMessage* ClusterRouter::begin_message(const std::string& node_id) {
+    ClusterMessage* message = transport_.add_message(node_id);
+    if (message) {
+        message->set_sent_at_us(now_us());
+    }
+    return message;
+}
+
+RouteResult ClusterRouter::resolve(const std::optional<std::string>& node_id, ClusterMessage*& message) {
+    message = nullptr;
+    if (!node_id) {
+        return RouteResult::UNROUTABLE;
+    }
+    if (*node_id == transport_.get_node_id()) {
+        return RouteResult::LOCAL;
+    }
+    if (!transport_.has_peer(*node_id)) {
+        return RouteResult::UNROUTABLE;
+    }
+
+    message = begin_message(*node_id);
+    return message ? RouteResult::FORWARDED : RouteResult::DROPPED;
+}
+
+RouteResult ClusterRouter::route_whisper(uint64_t sender_id, uint64_t target_id,
+                                         std::string_view sender_name, std::string_view text) {
+    const auto node_id = player_locator_ ? player_locator_(target_id) : std::nullopt;
+
+    ClusterMessage* message = nullptr;
+    const RouteResult result = resolve(node_id, message);
+    if (message) {
+        auto* whisper = message->mutable_whisper();
+        whisper->set_sender_id(sender_id);
+        whisper->set_target_id(target_id);
+        whisper->mutable_sender_name()->assign(sender_name.data(), sender_name.size());
+        whisper->mutable_text()->assign(text.data(), text.size());
+    }
+    return result;
+}
+
+size_t ClusterRouter::route_guild_chat(uint64_t guild_id, uint64_t sender_id,
+                                       std::string_view sender_name, std::string_view text) {
+    size_t forwarded = 0;
+    for (const auto& node_id : transport_.get_peer_ids()) {
+        ClusterMessage* message = begin_message(node_id);
+        if (!message) {
+            continue;
+        }
+
+        auto* chat = message->mutable_guild_chat();
+        chat->set_guild_id(guild_id);
+        chat->set_sender_id(sender_id);
+        chat->mutable_sender_name()->assign(sender_name.data(), sender_name.size());
+        chat->mutable_text()->assign(text.data(), text.size());
+        ++forwarded;
+    }
+    return forwarded;
+}
+
+RouteResult ClusterRouter::route_zone_action(uint32_t zone_id, uint64_t actor_id, uint64_t target_id,
+                                             uint32_t action, std::string_view payload) {
+    ClusterMessage* message = nullptr;
+    const RouteResult result = resolve(get_zone_owner(zone_id), message);
+    if (message) {
+        auto* zone_action = message->mutable_zone_action();
+        zone_action->set_zone_id(zone_id);
+        zone_action->set_actor_id(actor_id);
+        zone_action->set_target_id(target_id);
+        zone_action->set_action(action);
+        zone_action->mutable_payload()->assign(payload.data(), payload.size());
+    }
+    return result;
+}
+
+} // namespace mmorpg::cluster
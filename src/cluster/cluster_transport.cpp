@@ -0,0 +1,615 @@
+#include "cluster/cluster_transport.hpp"
+#include "common/logger.hpp"
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+
+namespace mmorpg::cluster {
+
+namespace {
+
+uint64_t steady_now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief gRPC 슬라이스가 놓일 때까지 풀 버퍼를 붙잡아 두는 소유자
+ */
+struct FrameHolder {
+    std::shared_ptr<common::BufferPool> pool;  // frame보다 늦게 소멸해야 하므로 먼저 선언
+    common::PooledBuffer frame;
+};
+
+/**
+ * @brief 직렬화된 배치를 복사 없이 ByteBuffer로 감쌈 (gRPC가 다 쓰면 버퍼는 풀로 돌아감)
+ */
+grpc::ByteBuffer wrap_frame(std::shared_ptr<common::BufferPool> pool, common::PooledBuffer frame) {
+    auto* holder = new FrameHolder{std::move(pool), std::move(frame)};
+    grpc::Slice slice(holder->frame->data(), holder->frame->size(),
+                      [](void* user_data) { delete static_cast<FrameHolder*>(user_data); }, holder);
+    return grpc::ByteBuffer(&slice, 1);
+}
+
+/**
+ * @brief 수신 ByteBuffer를 연속 메모리로 (슬라이스가 하나면 복사 없음)
+ */
+bool to_single_slice(const grpc::ByteBuffer& buffer, grpc::Slice& slice) {
+    return buffer.TrySingleSlice(&slice).ok() || buffer.DumpToSingleSlice(&slice).ok();
+}
+
+/**
+ * @brief 피어 채널 생성 (채널 자체의 재연결 백오프도 전송 계층 설정을 따르도록)
+ */
+std::shared_ptr<grpc::Channel> create_channel(const std::string& address, std::chrono::milliseconds backoff) {
+    const int backoff_ms = static_cast<int>(backoff.count());
+    grpc::ChannelArguments arguments;
+    arguments.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, backoff_ms);
+    arguments.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, backoff_ms);
+    arguments.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, backoff_ms * 10);
+    return grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), arguments);
+}
+
+std::string_view slice_view(const grpc::Slice& slice) {
+    return std::string_view(reinterpret_cast<const char*>(slice.begin()), slice.size());
+}
+
+} // namespace
+
+/**
+ * @brief 송신 피어 하나 (채널, 틱 배치 작성기, 스트림 상태)
+ *
+ * writer_는 틱 스레드만 사용하고, 나머지 상태는 mutex_로 보호합니다.
+ * 스트림 리액션도 같은 mutex_를 잡으므로 리액션 안에서 오래 막히는 일은 하지 않습니다.
+ */
+class ClusterTransport::Peer {
+public:
+    Peer(ClusterTransport& transport, std::string node_id, std::string address)
+        : transport_(transport)
+        , node_id_(std::move(node_id))
+        , address_(std::move(address))
+        , channel_(create_channel(address_, transport.options_.reconnect_backoff))
+        , stub_(std::make_unique<grpc::GenericStub>(channel_))
+        , writer_(transport.options_.node_id) {
+    }
+
+    ~Peer() {
+        shutdown();
+    }
+
+    ClusterMessage* add_message() {
+        if (static_cast<uint32_t>(writer_.size()) >= transport_.options_.max_pending_messages) {
+            dropped_messages_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        pending_messages_.store(static_cast<uint32_t>(writer_.size() + 1), std::memory_order_relaxed);
+        return writer_.add_message();
+    }
+
+    bool flush(uint64_t tick);
+
+    /**
+     * @brief 스트림을 취소하고 OnDone까지 대기 (이후 재연결하지 않음)
+     */
+    void shutdown();
+
+    PeerStats stats() const;
+
+    // OutboundStream 리액션에서 호출 (mutex_ 보유 상태)
+    void on_ack_locked(uint64_t tick);
+    void on_stream_done_locked(OutboundStream* stream, const grpc::Status& status);
+
+    std::mutex& mutex() { return mutex_; }
+
+    const std::string& get_node_id() const { return node_id_; }
+
+private:
+    struct InFlightBatch {
+        uint64_t tick;
+        uint64_t sent_at_ns;
+        uint32_t messages;
+    };
+
+    void connect_locked();
+
+    ClusterTransport& transport_;
+    const std::string node_id_;
+    const std::string address_;
+    std::shared_ptr<grpc::Channel> channel_;
+    std::unique_ptr<grpc::GenericStub> stub_;
+
+    ClusterBatchWriter writer_;  // 틱 스레드 전용
+    std::atomic<uint32_t> pending_messages_{0};
+    std::atomic<uint64_t> dropped_messages_{0};
+    common::LatencyHistogram ack_latency_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable stream_done_cv_;
+    OutboundStream* stream_ = nullptr;  // OnDone에서 스스로 삭제
+    bool shutting_down_ = false;
+    bool ever_connected_ = false;
+    std::chrono::steady_clock::time_point next_connect_{};
+    std::deque<InFlightBatch> in_flight_;
+
+    uint64_t batches_sent_ = 0;
+    uint64_t messages_sent_ = 0;
+    uint64_t bytes_sent_ = 0;
+    uint64_t batches_acked_ = 0;
+    uint64_t reconnects_ = 0;
+};
+
+/**
+ * @brief 피어로 가는 양방향 스트림 (클라이언트 측)
+ *
+ * 배치는 스트림으로 쓰고 ack는 같은 스트림에서 읽습니다. 쓰기는 리액션 밖(틱 스레드)에서도
+ * 시작하므로 홀드를 하나 걸어 두고, 읽기가 끝나거나 취소할 때 놓습니다.
+ * 모든 상태는 소유 피어의 mutex로 보호합니다.
+ */
+class ClusterTransport::OutboundStream : public grpc::ClientBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer> {
+public:
+    OutboundStream(Peer& peer, grpc::GenericStub& stub)
+        : peer_(peer) {
+        stub.PrepareBidiStreamingCall(&context_, kExchangeMethod, grpc::StubOptions(), this);
+        StartRead(&ack_);
+        AddHold();
+        StartCall();
+    }
+
+    bool is_writable_locked() const {
+        return !broken_;
+    }
+
+    bool is_connected_locked() const {
+        return connected_ && !broken_;
+    }
+
+    void write_locked(grpc::ByteBuffer frame) {
+        write_queue_.push_back(std::move(frame));
+        if (!writing_) {
+            writing_ = true;
+            StartWrite(&write_queue_.front());
+        }
+    }
+
+    void cancel_locked() {
+        broken_ = true;
+        context_.TryCancel();
+        release_hold_locked();
+    }
+
+    void OnReadInitialMetadataDone(bool ok) override {
+        std::lock_guard<std::mutex> lock(peer_.mutex());
+        connected_ = ok;
+    }
+
+    void OnReadDone(bool ok) override {
+        std::lock_guard<std::mutex> lock(peer_.mutex());
+        if (!ok) {
+            broken_ = true;
+            release_hold_locked();
+            return;
+        }
+
+        grpc::Slice slice;
+        ClusterBatch ack;
+        if (to_single_slice(ack_, slice) &&
+            ack.ParseFromArray(slice.begin(), static_cast<int>(slice.size()))) {
+            peer_.on_ack_locked(ack.tick());
+        }
+        StartRead(&ack_);
+    }
+
+    void OnWriteDone(bool ok) override {
+        std::lock_guard<std::mutex> lock(peer_.mutex());
+        write_queue_.pop_front();
+        if (!ok) {
+            // 스트림이 끊김. 읽기 실패로 홀드가 풀리며 OnDone으로 이어짐
+            broken_ = true;
+        }
+        if (!write_queue_.empty() && !broken_) {
+            StartWrite(&write_queue_.front());
+        } else {
+            writing_ = false;
+        }
+    }
+
+    void OnDone(const grpc::Status& status) override {
+        {
+            std::lock_guard<std::mutex> lock(peer_.mutex());
+            peer_.on_stream_done_locked(this, status);
+        }
+        delete this;
+    }
+
+private:
+    void release_hold_locked() {
+        if (!hold_released_) {
+            hold_released_ = true;
+            RemoveHold();
+        }
+    }
+
+    Peer& peer_;
+    grpc::ClientContext context_;
+    grpc::ByteBuffer ack_;
+    std::deque<grpc::ByteBuffer> write_queue_;
+    bool writing_ = false;
+    bool connected_ = false;
+    bool broken_ = false;
+    bool hold_released_ = false;
+};
+
+bool ClusterTransport::Peer::flush(uint64_t tick) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!stream_) {
+        connect_locked();
+    }
+    if (writer_.empty() || !stream_ || !stream_->is_writable_locked() ||
+        in_flight_.size() >= transport_.options_.max_in_flight_batches) {
+        // 창이 찼거나 연결이 없으면 다음 틱 배치에 계속 쌓음
+        return false;
+    }
+
+    const auto messages = static_cast<uint32_t>(writer_.size());
+    auto frame = writer_.flush(tick, *transport_.buffer_pool_);
+    pending_messages_.store(0, std::memory_order_relaxed);
+
+    ++batches_sent_;
+    messages_sent_ += messages;
+    bytes_sent_ += frame->size();
+    in_flight_.push_back(InFlightBatch{tick, steady_now_ns(), messages});
+
+    stream_->write_locked(wrap_frame(transport_.buffer_pool_, std::move(frame)));
+    return true;
+}
+
+void ClusterTransport::Peer::connect_locked() {
+    const auto now = std::chrono::steady_clock::now();
+    if (shutting_down_ || now < next_connect_) {
+        return;
+    }
+
+    if (ever_connected_) {
+        ++reconnects_;
+        LOG_INFO("Reconnecting cluster stream to {} ({})", node_id_, address_);
+    }
+    ever_connected_ = true;
+    next_connect_ = now + transport_.options_.reconnect_backoff;
+    stream_ = new OutboundStream(*this, *stub_);
+}
+
+void ClusterTransport::Peer::shutdown() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    shutting_down_ = true;
+    if (stream_) {
+        stream_->cancel_locked();
+    }
+    stream_done_cv_.wait(lock, [this]() { return stream_ == nullptr; });
+}
+
+void ClusterTransport::Peer::on_ack_locked(uint64_t tick) {
+    // ack는 누적: tick 이하의 배치가 모두 처리됨
+    const uint64_t now = steady_now_ns();
+    while (!in_flight_.empty() && in_flight_.front().tick <= tick) {
+        ack_latency_.record(now - in_flight_.front().sent_at_ns);
+        in_flight_.pop_front();
+        ++batches_acked_;
+    }
+}
+
+void ClusterTransport::Peer::on_stream_done_locked(OutboundStream* stream, const grpc::Status& status) {
+    if (!shutting_down_) {
+        LOG_WARNING("Cluster stream to {} closed: {}", node_id_, status.error_message());
+    }
+
+    // 끊긴 스트림에서 확인받지 못한 배치는 재전송하지 않음
+    for (const auto& batch : in_flight_) {
+        dropped_messages_.fetch_add(batch.messages, std::memory_order_relaxed);
+    }
+    in_flight_.clear();
+
+    if (stream_ == stream) {
+        stream_ = nullptr;
+    }
+    stream_done_cv_.notify_all();
+}
+
+PeerStats ClusterTransport::Peer::stats() const {
+    PeerStats stats;
+    stats.node_id = node_id_;
+    stats.address = address_;
+    stats.pending_messages = pending_messages_.load(std::memory_order_relaxed);
+    stats.dropped_messages = dropped_messages_.load(std::memory_order_relaxed);
+    stats.ack_latency = ack_latency_.snapshot();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.connected = stream_ && stream_->is_connected_locked();
+    stats.batches_sent = batches_sent_;
+    stats.messages_sent = messages_sent_;
+    stats.bytes_sent = bytes_sent_;
+    stats.batches_acked = batches_acked_;
+    stats.reconnects = reconnects_;
+    stats.in_flight_batches = static_cast<uint32_t>(in_flight_.size());
+    return stats;
+}
+
+/**
+ * @brief 피어에서 들어오는 양방향 스트림 (서버 측)
+ *
+ * 배치를 스트림 전용 Arena에 파싱해 핸들러에 넘기고 ack를 돌려보냅니다.
+ * 쓰기 중에 다음 배치가 처리되면 마지막 tick만 기억했다가 누적 ack로 보냅니다.
+ */
+class ClusterTransport::InboundStream : public grpc::ServerGenericBidiReactor {
+public:
+    explicit InboundStream(ClusterTransport& transport)
+        : transport_(transport) {
+        StartSendInitialMetadata();
+        StartRead(&request_);
+    }
+
+    void OnReadDone(bool ok) override {
+        if (!ok) {
+            finish(grpc::Status::OK);
+            return;
+        }
+
+        grpc::Slice slice;
+        const ClusterBatch* batch = nullptr;
+        if (to_single_slice(request_, slice)) {
+            batch = decode_batch(slice_view(slice), arena_);
+        }
+        if (!batch) {
+            LOG_WARNING("Malformed cluster batch ({} bytes), closing stream", slice.size());
+            finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "malformed cluster batch"));
+            return;
+        }
+
+        const uint64_t tick = batch->tick();
+        transport_.on_batch(*batch, slice.size());
+        arena_.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (writing_) {
+                pending_ack_ = tick;
+                has_pending_ack_ = true;
+            } else {
+                start_ack_locked(tick);
+            }
+        }
+        StartRead(&request_);
+    }
+
+    void OnWriteDone(bool ok) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writing_ = false;
+        if (finishing_) {
+            finish_locked();
+        } else if (ok && has_pending_ack_) {
+            has_pending_ack_ = false;
+            start_ack_locked(pending_ack_);
+        }
+    }
+
+    void OnDone() override {
+        delete this;
+    }
+
+private:
+    void start_ack_locked(uint64_t tick) {
+        ClusterBatch ack;
+        ack.set_source_node(transport_.options_.node_id);
+        ack.set_tick(tick);
+        const std::string bytes = ack.SerializeAsString();
+
+        grpc::Slice slice(bytes.data(), bytes.size());
+        response_ = grpc::ByteBuffer(&slice, 1);
+        writing_ = true;
+        StartWrite(&response_);
+    }
+
+    void finish(grpc::Status status) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishing_ = true;
+        status_ = std::move(status);
+        if (!writing_) {
+            finish_locked();
+        }
+    }
+
+    void finish_locked() {
+        if (!finished_) {
+            finished_ = true;
+            Finish(status_);
+        }
+    }
+
+    ClusterTransport& transport_;
+    MessageArena arena_;
+    grpc::ByteBuffer request_;
+    grpc::ByteBuffer response_;
+
+    std::mutex mutex_;
+    bool writing_ = false;
+    bool has_pending_ack_ = false;
+    uint64_t pending_ack_ = 0;
+    bool finishing_ = false;
+    bool finished_ = false;
+    grpc::Status status_;
+};
+
+/**
+ * @brief Exchange 메서드만 받는 generic 서비스
+ */
+class ClusterTransport::Service : public grpc::CallbackGenericService {
+public:
+    explicit Service(ClusterTransport& transport)
+        : transport_(transport) {
+    }
+
+    grpc::ServerGenericBidiReactor* CreateReactor(grpc::GenericCallbackServerContext* context) override {
+        if (context->method() != kExchangeMethod) {
+            return grpc::CallbackGenericService::CreateReactor(context);
+        }
+        return new InboundStream(transport_);
+    }
+
+private:
+    ClusterTransport& transport_;
+};
+
+ClusterTransport::ClusterTransport(TransportOptions options)
+    : options_(std::move(options))
+    , buffer_pool_(std::make_shared<common::BufferPool>()) {
+}
+
+ClusterTransport::~ClusterTransport() {
+    stop();
+}
+
+bool ClusterTransport::start() {
+    if (server_) {
+        return true;
+    }
+
+    service_ = std::make_unique<Service>(*this);
+
+    int selected_port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(options_.listen_address, grpc::InsecureServerCredentials(), &selected_port);
+    builder.RegisterCallbackGenericService(service_.get());
+    server_ = builder.BuildAndStart();
+
+    if (!server_ || selected_port == 0) {
+        LOG_ERROR("Failed to start cluster transport on {}", options_.listen_address);
+        server_.reset();
+        service_.reset();
+        return false;
+    }
+
+    bound_port_ = static_cast<uint16_t>(selected_port);
+    LOG_INFO("Cluster transport for node {} listening on port {}", options_.node_id, bound_port_);
+    return true;
+}
+
+void ClusterTransport::stop() {
+    {
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        peers_.clear();
+    }
+
+    if (server_) {
+        // 들어오는 스트림은 즉시 취소하고 모든 리액터가 끝날 때까지 대기
+        server_->Shutdown(std::chrono::system_clock::now());
+        server_.reset();
+        service_.reset();
+        LOG_INFO("Cluster transport for node {} stopped", options_.node_id);
+    }
+}
+
+void ClusterTransport::set_batch_handler(BatchHandler handler) {
+    batch_handler_ = std::move(handler);
+}
+
+void ClusterTransport::add_peer(const std::string& node_id, const std::string& address) {
+    if (node_id == options_.node_id) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    if (peers_.count(node_id) == 0) {
+        peers_.emplace(node_id, std::make_unique<Peer>(*this, node_id, address));
+        LOG_INFO("Cluster peer added: {} ({})", node_id, address);
+    }
+}
+
+void ClusterTransport::remove_peer(const std::string& node_id) {
+    std::unique_ptr<Peer> removed;
+    {
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        auto it = peers_.find(node_id);
+        if (it == peers_.end()) {
+            return;
+        }
+        removed = std::move(it->second);
+        peers_.erase(it);
+    }
+    // 스트림 종료 대기는 잠금 밖에서
+    removed.reset();
+    LOG_INFO("Cluster peer removed: {}", node_id);
+}
+
+bool ClusterTransport::has_peer(const std::string& node_id) const {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    return peers_.count(node_id) > 0;
+}
+
+std::vector<std::string> ClusterTransport::get_peer_ids() const {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    std::vector<std::string> ids;
+    ids.reserve(peers_.size());
+    for (const auto& [node_id, peer] : peers_) {
+        ids.push_back(node_id);
+    }
+    return ids;
+}
+
+ClusterMessage* ClusterTransport::add_message(const std::string& node_id) {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    auto it = peers_.find(node_id);
+    return it == peers_.end() ? nullptr : it->second->add_message();
+}
+
+size_t ClusterTransport::flush(uint64_t tick) {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    size_t sent = 0;
+    for (auto& [node_id, peer] : peers_) {
+        if (peer->flush(tick)) {
+            ++sent;
+        }
+    }
+    return sent;
+}
+
+std::vector<PeerStats> ClusterTransport::get_peer_stats() const {
+    std::lock_guard<std::mutex> lock(peers_mutex_);
+    std::vector<PeerStats> stats;
+    stats.reserve(peers_.size());
+    for (const auto& [node_id, peer] : peers_) {
+        stats.push_back(peer->stats());
+    }
+    return stats;
+}
+
+std::vector<InboundStats> ClusterTransport::get_inbound_stats() const {
+    std::lock_guard<std::mutex> lock(inbound_mutex_);
+    std::vector<InboundStats> stats;
+    stats.reserve(inbound_stats_.size());
+    for (const auto& [node_id, inbound] : inbound_stats_) {
+        stats.push_back(inbound);
+    }
+    return stats;
+}
+
+void ClusterTransport::on_batch(const ClusterBatch& batch, size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(inbound_mutex_);
+        auto& stats = inbound_stats_[batch.source_node()];
+        if (stats.node_id.empty()) {
+            stats.node_id = batch.source_node();
+        }
+        ++stats.batches_received;
+        stats.messages_received += static_cast<uint64_t>(batch.messages_size());
+        stats.bytes_received += bytes;
+    }
+
+    if (batch_handler_) {
+        batch_handler_(batch);
+    }
+}
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,664 @@
+#include "cluster/gossip_membership.hpp"
+#include "common/logger.hpp"
+#include "network/load_balancer.hpp"
+#include "protocol/cluster.pb.h"
+#include <algorithm>
+#include <bit>
+#include <future>
+
+namespace mmorpg::cluster {
+
+namespace {
+
+// 상태 변화 재전파 횟수 = kRetransmitMultiplier * log2(멤버 수 + 1)
+constexpr uint32_t kRetransmitMultiplier = 3;
+
+// UDP 데이터그램 하나에 담을 최대 크기 (단편화 방지)
+constexpr size_t kMaxDatagramSize = 1400;
+
+MemberState from_proto(GossipMember::State state) {
+    switch (state) {
+        case GossipMember::SUSPECT: return MemberState::SUSPECT;
+        case GossipMember::DEAD:    return MemberState::DEAD;
+        default:                    return MemberState::ALIVE;
+    }
+}
+
+GossipMember::State to_proto(MemberState state) {
+    switch (state) {
+        case MemberState::SUSPECT: return GossipMember::SUSPECT;
+        case MemberState::DEAD:    return GossipMember::DEAD;
+        default:                   return GossipMember::ALIVE;
+    }
+}
+
+void to_proto(const MemberInfo& info, GossipMember& member) {
+    member.set_node_id(info.node_id);
+    member.set_gossip_address(info.gossip_address);
+    member.set_service_host(info.service_host);
+    member.set_service_port(info.service_port);
+    member.set_state(to_proto(info.state));
+    member.set_incarnation(info.incarnation);
+    member.set_heartbeat(info.heartbeat);
+    member.set_cpu_usage(static_cast<float>(info.load.cpu_usage));
+    member.set_memory_usage(static_cast<float>(info.load.memory_usage));
+    member.set_connections(info.load.connections);
+    member.set_max_connections(info.load.max_connections);
+}
+
+void copy_load(const GossipMember& member, MemberInfo& info) {
+    info.heartbeat = member.heartbeat();
+    info.load.cpu_usage = member.cpu_usage();
+    info.load.memory_usage = member.memory_usage();
+    info.load.connections = member.connections();
+    info.load.max_connections = member.max_connections();
+}
+
+} // namespace
+
+GossipMembership::GossipMembership(MembershipOptions options)
+    : options_(std::move(options))
+    , socket_(io_context_)
+    , period_timer_(io_context_)
+    , probe_timer_(io_context_)
+    , random_(std::random_device{}()) {
+    // 재시작한 노드가 이전 DEAD 기록보다 높은 incarnation으로 시작하도록 시각에서 출발
+    incarnation_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+GossipMembership::~GossipMembership() {
+    stop();
+}
+
+void GossipMembership::set_load_provider(LoadProvider provider) {
+    load_provider_ = std::move(provider);
+}
+
+void GossipMembership::set_listener(MemberListener listener) {
+    listener_ = std::move(listener);
+}
+
+void GossipMembership::attach_load_balancer(network::LoadBalancer* balancer) {
+    load_balancer_ = balancer;
+}
+
+std::optional<boost::asio::ip::udp::endpoint> GossipMembership::resolve(const std::string& address) {
+    const auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return std::nullopt;
+    }
+
+    boost::system::error_code ec;
+    udp::resolver resolver(io_context_);
+    auto results = resolver.resolve(udp::v4(), address.substr(0, colon), address.substr(colon + 1), ec);
+    if (ec || results.empty()) {
+        LOG_WARNING("Cannot resolve gossip address {}: {}", address, ec.message());
+        return std::nullopt;
+    }
+    return results.begin()->endpoint();
+}
+
+bool GossipMembership::start() {
+    if (thread_.joinable()) {
+        return true;
+    }
+
+    auto bind_endpoint = resolve(options_.bind_address);
+    boost::system::error_code ec;
+    if (bind_endpoint) {
+        socket_.open(bind_endpoint->protocol(), ec);
+        if (!ec) {
+            socket_.bind(*bind_endpoint, ec);
+        }
+    }
+    if (!bind_endpoint || ec) {
+        LOG_ERROR("Failed to bind gossip socket on {}: {}", options_.bind_address, ec.message());
+        socket_.close(ec);
+        return false;
+    }
+    bound_port_ = socket_.local_endpoint().port();
+
+    // 포트 0으로 바인드한 경우 실제 포트를 알림
+    advertise_address_ = options_.bind_address.substr(0, options_.bind_address.rfind(':')) + ":" +
+                         std::to_string(bound_port_);
+
+    seed_endpoints_.clear();
+    for (const auto& seed : options_.seeds) {
+        if (auto endpoint = resolve(seed); endpoint && endpoint->port() != bound_port_) {
+            seed_endpoints_.push_back(*endpoint);
+        }
+    }
+
+    if (load_provider_) {
+        self_load_ = load_provider_();
+    }
+    notify(self_info());
+    flush_notifications();
+
+    io_context_.restart();
+    start_receive();
+    boost::asio::post(io_context_, [this]() { on_period(); });
+    thread_ = std::thread([this]() { io_context_.run(); });
+
+    LOG_INFO("Gossip membership for node {} listening on UDP port {}", options_.node_id, bound_port_);
+    return true;
+}
+
+void GossipMembership::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    io_context_.stop();
+    thread_.join();
+
+    boost::system::error_code ec;
+    period_timer_.cancel();
+    probe_timer_.cancel();
+    socket_.close(ec);
+    LOG_INFO("Gossip membership for node {} stopped", options_.node_id);
+}
+
+void GossipMembership::leave() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    // 가십 스레드에서 자신의 DEAD를 살아 있는 멤버 전원에게 직접 알림
+    std::promise<void> sent;
+    boost::asio::post(io_context_, [this, &sent]() {
+        GossipMessage message;
+        message.set_type(GossipMessage::PING);
+        message.set_sequence(next_sequence_++);
+        message.set_sender_id(options_.node_id);
+
+        auto* self = message.add_members();
+        fill_self(*self);
+        self->set_state(GossipMember::DEAD);
+
+        std::string bytes = message.SerializeAsString();
+        boost::system::error_code ec;
+        std::lock_guard<std::mutex> lock(members_mutex_);
+        for (const auto& [node_id, member] : members_) {
+            if (member.info.state != MemberState::DEAD) {
+                socket_.send_to(boost::asio::buffer(bytes), member.endpoint, 0, ec);
+            }
+        }
+        sent.set_value();
+    });
+    sent.get_future().wait();
+
+    LOG_INFO("Node {} left the cluster", options_.node_id);
+    stop();
+}
+
+std::vector<MemberInfo> GossipMembership::get_members() const {
+    std::lock_guard<std::mutex> lock(members_mutex_);
+    std::vector<MemberInfo> members;
+    members.reserve(members_.size() + 1);
+    for (const auto& [node_id, member] : members_) {
+        members.push_back(member.info);
+    }
+
+    members.push_back(self_info());
+    return members;
+}
+
+std::optional<MemberInfo> GossipMembership::get_member(const std::string& node_id) const {
+    for (auto& member : get_members()) {
+        if (member.node_id == node_id) {
+            return member;
+        }
+    }
+    return std::nullopt;
+}
+
+size_t GossipMembership::get_alive_count() const {
+    std::lock_guard<std::mutex> lock(members_mutex_);
+    size_t alive = 1;
+    for (const auto& [node_id, member] : members_) {
+        if (member.info.state == MemberState::ALIVE) {
+            ++alive;
+        }
+    }
+    return alive;
+}
+
+void GossipMembership::schedule_period() {
+    period_timer_.expires_after(options_.protocol_period);
+    period_timer_.async_wait([this](const boost::system::error_code& ec) {
+        if (!ec) {
+            on_period();
+        }
+    });
+}
+
+void GossipMembership::on_period() {
+    {
+        std::lock_guard<std::mutex> lock(members_mutex_);
+
+        // 지난 주기의 탐지가 직접/간접 모두 실패했으면 의심
+        if (probe_.active && !probe_.acked) {
+            auto it = members_.find(probe_.target_id);
+            if (it != members_.end() && it->second.info.state == MemberState::ALIVE) {
+                LOG_INFO("Gossip: suspecting {} (no ack within {} ms)",
+                         probe_.target_id, options_.protocol_period.count());
+                set_state(it->second, MemberState::SUSPECT, it->second.info.incarnation);
+            }
+        }
+        probe_.active = false;
+
+        ++heartbeat_;
+        if (load_provider_) {
+            self_load_ = load_provider_();
+        }
+        notify(self_info());
+
+        expire_members();
+    }
+
+    // 아직 아무도 모르면 시드에 PING (합류)
+    bool has_members = false;
+    {
+        std::lock_guard<std::mutex> lock(members_mutex_);
+        has_members = !members_.empty();
+    }
+    if (!has_members) {
+        for (const auto& seed : seed_endpoints_) {
+            send_ping(seed, {}, next_sequence_++);
+        }
+    }
+
+    if (auto target = next_probe_target()) {
+        udp::endpoint endpoint;
+        {
+            std::lock_guard<std::mutex> lock(members_mutex_);
+            endpoint = members_.at(*target).endpoint;
+        }
+
+        probe_ = Probe{*target, next_sequence_++, true, false};
+        send_ping(endpoint, *target, probe_.sequence);
+
+        const uint64_t sequence = probe_.sequence;
+        probe_timer_.expires_after(options_.ping_timeout);
+        probe_timer_.async_wait([this, sequence](const boost::system::error_code& ec) {
+            if (!ec) {
+                on_probe_timeout(sequence);
+            }
+        });
+    }
+
+    // 오래된 간접 탐지 중계 정리
+    const auto now = Clock::now();
+    for (auto it = relays_.begin(); it != relays_.end();) {
+        it = it->second.expires_at < now ? relays_.erase(it) : std::next(it);
+    }
+
+    flush_notifications();
+    schedule_period();
+}
+
+void GossipMembership::on_probe_timeout(uint64_t sequence) {
+    if (!probe_.active || probe_.acked || probe_.sequence != sequence) {
+        return;
+    }
+
+    // 직접 PING 실패: 다른 멤버에게 간접 탐지 요청
+    std::vector<udp::endpoint> helpers;
+    std::string target_address;
+    {
+        std::lock_guard<std::mutex> lock(members_mutex_);
+        auto target = members_.find(probe_.target_id);
+        if (target == members_.end()) {
+            return;
+        }
+        target_address = target->second.info.gossip_address;
+
+        for (const auto& [node_id, member] : members_) {
+            if (node_id != probe_.target_id && member.info.state == MemberState::ALIVE) {
+                helpers.push_back(member.endpoint);
+            }
+        }
+    }
+
+    std::shuffle(helpers.begin(), helpers.end(), random_);
+    helpers.resize(std::min<size_t>(helpers.size(), options_.indirect_probes));
+
+    for (const auto& helper : helpers) {
+        GossipMessage message;
+        message.set_type(GossipMessage::PING_REQ);
+        message.set_sequence(sequence);
+        message.set_sender_id(options_.node_id);
+        message.set_target_id(probe_.target_id);
+        message.set_target_address(target_address);
+        send(message, helper);
+    }
+}
+
+void GossipMembership::start_receive() {
+    socket_.async_receive_from(
+        boost::asio::buffer(receive_buffer_), receive_from_,
+        [this](const boost::system::error_code& ec, size_t bytes) {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+            if (!ec) {
+                on_receive(bytes);
+            }
+            start_receive();
+        });
+}
+
+void GossipMembership::on_receive(size_t bytes) {
+    GossipMessage message;
+    if (!message.ParseFromArray(receive_buffer_.data(), static_cast<int>(bytes))) {
+        LOG_WARNING("Malformed gossip datagram from {} ({} bytes)", receive_from_.address().to_string(), bytes);
+        return;
+    }
+
+    handle_message(message, receive_from_);
+    flush_notifications();
+}
+
+void GossipMembership::handle_message(const GossipMessage& message, const udp::endpoint& from) {
+    {
+        std::lock_guard<std::mutex> lock(members_mutex_);
+        for (const auto& update : message.members()) {
+            merge(update);
+        }
+    }
+
+    switch (message.type()) {
+        case GossipMessage::PING: {
+            GossipMessage ack;
+            ack.set_type(GossipMessage::ACK);
+            ack.set_sequence(message.sequence());
+            ack.set_sender_id(options_.node_id);
+            send(ack, from);
+            break;
+        }
+
+        case GossipMessage::ACK: {
+            if (probe_.active && message.sequence() == probe_.sequence) {
+                probe_.acked = true;
+                break;
+            }
+            // 간접 탐지 중계 응답이면 요청자에게 전달
+            auto relay = relays_.find(message.sequence());
+            if (relay != relays_.end()) {
+                GossipMessage forwarded;
+                forwarded.set_type(GossipMessage::ACK);
+                forwarded.set_sequence(relay->second.requester_sequence);
+                forwarded.set_sender_id(options_.node_id);
+                send(forwarded, relay->second.requester);
+                relays_.erase(relay);
+            }
+            break;
+        }
+
+        case GossipMessage::PING_REQ: {
+            auto target = resolve(message.target_address());
+            if (!target) {
+                break;
+            }
+            const uint64_t sequence = next_sequence_++;
+            relays_[sequence] = Relay{from, message.sequence(), Clock::now() + options_.protocol_period};
+            send_ping(*target, message.target_id(), sequence);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void GossipMembership::send_ping(const udp::endpoint& to, const std::string& target_id, uint64_t sequence) {
+    GossipMessage message;
+    message.set_type(GossipMessage::PING);
+    message.set_sequence(sequence);
+    message.set_sender_id(options_.node_id);
+    message.set_target_id(target_id);
+    send(message, to);
+}
+
+void GossipMembership::send(GossipMessage& message, const udp::endpoint& to) {
+    fill_piggyback(message);
+
+    std::string bytes = message.SerializeAsString();
+    boost::system::error_code ec;
+    socket_.send_to(boost::asio::buffer(bytes), to, 0, ec);
+    if (ec) {
+        LOG_DEBUG("Gossip send to {}:{} failed: {}", to.address().to_string(), to.port(), ec.message());
+    }
+}
+
+MemberInfo GossipMembership::self_info() const {
+    MemberInfo self;
+    self.node_id = options_.node_id;
+    self.gossip_address = advertise_address_;
+    self.service_host = options_.service_host;
+    self.service_port = options_.service_port;
+    self.incarnation = incarnation_;
+    self.heartbeat = heartbeat_;
+    self.load = self_load_;
+    return self;
+}
+
+void GossipMembership::fill_self(GossipMember& member) const {
+    to_proto(self_info(), member);
+}
+
+void GossipMembership::fill_piggyback(GossipMessage& message) {
+    // 자신은 항상 포함 (heartbeat와 부하 전파)
+    fill_self(*message.add_members());
+
+    std::lock_guard<std::mutex> lock(members_mutex_);
+
+    // 재전파할 상태 변화가 남은 멤버 우선, 나머지는 가장 오래 전에 실어 보낸 순서
+    std::vector<Member*> candidates;
+    candidates.reserve(members_.size());
+    for (auto& [node_id, member] : members_) {
+        candidates.push_back(&member);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Member* a, const Member* b) {
+        if ((a->transmits_left > 0) != (b->transmits_left > 0)) {
+            return a->transmits_left > 0;
+        }
+        return a->last_piggybacked < b->last_piggybacked;
+    });
+
+    uint32_t added = 0;
+    for (Member* member : candidates) {
+        if (added >= options_.max_piggyback || message.ByteSizeLong() >= kMaxDatagramSize) {
+            break;
+        }
+        to_proto(member->info, *message.add_members());
+        member->last_piggybacked = ++piggyback_clock_;
+        if (member->transmits_left > 0) {
+            --member->transmits_left;
+        }
+        ++added;
+    }
+}
+
+uint32_t GossipMembership::retransmit_limit() const {
+    return kRetransmitMultiplier * static_cast<uint32_t>(std::bit_width(members_.size() + 1));
+}
+
+void GossipMembership::set_state(Member& member, MemberState state, uint64_t incarnation) {
+    const bool changed = member.info.state != state;
+    member.info.state = state;
+    member.info.incarnation = incarnation;
+    member.state_changed_at = Clock::now();
+    member.transmits_left = retransmit_limit();
+
+    if (changed) {
+        LOG_INFO("Gossip: {} is now {} (incarnation {})", member.info.node_id, to_string(state), incarnation);
+    }
+    notify(member.info);
+}
+
+void GossipMembership::refute(uint64_t incarnation) {
+    // 자신에 대한 의심/사망 소문은 더 높은 incarnation의 ALIVE로 덮음 (자신은 항상 피기백됨)
+    if (incarnation >= incarnation_) {
+        incarnation_ = incarnation + 1;
+        LOG_INFO("Gossip: refuting suspicion of {} with incarnation {}", options_.node_id, incarnation_);
+    }
+}
+
+void GossipMembership::merge(const GossipMember& update) {
+    if (update.node_id().empty()) {
+        return;
+    }
+
+    const MemberState state = from_proto(update.state());
+    if (update.node_id() == options_.node_id) {
+        if (state != MemberState::ALIVE) {
+            refute(update.incarnation());
+        }
+        return;
+    }
+
+    auto it = members_.find(update.node_id());
+    if (it == members_.end()) {
+        if (state == MemberState::DEAD) {
+            return;
+        }
+        auto endpoint = resolve(update.gossip_address());
+        if (!endpoint) {
+            return;
+        }
+
+        Member member;
+        member.endpoint = *endpoint;
+        member.info.node_id = update.node_id();
+        member.info.gossip_address = update.gossip_address();
+        member.info.service_host = update.service_host();
+        member.info.service_port = static_cast<uint16_t>(update.service_port());
+        copy_load(update, member.info);
+
+        it = members_.emplace(update.node_id(), std::move(member)).first;
+        LOG_INFO("Gossip: discovered {} at {}", update.node_id(), update.gossip_address());
+        set_state(it->second, state, update.incarnation());
+        return;
+    }
+
+    Member& member = it->second;
+    const uint64_t known = member.info.incarnation;
+    const MemberState current = member.info.state;
+
+    // DEAD 이후에는 더 높은 incarnation(재시작)만 되살림
+    if (current == MemberState::DEAD && update.incarnation() <= known) {
+        return;
+    }
+
+    switch (state) {
+        case MemberState::ALIVE:
+            if (update.incarnation() > known) {
+                if (update.gossip_address() != member.info.gossip_address) {
+                    if (auto endpoint = resolve(update.gossip_address())) {
+                        member.endpoint = *endpoint;
+                        member.info.gossip_address = update.gossip_address();
+                    }
+                }
+                copy_load(update, member.info);
+                set_state(member, MemberState::ALIVE, update.incarnation());
+            } else if (update.incarnation() == known && update.heartbeat() > member.info.heartbeat) {
+                // 상태는 그대로, 부하 정보만 갱신
+                copy_load(update, member.info);
+                notify(member.info);
+            }
+            break;
+
+        case MemberState::SUSPECT:
+            if (update.incarnation() > known || (update.incarnation() == known && current == MemberState::ALIVE)) {
+                set_state(member, MemberState::SUSPECT, update.incarnation());
+            }
+            break;
+
+        case MemberState::DEAD:
+            if (update.incarnation() >= known) {
+                set_state(member, MemberState::DEAD, update.incarnation());
+            }
+            break;
+    }
+}
+
+void GossipMembership::expire_members() {
+    const auto now = Clock::now();
+    for (auto it = members_.begin(); it != members_.end();) {
+        Member& member = it->second;
+        if (member.info.state == MemberState::SUSPECT && now - member.state_changed_at >= options_.suspect_timeout) {
+            set_state(member, MemberState::DEAD, member.info.incarnation);
+        } else if (member.info.state == MemberState::DEAD && now - member.state_changed_at >= options_.dead_retention) {
+            it = members_.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+std::optional<std::string> GossipMembership::next_probe_target() {
+    std::lock_guard<std::mutex> lock(members_mutex_);
+
+    // 무작위 순서로 한 바퀴씩 돌며 탐지 (모든 멤버가 유한 시간 안에 탐지됨)
+    for (size_t attempts = 0; attempts < 2; ++attempts) {
+        while (probe_index_ < probe_order_.size()) {
+            const std::string& candidate = probe_order_[probe_index_++];
+            auto it = members_.find(candidate);
+            if (it != members_.end() && it->second.info.state != MemberState::DEAD) {
+                return candidate;
+            }
+        }
+
+        probe_order_.clear();
+        for (const auto& [node_id, member] : members_) {
+            probe_order_.push_back(node_id);
+        }
+        std::shuffle(probe_order_.begin(), probe_order_.end(), random_);
+        probe_index_ = 0;
+    }
+    return std::nullopt;
+}
+
+void GossipMembership::notify(const MemberInfo& member) {
+    pending_notifications_.push_back(member);
+}
+
+void GossipMembership::flush_notifications() {
+    // 멤버 잠금 밖에서 리스너와 LoadBalancer 갱신
+    std::vector<MemberInfo> notifications;
+    notifications.swap(pending_notifications_);
+
+    for (const auto& member : notifications) {
+        notify_load_balancer(member);
+        if (listener_) {
+            listener_(member);
+        }
+    }
+}
+
+void GossipMembership::notify_load_balancer(const MemberInfo& member) {
+    if (!load_balancer_) {
+        return;
+    }
+
+    switch (member.state) {
+        case MemberState::ALIVE:
+        case MemberState::SUSPECT: {
+            if (!load_balancer_->has_server(member.node_id)) {
+                load_balancer_->add_server(member.node_id, member.service_host, member.service_port,
+                                           member.load.max_connections);
+            }
+            load_balancer_->update_server_load(member.node_id, member.load.cpu_usage, member.load.memory_usage,
+                                               member.load.connections, member.state == MemberState::ALIVE);
+            break;
+        }
+        case MemberState::DEAD:
+            load_balancer_->remove_server(member.node_id);
+            break;
+    }
+}
+
+} // namespace mmorpg::cluster
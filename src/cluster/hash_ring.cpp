@@ -0,0 +1,89 @@
+#include "cluster/hash_ring.hpp"
+#include <algorithm>
+
+namespace mmorpg::cluster {
+
+namespace {
+
+// splitmix64 finalizer - 연속된 player_id도 링 전체에 고르게 흩어지도록
+uint64_t mix(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+// FNV-1a (노드 ID는 모든 노드에서 같은 점 위치를 가져야 하므로 std::hash를 쓰지 않음)
+uint64_t hash_string(const std::string& value) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : value) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+} // namespace
+
+HashRing::HashRing(uint32_t virtual_nodes)
+    : virtual_nodes_(std::max<uint32_t>(virtual_nodes, 1)) {
+}
+
+bool HashRing::add_node(const std::string& node_id) {
+    auto it = std::lower_bound(nodes_.begin(), nodes_.end(), node_id);
+    if (it != nodes_.end() && *it == node_id) {
+        return false;
+    }
+    nodes_.insert(it, node_id);
+    rebuild();
+    return true;
+}
+
+bool HashRing::remove_node(const std::string& node_id) {
+    auto it = std::lower_bound(nodes_.begin(), nodes_.end(), node_id);
+    if (it == nodes_.end() || *it != node_id) {
+        return false;
+    }
+    nodes_.erase(it);
+    rebuild();
+    return true;
+}
+
+bool HashRing::contains(const std::string& node_id) const {
+    return std::binary_search(nodes_.begin(), nodes_.end(), node_id);
+}
+
+std::optional<std::string> HashRing::owner(uint64_t key) const {
+    if (points_.empty()) {
+        return std::nullopt;
+    }
+
+    const uint64_t hash = mix(key);
+    auto it = std::lower_bound(points_.begin(), points_.end(), hash,
+                               [](const Point& point, uint64_t value) { return point.hash < value; });
+    if (it == points_.end()) {
+        it = points_.begin();
+    }
+    return nodes_[it->node_index];
+}
+
+std::vector<std::string> HashRing::get_nodes() const {
+    return nodes_;
+}
+
+void HashRing::rebuild() {
+    points_.clear();
+    points_.reserve(nodes_.size() * virtual_nodes_);
+    for (uint32_t index = 0; index < nodes_.size(); ++index) {
+        const uint64_t base = hash_string(nodes_[index]);
+        for (uint32_t replica = 0; replica < virtual_nodes_; ++replica) {
+            points_.push_back({mix(base + replica), index});
+        }
+    }
+    // 해시가 겹치면 노드 ID 순으로 결정 (모든 노드에서 같은 결과)
+    std::sort(points_.begin(), points_.end(), [](const Point& lhs, const Point& rhs) {
+        return lhs.hash != rhs.hash ? lhs.hash < rhs.hash : lhs.node_index < rhs.node_index;
+    });
+}
+
+} // namespace mmorpg::cluster
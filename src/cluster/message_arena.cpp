@@ -0,0 +1,58 @@
+#include "cluster/message_arena.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace mmorpg::cluster {
+
+MessageArena::MessageArena(size_t initial_block_size, size_t max_initial_block_size)
+    : initial_block_size_(initial_block_size)
+    , max_initial_block_size_(std::max(initial_block_size, max_initial_block_size)) {
+    rebuild(initial_block_size_);
+}
+
+void MessageArena::rebuild(size_t initial_block_size) {
+    // Arena가 블록을 참조하므로 Arena를 먼저 파괴
+    arena_.reset();
+
+    initial_block_size_ = initial_block_size;
+    char* block = nullptr;
+    if (initial_block_size_ >= common::HugePageRegion::kHugePageSize &&
+        common::memory_placement().huge_pages != common::HugePageMode::OFF) {
+        initial_block_.reset();
+        huge_initial_block_ = common::HugePageRegion(initial_block_size_);
+        block = huge_initial_block_.data();
+    }
+    if (!block) {
+        huge_initial_block_ = common::HugePageRegion();
+        initial_block_ = std::make_unique<char[]>(initial_block_size_);
+        block = initial_block_.get();
+    }
+
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = initial_block_size_;
+    options.start_block_size = std::min<size_t>(initial_block_size_, 64 * 1024);
+    options.max_block_size = std::max<size_t>(initial_block_size_, 1024 * 1024);
+    arena_.emplace(options);
+}
+
+uint64_t MessageArena::reset() {
+    const uint64_t used = arena_->SpaceUsed();
+    const uint64_t allocated = arena_->Reset();
+    high_water_mark_ = std::max(high_water_mark_, used);
+
+    if (allocated > initial_block_size_) {
+        ++overflow_count_;
+
+        // 다음 배치가 첫 블록 안에 들어오도록 키움 (Arena 블록 헤더 여유분 포함)
+        const size_t wanted = std::bit_ceil(static_cast<size_t>(allocated));
+        const size_t next = std::min(wanted, max_initial_block_size_);
+        if (next > initial_block_size_) {
+            rebuild(next);
+        }
+    }
+
+    return used;
+}
+
+} // namespace mmorpg::cluster
@@ -0,0 +1,447 @@
+#include "cluster/player_directory.hpp"
+#include "cluster/cluster_transport.hpp"
+#include "cluster/gossip_membership.hpp"
+#include <algorithm>
+
+namespace mmorpg::cluster {
+
+namespace {
+
+uint64_t now_us() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+PlayerDirectory::PlayerDirectory(ClusterTransport& transport, DirectoryOptions options)
+    : transport_(transport)
+    , options_(options)
+    , node_id_(transport.get_node_id())
+    , cache_memory_(common::MemoryRegistry::instance().account(options_.memory_owner, common::MemoryCategory::CACHES))
+    , ring_(options.virtual_nodes)
+    , cache_(0, std::hash<uint64_t>{}, std::equal_to<uint64_t>{}, CacheMap::allocator_type(&cache_memory_))
+    , cache_lru_(CacheLru::allocator_type(&cache_memory_)) {
+    ring_.add_node(node_id_);
+    pressure_listener_ = common::MemoryRegistry::instance().add_pressure_listener(
+        options_.memory_owner, common::MemoryCategory::CACHES,
+        [this](const common::MemoryAccount& account) { on_memory_pressure(account); });
+}
+
+PlayerDirectory::~PlayerDirectory() {
+    common::MemoryRegistry::instance().remove_pressure_listener(pressure_listener_);
+}
+
+void PlayerDirectory::on_login(uint64_t player_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& player = local_players_[player_id];
+    player.version = now_us();
+    cache_erase_locked(player_id, player.version);
+    publish_locked(player_id, player, true);
+}
+
+void PlayerDirectory::on_logout(uint64_t player_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = local_players_.find(player_id);
+    if (it == local_players_.end()) {
+        return;
+    }
+    it->second.version = now_us();
+    publish_locked(player_id, it->second, false);
+    local_players_.erase(it);
+}
+
+void PlayerDirectory::on_batch(const ClusterBatch& batch) {
+    const std::string& source = batch.source_node();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& message : batch.messages()) {
+        switch (message.body_case()) {
+            case ClusterMessage::kDirectoryUpdate: {
+                const auto& update = message.directory_update();
+                apply_update_locked(update.player_id(), update.node_id(), update.online(), update.version());
+                break;
+            }
+            case ClusterMessage::kDirectoryQuery: {
+                const uint64_t player_id = message.directory_query().player_id();
+                Outgoing reply{Outgoing::Kind::REPLY, source, player_id};
+                auto it = shard_.find(player_id);
+                if (it != shard_.end()) {
+                    reply.node_id = it->second.node_id;
+                    reply.version = it->second.version;
+                    subscribe_locked(it->second, source);
+                }
+                outbox_.push_back(std::move(reply));
+                break;
+            }
+            case ClusterMessage::kDirectoryReply: {
+                const auto& reply = message.directory_reply();
+                std::optional<std::string> node_id;
+                if (!reply.node_id().empty()) {
+                    node_id = reply.node_id();
+                    cache_put_locked(reply.player_id(), reply.node_id(), reply.version());
+                }
+                complete_locked(reply.player_id(), node_id);
+                break;
+            }
+            case ClusterMessage::kDirectoryInvalidate: {
+                const auto& invalidate = message.directory_invalidate();
+                ++stats_.invalidations_received;
+                cache_erase_locked(invalidate.player_id(), invalidate.version());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+void PlayerDirectory::on_member(const MemberInfo& member) {
+    if (member.node_id == node_id_) {
+        return;
+    }
+
+    switch (member.state) {
+        case MemberState::ALIVE:
+            add_node(member.node_id);
+            break;
+        case MemberState::DEAD:
+            remove_node(member.node_id);
+            break;
+        case MemberState::SUSPECT:
+            // 반박될 수 있으므로 소유권을 옮기지 않음
+            break;
+    }
+}
+
+void PlayerDirectory::add_node(const std::string& node_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ring_.add_node(node_id)) {
+        rebalance_locked();
+    }
+}
+
+void PlayerDirectory::remove_node(const std::string& node_id) {
+    if (node_id == node_id_) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ring_.remove_node(node_id)) {
+        drop_node_locked(node_id);
+        rebalance_locked();
+    }
+}
+
+std::optional<std::string> PlayerDirectory::locate(uint64_t player_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return locate_locked(player_id);
+}
+
+void PlayerDirectory::lookup(uint64_t player_id, LookupCallback callback) {
+    std::optional<std::string> node_id;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        node_id = locate_locked(player_id);
+        const auto owner = ring_.owner(player_id);
+        if (!node_id && owner && *owner != node_id_ && transport_.has_peer(*owner)) {
+            auto [it, inserted] = pending_lookups_.try_emplace(player_id);
+            it->second.callbacks.push_back(std::move(callback));
+            if (inserted) {
+                // 같은 플레이어에 대한 동시 조회는 질의 하나로 합침
+                it->second.deadline = Clock::now() + options_.query_timeout;
+                outbox_.push_back({Outgoing::Kind::QUERY, *owner, player_id});
+                ++stats_.queries_sent;
+            }
+            return;
+        }
+    }
+    callback(player_id, node_id);
+}
+
+void PlayerDirectory::poll() {
+    std::vector<Outgoing> outgoing;
+    std::vector<Completion> completions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto now = Clock::now();
+        for (auto it = pending_lookups_.begin(); it != pending_lookups_.end();) {
+            if (it->second.deadline <= now) {
+                ++stats_.query_timeouts;
+                completions_.push_back({it->first, std::nullopt, std::move(it->second.callbacks)});
+                it = pending_lookups_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        outgoing.swap(outbox_);
+        completions.swap(completions_);
+    }
+
+    uint64_t unroutable = 0;
+    const uint64_t sent_at = now_us();
+    for (const auto& out : outgoing) {
+        ClusterMessage* message = transport_.add_message(out.to);
+        if (!message) {
+            ++unroutable;
+            continue;
+        }
+        message->set_sent_at_us(sent_at);
+
+        switch (out.kind) {
+            case Outgoing::Kind::UPDATE: {
+                auto* update = message->mutable_directory_update();
+                update->set_player_id(out.player_id);
+                update->mutable_node_id()->assign(out.node_id);
+                update->set_online(out.online);
+                update->set_version(out.version);
+                break;
+            }
+            case Outgoing::Kind::QUERY:
+                message->mutable_directory_query()->set_player_id(out.player_id);
+                break;
+            case Outgoing::Kind::REPLY: {
+                auto* reply = message->mutable_directory_reply();
+                reply->set_player_id(out.player_id);
+                reply->mutable_node_id()->assign(out.node_id);
+                reply->set_version(out.version);
+                break;
+            }
+            case Outgoing::Kind::INVALIDATE: {
+                auto* invalidate = message->mutable_directory_invalidate();
+                invalidate->set_player_id(out.player_id);
+                invalidate->set_version(out.version);
+                break;
+            }
+        }
+    }
+
+    if (unroutable > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.unroutable += unroutable;
+    }
+
+    for (auto& completion : completions) {
+        for (auto& callback : completion.callbacks) {
+            callback(completion.player_id, completion.node_id);
+        }
+    }
+}
+
+std::optional<std::string> PlayerDirectory::get_owner(uint64_t player_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ring_.owner(player_id);
+}
+
+size_t PlayerDirectory::shrink_cache(size_t max_entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return shrink_cache_locked(max_entries);
+}
+
+void PlayerDirectory::on_memory_pressure(const common::MemoryAccount& account) {
+    const size_t bytes = account.get_bytes();
+    if (bytes == 0) {
+        return;
+    }
+
+    // 계정을 여러 디렉터리가 공유할 수 있으므로 각자 같은 비율로 줄임
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t target = cache_.size() * (account.get_budget() / 4 * 3) / bytes;
+    const size_t evicted = shrink_cache_locked(target);
+    stats_.pressure_evictions += evicted;
+}
+
+DirectoryStats PlayerDirectory::get_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    DirectoryStats stats = stats_;
+    stats.local_players = local_players_.size();
+    stats.owned_entries = shard_.size();
+    stats.cached_entries = cache_.size();
+    stats.ring_nodes = ring_.size();
+    return stats;
+}
+
+std::optional<std::string> PlayerDirectory::locate_locked(uint64_t player_id) {
+    if (local_players_.count(player_id) > 0) {
+        return node_id_;
+    }
+
+    // 자기 샤드는 권위 있는 정보이므로 없으면 접속 중이 아님
+    if (ring_.owner(player_id) == node_id_) {
+        auto it = shard_.find(player_id);
+        if (it == shard_.end()) {
+            return std::nullopt;
+        }
+        return it->second.node_id;
+    }
+
+    auto it = cache_.find(player_id);
+    if (it == cache_.end()) {
+        ++stats_.cache_misses;
+        return std::nullopt;
+    }
+    ++stats_.cache_hits;
+    cache_lru_.splice(cache_lru_.begin(), cache_lru_, it->second.lru);
+    return it->second.node_id;
+}
+
+void PlayerDirectory::publish_locked(uint64_t player_id, LocalPlayer& player, bool online) {
+    const auto owner = ring_.owner(player_id);
+    player.published_to = owner.value_or(std::string());
+
+    if (owner == node_id_) {
+        apply_update_locked(player_id, node_id_, online, player.version);
+        return;
+    }
+    outbox_.push_back({Outgoing::Kind::UPDATE, *owner, player_id, node_id_, online, player.version});
+    ++stats_.updates_sent;
+}
+
+void PlayerDirectory::apply_update_locked(uint64_t player_id, const std::string& node_id, bool online,
+                                          uint64_t version) {
+    auto it = shard_.find(player_id);
+
+    if (!online) {
+        // 이미 다른 노드로 옮겨 간 뒤 도착한 이전 노드의 로그아웃은 무시
+        if (it == shard_.end() || it->second.node_id != node_id || version < it->second.version) {
+            return;
+        }
+        it->second.version = version;
+        invalidate_subscribers_locked(player_id, it->second);
+        shard_.erase(it);
+        return;
+    }
+
+    if (it == shard_.end()) {
+        shard_.emplace(player_id, ShardEntry{node_id, version, {}});
+        return;
+    }
+    if (version < it->second.version) {
+        return;
+    }
+    if (it->second.node_id != node_id) {
+        // 다른 노드로 이동 - 이전 위치를 캐시한 노드에 무효화
+        it->second.version = version;
+        invalidate_subscribers_locked(player_id, it->second);
+        it->second.node_id = node_id;
+    }
+    it->second.version = version;
+}
+
+void PlayerDirectory::subscribe_locked(ShardEntry& entry, const std::string& node_id) {
+    if (std::find(entry.subscribers.begin(), entry.subscribers.end(), node_id) == entry.subscribers.end()) {
+        entry.subscribers.push_back(node_id);
+    }
+}
+
+void PlayerDirectory::invalidate_subscribers_locked(uint64_t player_id, ShardEntry& entry) {
+    for (const auto& subscriber : entry.subscribers) {
+        if (subscriber == node_id_) {
+            cache_erase_locked(player_id, entry.version);
+            continue;
+        }
+        outbox_.push_back({Outgoing::Kind::INVALIDATE, subscriber, player_id, {}, false, entry.version});
+        ++stats_.invalidations_sent;
+    }
+    entry.subscribers.clear();
+}
+
+void PlayerDirectory::cache_put_locked(uint64_t player_id, const std::string& node_id, uint64_t version) {
+    if (options_.cache_capacity == 0) {
+        return;
+    }
+
+    auto it = cache_.find(player_id);
+    if (it != cache_.end()) {
+        // 응답보다 먼저 도착한 무효화(더 새로운 version)를 되돌리지 않음
+        if (version < it->second.version) {
+            return;
+        }
+        it->second.node_id = node_id;
+        it->second.version = version;
+        cache_lru_.splice(cache_lru_.begin(), cache_lru_, it->second.lru);
+        return;
+    }
+
+    if (cache_.size() >= options_.cache_capacity) {
+        cache_.erase(cache_lru_.back());
+        cache_lru_.pop_back();
+    }
+    cache_lru_.push_front(player_id);
+    cache_.emplace(player_id, CacheEntry{node_id, version, cache_lru_.begin()});
+}
+
+void PlayerDirectory::cache_erase_locked(uint64_t player_id, uint64_t version) {
+    auto it = cache_.find(player_id);
+    if (it == cache_.end() || it->second.version > version) {
+        return;
+    }
+    cache_lru_.erase(it->second.lru);
+    cache_.erase(it);
+}
+
+size_t PlayerDirectory::shrink_cache_locked(size_t max_entries) {
+    size_t evicted = 0;
+    while (cache_.size() > max_entries) {
+        cache_.erase(cache_lru_.back());
+        cache_lru_.pop_back();
+        ++evicted;
+    }
+    if (evicted != 0) {
+        cache_.rehash(0);   // 버킷 배열도 남은 항목 수에 맞게 줄임
+    }
+    return evicted;
+}
+
+void PlayerDirectory::complete_locked(uint64_t player_id, const std::optional<std::string>& node_id) {
+    auto it = pending_lookups_.find(player_id);
+    if (it == pending_lookups_.end()) {
+        return;
+    }
+    completions_.push_back({player_id, node_id, std::move(it->second.callbacks)});
+    pending_lookups_.erase(it);
+}
+
+void PlayerDirectory::rebalance_locked() {
+    // 소유자가 바뀐 로컬 접속자를 새 소유 노드에 다시 알림
+    for (auto& [player_id, player] : local_players_) {
+        if (ring_.owner(player_id) != player.published_to) {
+            publish_locked(player_id, player, true);
+        }
+    }
+
+    // 더 이상 소유하지 않는 항목은 접속 노드가 새 소유자에게 다시 알리므로 버림
+    for (auto it = shard_.begin(); it != shard_.end();) {
+        if (ring_.owner(it->first) != node_id_) {
+            it = shard_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 구독 정보가 이전 소유자와 함께 사라지므로 캐시는 모두 비움 (모든 노드가 같은 변화를 처리)
+    cache_.clear();
+    cache_lru_.clear();
+}
+
+void PlayerDirectory::drop_node_locked(const std::string& node_id) {
+    for (auto it = shard_.begin(); it != shard_.end();) {
+        auto& subscribers = it->second.subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), node_id), subscribers.end());
+
+        if (it->second.node_id == node_id) {
+            invalidate_subscribers_locked(it->first, it->second);
+            it = shard_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace mmorpg::cluster
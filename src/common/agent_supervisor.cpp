@@ -0,0 +1,208 @@
+#include "common/agent_supervisor.hpp"
+#include "common/base_agent.hpp"
+#include "common/logger.hpp"
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace mmorpg::common {
+
+namespace {
+
+double seconds_since(std::chrono::steady_clock::time_point from) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - from).count();
+}
+
+} // namespace
+
+AgentSupervisor::AgentSupervisor(std::chrono::milliseconds ready_timeout)
+    : ready_timeout_(ready_timeout) {
+}
+
+bool AgentSupervisor::add(BaseAgent& agent, const std::vector<std::string>& dependencies) {
+    Component component;
+    component.name = agent.get_agent_id();
+    component.agent = &agent;
+    component.start = [&agent, timeout = ready_timeout_]() {
+        agent.start();
+        return agent.wait_ready(timeout);
+    };
+    component.stop = [&agent]() { agent.stop(); };
+    return add_component(std::move(component), dependencies);
+}
+
+bool AgentSupervisor::add(const std::string& name, StartFunction start, StopFunction stop,
+                          const std::vector<std::string>& dependencies) {
+    Component component;
+    component.name = name;
+    component.start = std::move(start);
+    component.stop = std::move(stop);
+    return add_component(std::move(component), dependencies);
+}
+
+bool AgentSupervisor::add_component(Component component, const std::vector<std::string>& dependencies) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (started_) {
+        LOG_ERROR("Cannot add {} after startup", component.name);
+        return false;
+    }
+
+    const auto find = [this](const std::string& name) {
+        return std::find_if(components_.begin(), components_.end(),
+                            [&](const Component& existing) { return existing.name == name; });
+    };
+    if (find(component.name) != components_.end()) {
+        LOG_ERROR("Duplicate startup component: {}", component.name);
+        return false;
+    }
+
+    for (const auto& dependency : dependencies) {
+        const auto it = find(dependency);
+        if (it == components_.end()) {
+            LOG_ERROR("{} depends on unregistered component {}", component.name, dependency);
+            return false;
+        }
+        const size_t index = static_cast<size_t>(it - components_.begin());
+        component.dependencies.push_back(index);
+        component.record.stage = std::max(component.record.stage, it->record.stage + 1);
+    }
+
+    component.record.name = component.name;
+    components_.push_back(std::move(component));
+    return true;
+}
+
+bool AgentSupervisor::start() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (started_) {
+            return false;
+        }
+        started_ = true;
+    }
+
+    const auto boot = std::chrono::steady_clock::now();
+
+    // 구성 요소마다 스레드 하나가 의존 대상 준비를 기다렸다가 시작 (부팅 시에만 쓰므로 풀 없이)
+    std::vector<std::thread> threads;
+    threads.reserve(components_.size());
+    for (size_t index = 0; index < components_.size(); ++index) {
+        threads.emplace_back([this, index, boot]() { run_component(index, boot); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    bool all_ready = true;
+    double serial_time = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        total_startup_time_ = seconds_since(boot);
+        for (const auto& component : components_) {
+            const auto& record = component.record;
+            serial_time += record.startup_time;
+            if (record.state == StartupState::READY) {
+                LOG_INFO("{} ready in {:.3f}s (stage {}, started at {:.3f}s)",
+                         record.name, record.startup_time, record.stage, record.started_at);
+            } else {
+                LOG_ERROR("{} {} during startup", record.name, to_string(record.state));
+                all_ready = false;
+            }
+        }
+    }
+
+    if (!all_ready) {
+        stop();
+        return false;
+    }
+
+    LOG_INFO("{} components ready in {:.3f}s (serial {:.3f}s)",
+             components_.size(), total_startup_time_, serial_time);
+    return true;
+}
+
+void AgentSupervisor::run_component(size_t index, std::chrono::steady_clock::time_point boot) {
+    Component& component = components_[index];
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        bool dependency_failed = false;
+        state_cv_.wait(lock, [&]() {
+            for (const size_t dependency : component.dependencies) {
+                const StartupState state = components_[dependency].record.state;
+                if (state == StartupState::FAILED || state == StartupState::SKIPPED) {
+                    dependency_failed = true;
+                    return true;
+                }
+                if (state != StartupState::READY) {
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        if (dependency_failed) {
+            component.record.state = StartupState::SKIPPED;
+            lock.unlock();
+            state_cv_.notify_all();
+            return;
+        }
+
+        component.record.state = StartupState::STARTING;
+        component.record.started_at = seconds_since(boot);
+        started_order_.push_back(index);
+    }
+
+    bool ready = false;
+    try {
+        ready = component.start();
+    } catch (const std::exception& e) {
+        LOG_ERROR("{} failed to start: {}", component.name, e.what());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& record = component.record;
+        record.ready_at = seconds_since(boot);
+        record.startup_time = record.ready_at - record.started_at;
+        record.state = ready ? StartupState::READY : StartupState::FAILED;
+    }
+    state_cv_.notify_all();
+
+    // 에이전트별 시작 시간은 MonitoringAgent가 다른 메트릭과 함께 노출
+    if (ready && component.agent) {
+        component.agent->update_metric("ready_time", component.record.startup_time);
+    }
+}
+
+void AgentSupervisor::stop() {
+    std::vector<size_t> order;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        order.swap(started_order_);
+    }
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        const Component& component = components_[*it];
+        if (component.stop) {
+            component.stop();
+        }
+    }
+}
+
+std::vector<StartupRecord> AgentSupervisor::get_startup_report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<StartupRecord> report;
+    report.reserve(components_.size());
+    for (const auto& component : components_) {
+        report.push_back(component.record);
+    }
+    return report;
+}
+
+double AgentSupervisor::get_total_startup_time() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_startup_time_;
+}
+
+} // namespace mmorpg::common
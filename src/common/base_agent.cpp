@@ -1,4 +1,6 @@
 #include "common/base_agent.hpp"
+#include <algorithm>
+#include <cctype>
 #include <stdexcept>
 
 namespace mmorpg::common {
@@ -12,6 +14,28 @@ bool BaseAgent::is_running() const noexcept {
     return running_.load(std::memory_order_acquire);
 }
 
+bool BaseAgent::is_ready() const noexcept {
+    return ready_.load(std::memory_order_acquire);
+}
+
+bool BaseAgent::wait_ready(std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(ready_mutex_);
+    return ready_cv_.wait_for(lock, timeout, [this]() { return ready_.load(std::memory_order_acquire); });
+}
+
+void BaseAgent::mark_ready() {
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready_.store(true, std::memory_order_release);
+    }
+    ready_cv_.notify_all();
+}
+
+void BaseAgent::clear_ready() {
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    ready_.store(false, std::memory_order_release);
+}
+
 const std::string& BaseAgent::get_agent_id() const noexcept {
     return agent_id_;
 }
@@ -38,13 +62,34 @@ const std::unordered_map<std::string, double>& BaseAgent::get_metrics() const {
     return metrics_;
 }
 
+MemoryAccount& BaseAgent::memory_account(MemoryCategory category) const {
+    return MemoryRegistry::instance().account(agent_id_, category);
+}
+
+std::unordered_map<std::string, double> BaseAgent::snapshot_metrics() const {
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    return metrics_;
+}
+
 std::unordered_map<std::string, std::string> BaseAgent::health_check() const {
     std::unordered_map<std::string, std::string> health;
     
     health["agent_id"] = agent_id_;
     health["is_running"] = running_.load(std::memory_order_acquire) ? "true" : "false";
+    health["is_ready"] = is_ready() ? "true" : "false";
     health["uptime_seconds"] = std::to_string(get_uptime().count());
     
+    for (const auto& usage : MemoryRegistry::instance().snapshot(agent_id_)) {
+        std::string prefix = std::string("memory_") + to_string(usage.category);
+        std::transform(prefix.begin(), prefix.end(), prefix.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        health[prefix + "_bytes"] = std::to_string(usage.bytes);
+        health[prefix + "_peak_bytes"] = std::to_string(usage.peak);
+        if (usage.budget != 0) {
+            health[prefix + "_budget_bytes"] = std::to_string(usage.budget);
+        }
+    }
+    
     // 메트릭 추가
     std::lock_guard<std::mutex> lock(metrics_mutex_);
     for (const auto& [key, value] : metrics_) {
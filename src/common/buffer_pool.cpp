@@ -0,0 +1,69 @@
+#include "common/buffer_pool.hpp"
+
+namespace mmorpg::common {
+
+void BufferPoolReturner::operator()(std::string* buffer) const noexcept {
+    if (pool) {
+        pool->release(buffer);
+    } else {
+        delete buffer;
+    }
+}
+
+BufferPool::BufferPool(size_t max_pooled, size_t max_retained_capacity)
+    : max_pooled_(max_pooled)
+    , max_retained_capacity_(max_retained_capacity) {
+    free_.reserve(max_pooled_);
+}
+
+BufferPool::~BufferPool() {
+    for (auto* buffer : free_) {
+        delete buffer;
+    }
+}
+
+PooledBuffer BufferPool::acquire(size_t reserve) {
+    std::string* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            buffer = free_.back();
+            free_.pop_back();
+        }
+    }
+
+    if (!buffer) {
+        buffer = new std::string();
+        created_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (buffer->capacity() < reserve) {
+        buffer->reserve(reserve);
+    }
+    return PooledBuffer(buffer, BufferPoolReturner{this});
+}
+
+void BufferPool::release(std::string* buffer) noexcept {
+    buffer->clear();
+
+    if (buffer->capacity() <= max_retained_capacity_) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.size() < max_pooled_) {
+            free_.push_back(buffer);
+            return;
+        }
+    }
+
+    delete buffer;
+}
+
+size_t BufferPool::get_pooled_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_.size();
+}
+
+uint64_t BufferPool::get_created_count() const noexcept {
+    return created_.load(std::memory_order_relaxed);
+}
+
+} // namespace mmorpg::common
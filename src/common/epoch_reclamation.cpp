@@ -0,0 +1,122 @@
+#include "common/epoch_reclamation.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace mmorpg::common {
+
+EpochDomain& EpochDomain::instance() {
+    // 정적 소멸 단계의 맵과 늦게 끝나는 스레드가 기록을 쓸 수 있으므로 도메인은 소멸시키지 않음
+    static EpochDomain* domain = new EpochDomain();
+    return *domain;
+}
+
+EpochDomain::Record* EpochDomain::local_record() {
+    struct LocalRecord {
+        Record* record = nullptr;
+        ~LocalRecord() {
+            if (record) {
+                record->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local LocalRecord local;
+    if (!local.record) {
+        local.record = acquire_record();
+    }
+    return local.record;
+}
+
+EpochDomain::Record* EpochDomain::acquire_record() {
+    // 끝난 스레드가 반납한 기록을 먼저 재사용
+    for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+        bool expected = false;
+        if (!record->in_use.load(std::memory_order_relaxed) &&
+            record->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            record->depth = 0;
+            return record;
+        }
+    }
+
+    auto* record = new Record();
+    record->in_use.store(true, std::memory_order_relaxed);
+    Record* head = records_.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records_.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    return record;
+}
+
+void EpochDomain::enter() noexcept {
+    Record* record = local_record();
+    if (record->depth++ != 0) {
+        return;
+    }
+    record->active.store(epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    // 구간 표시가 이후의 구조 읽기보다 먼저 보이도록 (oldest_active의 펜스와 짝)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void EpochDomain::exit() noexcept {
+    Record* record = local_record();
+    if (--record->depth == 0) {
+        record->active.store(0, std::memory_order_release);
+    }
+}
+
+uint64_t EpochDomain::advance() noexcept {
+    return epoch_.fetch_add(1, std::memory_order_seq_cst);
+}
+
+uint64_t EpochDomain::oldest_active() const noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+        const uint64_t active = record->active.load(std::memory_order_acquire);
+        if (active != 0) {
+            oldest = std::min(oldest, active);
+        }
+    }
+    return oldest;
+}
+
+EpochRetireList::~EpochRetireList() {
+    for (const auto& retired : retired_) {
+        retired.deleter(retired.node);
+    }
+}
+
+void EpochRetireList::retire(void* node, Deleter deleter) {
+    const uint64_t epoch = EpochDomain::instance().advance();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retired_.push_back({node, deleter, epoch});
+    }
+    collect();
+}
+
+void EpochRetireList::collect() {
+    std::vector<Retired> reclaimable;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (retired_.empty()) {
+            return;
+        }
+        const uint64_t oldest = EpochDomain::instance().oldest_active();
+        const auto split = std::stable_partition(retired_.begin(), retired_.end(),
+                                                 [oldest](const Retired& retired) { return retired.epoch >= oldest; });
+        reclaimable.assign(split, retired_.end());
+        retired_.erase(split, retired_.end());
+    }
+
+    // 노드 소멸자가 다른 구조를 건드릴 수 있으므로 잠금 밖에서 해제
+    for (const auto& retired : reclaimable) {
+        retired.deleter(retired.node);
+    }
+}
+
+size_t EpochRetireList::get_pending_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return retired_.size();
+}
+
+} // namespace mmorpg::common
@@ -0,0 +1,112 @@
+#include "common/memory_accounting.hpp"
+#include "common/logger.hpp"
+#include <algorithm>
+
+namespace mmorpg::common {
+
+MemoryRegistry& MemoryRegistry::instance() {
+    // 전역 에이전트가 정적 소멸 단계에서 계정을 해제하므로 레지스트리는 소멸시키지 않음
+    static MemoryRegistry* registry = new MemoryRegistry();
+    return *registry;
+}
+
+MemoryAccount* MemoryRegistry::find_locked(const std::string& owner, MemoryCategory category) const {
+    for (const auto& account : accounts_) {
+        if (account->get_category() == category && account->get_owner() == owner) {
+            return account.get();
+        }
+    }
+    return nullptr;
+}
+
+MemoryAccount& MemoryRegistry::account(const std::string& owner, MemoryCategory category) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto* existing = find_locked(owner, category)) {
+        return *existing;
+    }
+    accounts_.push_back(std::make_unique<MemoryAccount>(owner, category));
+    return *accounts_.back();
+}
+
+void MemoryRegistry::set_budget(const std::string& owner, MemoryCategory category, size_t bytes) {
+    auto& target = account(owner, category);
+    if (target.get_budget() != bytes) {
+        LOG_INFO("Memory budget {}/{}: {} bytes", owner, to_string(category), bytes);
+    }
+    target.set_budget(bytes);
+}
+
+uint64_t MemoryRegistry::add_pressure_listener(const std::string& owner, MemoryCategory category,
+                                               PressureListener listener) {
+    auto& target = account(owner, category);
+
+    std::lock_guard<std::mutex> lock(listeners_mutex_);
+    const uint64_t id = next_listener_id_++;
+    listeners_.push_back(Listener{id, &target, std::move(listener)});
+    return id;
+}
+
+void MemoryRegistry::remove_pressure_listener(uint64_t listener_id) {
+    std::lock_guard<std::mutex> lock(listeners_mutex_);
+    listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
+                                    [listener_id](const Listener& listener) { return listener.id == listener_id; }),
+                     listeners_.end());
+}
+
+size_t MemoryRegistry::check_budgets() {
+    std::vector<MemoryAccount*> over;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& account : accounts_) {
+            if (account->over_budget()) {
+                over.push_back(account.get());
+            }
+        }
+    }
+
+    for (auto* account : over) {
+        LOG_WARNING("Memory over budget: {}/{} {} > {} bytes", account->get_owner(),
+                    to_string(account->get_category()), account->get_bytes(), account->get_budget());
+    }
+
+    // 해제와 실행이 겹치지 않도록 리스너 잠금을 잡은 채 실행
+    std::lock_guard<std::mutex> lock(listeners_mutex_);
+    for (const auto& listener : listeners_) {
+        if (std::find(over.begin(), over.end(), listener.account) != over.end()) {
+            listener.callback(*listener.account);
+        }
+    }
+    return over.size();
+}
+
+std::vector<MemoryUsage> MemoryRegistry::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<MemoryUsage> usage;
+    usage.reserve(accounts_.size());
+    for (const auto& account : accounts_) {
+        usage.push_back(MemoryUsage{account->get_owner(), account->get_category(), account->get_bytes(),
+                                    account->get_peak(), account->get_budget()});
+    }
+    return usage;
+}
+
+std::vector<MemoryUsage> MemoryRegistry::snapshot(const std::string& owner) const {
+    auto usage = snapshot();
+    usage.erase(std::remove_if(usage.begin(), usage.end(),
+                               [&owner](const MemoryUsage& entry) { return entry.owner != owner; }),
+                usage.end());
+    return usage;
+}
+
+size_t MemoryRegistry::get_total_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t total = 0;
+    for (const auto& account : accounts_) {
+        total += account->get_bytes();
+    }
+    return total;
+}
+
+} // namespace mmorpg::common
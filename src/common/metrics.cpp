@@ -0,0 +1,74 @@
+#include "common/metrics.hpp"
+
+namespace mmorpg::common {
+
+double HistogramSnapshot::percentile(double q) const noexcept {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    const double target = q * static_cast<double>(count);
+    double cumulative = 0.0;
+
+    for (size_t i = 0; i < kBuckets; ++i) {
+        if (counts[i] == 0) {
+            continue;
+        }
+
+        const double next = cumulative + static_cast<double>(counts[i]);
+        if (next >= target) {
+            const double lower = i == 0 ? 0.0 : static_cast<double>(bucket_upper_bound_ns(i - 1));
+            const double upper = static_cast<double>(bucket_upper_bound_ns(i));
+            const double fraction = (target - cumulative) / static_cast<double>(counts[i]);
+            return lower + (upper - lower) * fraction;
+        }
+        cumulative = next;
+    }
+
+    return static_cast<double>(bucket_upper_bound_ns(kBuckets - 1));
+}
+
+HistogramSnapshot HistogramSnapshot::operator-(const HistogramSnapshot& previous) const noexcept {
+    HistogramSnapshot delta;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        delta.counts[i] = counts[i] - previous.counts[i];
+    }
+    delta.count = count - previous.count;
+    delta.sum_ns = sum_ns - previous.sum_ns;
+    return delta;
+}
+
+HistogramSnapshot& HistogramSnapshot::operator+=(const HistogramSnapshot& other) noexcept {
+    for (size_t i = 0; i < kBuckets; ++i) {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+    sum_ns += other.sum_ns;
+    return *this;
+}
+
+HistogramSnapshot LatencyHistogram::snapshot() const noexcept {
+    HistogramSnapshot result;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        result.counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        result.count += result.counts[i];
+    }
+    result.sum_ns = sum_ns_.load(std::memory_order_relaxed);
+    return result;
+}
+
+std::string escape_prometheus_label(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '\\': escaped += "\\\\"; break;
+            case '"':  escaped += "\\\""; break;
+            case '\n': escaped += "\\n"; break;
+            default:   escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+} // namespace mmorpg::common
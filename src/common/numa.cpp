@@ -0,0 +1,286 @@
+#include "common/numa.hpp"
+#include "common/logger.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace mmorpg::common {
+
+namespace {
+
+MemoryPlacementOptions placement_options;
+
+// libnuma 없이 syscall로 직접 호출 (노드 번호 1024개까지)
+constexpr size_t kMaxNodes = 1024;
+constexpr size_t kMaskWords = kMaxNodes / (8 * sizeof(unsigned long));
+
+using NodeMask = std::array<unsigned long, kMaskWords>;
+
+NodeMask make_node_mask(int node_id) {
+    NodeMask mask{};
+    const auto bit = static_cast<size_t>(node_id);
+    mask[bit / (8 * sizeof(unsigned long))] |= 1UL << (bit % (8 * sizeof(unsigned long)));
+    return mask;
+}
+
+bool set_preferred_policy(int node_id) {
+    const NodeMask mask = make_node_mask(node_id);
+    return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), kMaxNodes + 1) == 0;
+}
+
+bool bind_range_to_node(void* address, size_t length, int node_id) {
+    const NodeMask mask = make_node_mask(node_id);
+    return syscall(SYS_mbind, address, length, MPOL_PREFERRED, mask.data(), kMaxNodes + 1, 0) == 0;
+}
+
+/**
+ * @brief "0-3,8-11" 형식의 CPU 목록 파싱
+ */
+std::vector<int> parse_cpu_list(std::string_view text) {
+    std::vector<int> cpus;
+    while (!text.empty()) {
+        const auto comma = text.find(',');
+        std::string_view range = text.substr(0, comma);
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+        while (!range.empty() && (range.back() == '\n' || range.back() == ' ')) {
+            range.remove_suffix(1);
+        }
+        if (range.empty()) {
+            continue;
+        }
+
+        int first = 0;
+        int last = 0;
+        const auto dash = range.find('-');
+        const auto first_text = range.substr(0, dash);
+        if (std::from_chars(first_text.data(), first_text.data() + first_text.size(), first).ec != std::errc()) {
+            return {};
+        }
+        last = first;
+        if (dash != std::string_view::npos) {
+            const auto last_text = range.substr(dash + 1);
+            if (std::from_chars(last_text.data(), last_text.data() + last_text.size(), last).ec != std::errc()) {
+                return {};
+            }
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+size_t round_up(size_t value, size_t unit) {
+    return (value + unit - 1) / unit * unit;
+}
+
+} // namespace
+
+void configure_memory_placement(const MemoryPlacementOptions& options) {
+    placement_options = options;
+}
+
+const MemoryPlacementOptions& memory_placement() noexcept {
+    return placement_options;
+}
+
+const NumaTopology& NumaTopology::instance() {
+    static const NumaTopology topology;
+    return topology;
+}
+
+NumaTopology::NumaTopology() {
+    namespace fs = std::filesystem;
+
+    std::vector<std::pair<int, std::vector<int>>> nodes;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator("/sys/devices/system/node", ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0) {
+            continue;
+        }
+        int node_id = 0;
+        if (std::from_chars(name.data() + 4, name.data() + name.size(), node_id).ec != std::errc()) {
+            continue;
+        }
+
+        std::ifstream cpulist(entry.path() / "cpulist");
+        std::string text;
+        std::getline(cpulist, text);
+        auto cpus = parse_cpu_list(text);
+        if (!cpus.empty()) {
+            // CPU 없는 노드(메모리 전용)는 I/O 샤드를 둘 수 없으므로 제외
+            nodes.emplace_back(node_id, std::move(cpus));
+        }
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    if (nodes.empty()) {
+        std::vector<int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+        for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+            cpus[cpu] = static_cast<int>(cpu);
+        }
+        nodes.emplace_back(0, std::move(cpus));
+    }
+
+    for (auto& [node_id, cpus] : nodes) {
+        node_ids_.push_back(node_id);
+        node_cpus_.push_back(std::move(cpus));
+    }
+}
+
+size_t NumaTopology::current_node() const noexcept {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return 0;
+    }
+    const auto it = std::find(node_ids_.begin(), node_ids_.end(), static_cast<int>(node));
+    return it == node_ids_.end() ? 0 : static_cast<size_t>(it - node_ids_.begin());
+}
+
+bool bind_thread_to_node(size_t node) {
+    const auto& topology = NumaTopology::instance();
+    if (node >= topology.node_count()) {
+        return false;
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (const int cpu : topology.cpus_of(node)) {
+        CPU_SET(cpu, &cpus);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+        return false;
+    }
+    return set_preferred_policy(topology.get_node_id(node));
+}
+
+HugePageRegion::HugePageRegion(size_t size, int node, HugePageMode mode) {
+    if (size == 0) {
+        return;
+    }
+
+    void* address = MAP_FAILED;
+    if (mode == HugePageMode::EXPLICIT) {
+        size_ = round_up(size, kHugePageSize);
+        address = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (address != MAP_FAILED) {
+            backing_ = HugePageMode::EXPLICIT;
+        } else {
+            mode = HugePageMode::TRANSPARENT;
+        }
+    }
+
+    if (address == MAP_FAILED) {
+        size_ = round_up(size, mode == HugePageMode::OFF ? static_cast<size_t>(sysconf(_SC_PAGESIZE)) : kHugePageSize);
+        address = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (address == MAP_FAILED) {
+            LOG_ERROR("Failed to map {} bytes", size_);
+            size_ = 0;
+            return;
+        }
+        if (mode == HugePageMode::TRANSPARENT && madvise(address, size_, MADV_HUGEPAGE) == 0) {
+            backing_ = HugePageMode::TRANSPARENT;
+        }
+    }
+
+    // 첫 접근 전에 노드를 지정해야 페이지가 그 노드에 놓임
+    const auto& topology = NumaTopology::instance();
+    if (node >= 0 && static_cast<size_t>(node) < topology.node_count() && topology.is_numa()) {
+        bind_range_to_node(address, size_, topology.get_node_id(static_cast<size_t>(node)));
+    }
+
+    data_ = static_cast<char*>(address);
+}
+
+HugePageRegion::~HugePageRegion() {
+    release();
+}
+
+HugePageRegion::HugePageRegion(HugePageRegion&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , backing_(std::exchange(other.backing_, HugePageMode::OFF)) {
+}
+
+HugePageRegion& HugePageRegion::operator=(HugePageRegion&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        backing_ = std::exchange(other.backing_, HugePageMode::OFF);
+    }
+    return *this;
+}
+
+void HugePageRegion::release() noexcept {
+    if (data_) {
+        munmap(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+NumaStats sample_numa_stats() {
+    const auto& topology = NumaTopology::instance();
+
+    NumaStats stats;
+    stats.resident_pages.assign(topology.node_count(), 0);
+
+    // 매핑마다 "N<노드>=<페이지 수>" 항목
+    std::ifstream numa_maps("/proc/self/numa_maps");
+    std::string token;
+    while (numa_maps >> token) {
+        if (token.size() < 3 || token[0] != 'N') {
+            continue;
+        }
+        const auto equals = token.find('=');
+        if (equals == std::string::npos) {
+            continue;
+        }
+        int node_id = 0;
+        uint64_t pages = 0;
+        if (std::from_chars(token.data() + 1, token.data() + equals, node_id).ec != std::errc() ||
+            std::from_chars(token.data() + equals + 1, token.data() + token.size(), pages).ec != std::errc()) {
+            continue;
+        }
+        for (size_t node = 0; node < topology.node_count(); ++node) {
+            if (topology.get_node_id(node) == node_id) {
+                stats.resident_pages[node] += pages;
+                break;
+            }
+        }
+    }
+
+    for (size_t node = 0; node < topology.node_count(); ++node) {
+        std::ifstream numastat("/sys/devices/system/node/node" + std::to_string(topology.get_node_id(node)) +
+                               "/numastat");
+        std::string key;
+        uint64_t value = 0;
+        while (numastat >> key >> value) {
+            if (key == "local_node") {
+                stats.local_allocations += value;
+            } else if (key == "other_node") {
+                stats.remote_allocations += value;
+            }
+        }
+    }
+
+    return stats;
+}
+
+} // namespace mmorpg::common
@@ -0,0 +1,53 @@
+#include "common/process_usage.hpp"
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace mmorpg::common {
+
+ProcessUsageSampler::ProcessUsageSampler()
+    : last_cpu_us_(cpu_time_us())
+    , last_time_(std::chrono::steady_clock::now()) {
+}
+
+uint64_t ProcessUsageSampler::cpu_time_us() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    const auto to_us = [](const timeval& tv) {
+        return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+    };
+    return to_us(usage.ru_utime) + to_us(usage.ru_stime);
+}
+
+double ProcessUsageSampler::sample_cpu_usage() {
+    const uint64_t cpu_us = cpu_time_us();
+    const auto now = std::chrono::steady_clock::now();
+
+    const double elapsed_us = std::chrono::duration<double, std::micro>(now - last_time_).count();
+    const double cores = static_cast<double>(std::max(1u, std::thread::hardware_concurrency()));
+    const double usage = elapsed_us > 0.0 ? static_cast<double>(cpu_us - last_cpu_us_) / (elapsed_us * cores) : 0.0;
+
+    last_cpu_us_ = cpu_us;
+    last_time_ = now;
+    return std::clamp(usage, 0.0, 1.0);
+}
+
+double ProcessUsageSampler::memory_usage() {
+    // /proc/self/statm: 전체 페이지 수, 상주 페이지 수, ...
+    std::ifstream statm("/proc/self/statm");
+    uint64_t total_pages = 0;
+    uint64_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) {
+        return 0.0;
+    }
+
+    const long physical_pages = sysconf(_SC_PHYS_PAGES);
+    if (physical_pages <= 0) {
+        return 0.0;
+    }
+    return std::clamp(static_cast<double>(resident_pages) / static_cast<double>(physical_pages), 0.0, 1.0);
+}
+
+} // namespace mmorpg::common
@@ -0,0 +1,239 @@
+#include "common/profiler.hpp"
+#include "common/logger.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace mmorpg::common {
+
+namespace {
+
+void write_json_string(std::ostream& out, const char* value) {
+    out << '"';
+    for (const char* p = value ? value : ""; *p != '\0'; ++p) {
+        switch (*p) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            default:   out << *p; break;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+// ProfileRingBuffer 구현
+ProfileRingBuffer::ProfileRingBuffer(uint32_t thread_id, std::string thread_name)
+    : thread_id_(thread_id)
+    , thread_name_(std::move(thread_name)) {
+}
+
+void ProfileRingBuffer::snapshot(std::vector<ProfileEvent>& out, uint64_t since_ns) const {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t begin = head > kCapacity ? head - kCapacity : 0;
+
+    const size_t first = out.size();
+    for (uint64_t i = begin; i < head; ++i) {
+        const Slot& slot = slots_[i & (kCapacity - 1)];
+        ProfileEvent event;
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.category = slot.category.load(std::memory_order_relaxed);
+        event.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+        event.end_ns = slot.end_ns.load(std::memory_order_relaxed);
+        out.push_back(event);
+    }
+
+    // 복사하는 동안 기록 스레드가 덮어썼을 수 있는 가장 오래된 구간은 버림
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t head_after = head_.load(std::memory_order_relaxed);
+    const uint64_t overwritten = head_after > kCapacity ? head_after - kCapacity : 0;
+    const size_t torn = overwritten > begin ? static_cast<size_t>(std::min(overwritten - begin, head - begin)) : 0;
+
+    auto valid_begin = out.begin() + static_cast<std::ptrdiff_t>(first + torn);
+    auto kept = std::remove_if(valid_begin, out.end(),
+        [since_ns](const ProfileEvent& event) { return event.end_ns < since_ns; });
+    out.erase(kept, out.end());
+    out.erase(out.begin() + static_cast<std::ptrdiff_t>(first), valid_begin);
+}
+
+std::string ProfileRingBuffer::thread_name() const {
+    std::lock_guard<std::mutex> lock(name_mutex_);
+    return thread_name_;
+}
+
+void ProfileRingBuffer::set_thread_name(std::string name) {
+    std::lock_guard<std::mutex> lock(name_mutex_);
+    thread_name_ = std::move(name);
+}
+
+// Profiler 구현
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::~Profiler() {
+    shutdown();
+}
+
+ProfileRingBuffer* Profiler::register_thread() {
+    const uint32_t thread_id = next_thread_id_.fetch_add(1, std::memory_order_relaxed);
+    auto buffer = std::make_shared<ProfileRingBuffer>(thread_id, "thread_" + std::to_string(thread_id));
+
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers_.push_back(buffer);
+    return buffer.get();
+}
+
+void Profiler::set_thread_name(const std::string& name) {
+    thread_buffer().set_thread_name(name);
+}
+
+void Profiler::set_output_directory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    output_directory_ = directory;
+}
+
+void Profiler::set_dump_window(std::chrono::milliseconds window) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    dump_window_ = window;
+}
+
+void Profiler::request_dump() noexcept {
+    dump_requested_.store(true, std::memory_order_relaxed);
+}
+
+bool Profiler::end_tick(uint64_t tick_start_ns, std::chrono::microseconds budget) {
+    const uint64_t end_ns = now_ns();
+    record("tick", "tick", tick_start_ns, end_ns);
+
+    const auto elapsed = std::chrono::nanoseconds(end_ns - tick_start_ns);
+    if (elapsed <= budget) {
+        return false;
+    }
+
+    overrun_count_.fetch_add(1, std::memory_order_relaxed);
+    overrun_pending_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void Profiler::poll() {
+    if (dump_requested_.exchange(false, std::memory_order_relaxed)) {
+        start_dump("signal");
+    } else if (overrun_pending_.exchange(false, std::memory_order_relaxed)) {
+        start_dump("tick_overrun");
+    }
+}
+
+void Profiler::start_dump(const char* reason) {
+    std::string path;
+    std::chrono::milliseconds window;
+    {
+        std::lock_guard<std::mutex> lock(config_mutex_);
+
+        // 연속된 틱 초과로 덤프가 폭주하지 않도록 쿨다운 적용 (시그널은 항상 허용)
+        auto now = Clock::now();
+        if (std::string_view(reason) != "signal" && now - last_dump_time_ < dump_cooldown_) {
+            return;
+        }
+        if (dumping_.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        last_dump_time_ = now;
+
+        std::error_code ec;
+        std::filesystem::create_directories(output_directory_, ec);
+
+        auto wall_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        path = output_directory_ + "/trace_" + reason + "_" + std::to_string(wall_ms) + ".json";
+        window = dump_window_;
+    }
+
+    if (dump_thread_.joinable()) {
+        dump_thread_.join();
+    }
+
+    dump_thread_ = std::thread([this, path, window]() {
+        size_t count = dump_chrome_trace(path, window);
+        dump_count_.fetch_add(1, std::memory_order_relaxed);
+        LOG_WARNING("Profiler trace dumped: {} ({} events)", path, count);
+        dumping_.store(false, std::memory_order_release);
+    });
+}
+
+std::vector<std::pair<std::shared_ptr<ProfileRingBuffer>, std::vector<ProfileEvent>>>
+Profiler::collect(std::chrono::milliseconds window) const {
+    std::vector<std::shared_ptr<ProfileRingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers = buffers_;
+    }
+
+    const uint64_t now = now_ns();
+    const uint64_t window_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(window).count());
+    const uint64_t since_ns = now > window_ns ? now - window_ns : 0;
+
+    std::vector<std::pair<std::shared_ptr<ProfileRingBuffer>, std::vector<ProfileEvent>>> result;
+    result.reserve(buffers.size());
+    for (auto& buffer : buffers) {
+        std::vector<ProfileEvent> events;
+        buffer->snapshot(events, since_ns);
+        result.emplace_back(std::move(buffer), std::move(events));
+    }
+    return result;
+}
+
+size_t Profiler::dump_chrome_trace(const std::string& path, std::chrono::milliseconds window) const {
+    auto threads = collect(window);
+
+    std::ofstream out(path, std::ios::out | std::ios::trunc);
+    if (!out) {
+        LOG_ERROR("Failed to open profiler trace file: {}", path);
+        return 0;
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out.setf(std::ios::fixed);
+    out.precision(3);
+
+    bool first = true;
+    size_t count = 0;
+    for (const auto& [buffer, events] : threads) {
+        if (!first) {
+            out << ',';
+        }
+        first = false;
+
+        std::string thread_name = buffer->thread_name();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_id()
+            << ",\"args\":{\"name\":";
+        write_json_string(out, thread_name.c_str());
+        out << "}}";
+
+        for (const auto& event : events) {
+            out << ",{\"name\":";
+            write_json_string(out, event.name);
+            out << ",\"cat\":";
+            write_json_string(out, event.category);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id()
+                << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.end_ns - event.start_ns) / 1000.0
+                << '}';
+            ++count;
+        }
+    }
+
+    out << "]}\n";
+    return count;
+}
+
+void Profiler::shutdown() {
+    if (dump_thread_.joinable()) {
+        dump_thread_.join();
+    }
+}
+
+} // namespace mmorpg::common
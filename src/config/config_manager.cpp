@@ -0,0 +1,118 @@
+#include "config/config_manager.hpp"
+#include "common/logger.hpp"
+#include <string_view>
+
+namespace mmorpg::config {
+
+ConfigManager& ConfigManager::instance() {
+    static ConfigManager manager;
+    return manager;
+}
+
+ConfigManager::ConfigManager() {
+    // 파일이 없어도 기본값 스냅샷이 항상 존재
+    snapshots_.push_back(std::make_unique<const ServerConfig>());
+    current_.store(snapshots_.back().get(), std::memory_order_release);
+}
+
+bool ConfigManager::load(const std::string& path) {
+    std::string error;
+    auto config = load_server_config(path, &error);
+    if (!config) {
+        LOG_ERROR("Failed to load config: {}", error);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(publish_mutex_);
+        path_ = path;
+    }
+
+    publish(*config);
+    LOG_INFO("Configuration loaded from {}", path);
+    return true;
+}
+
+bool ConfigManager::reload() {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(publish_mutex_);
+        path = path_;
+    }
+
+    if (path.empty()) {
+        LOG_WARNING("Config reload requested but no config file was loaded");
+        return false;
+    }
+
+    std::string error;
+    auto config = load_server_config(path, &error);
+    if (!config) {
+        // 잘못된 파일로 실행 중인 서버를 망가뜨리지 않도록 기존 스냅샷 유지
+        LOG_ERROR("Config reload rejected, keeping previous configuration: {}", error);
+        return false;
+    }
+
+    for (const auto& key : current().restart_required_changes(*config)) {
+        LOG_WARNING("Config key {} changed; takes effect after restart", key);
+    }
+
+    publish(*config);
+    LOG_INFO("Configuration reloaded from {} (generation {})", path, get_generation());
+    return true;
+}
+
+void ConfigManager::publish(const ServerConfig& config) {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+
+    const ServerConfig* previous = current_.load(std::memory_order_relaxed);
+    snapshots_.push_back(std::make_unique<const ServerConfig>(config));
+    const ServerConfig* next = snapshots_.back().get();
+
+    current_.store(next, std::memory_order_release);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+
+    for (const auto& [id, listener] : listeners_) {
+        listener(*previous, *next);
+    }
+}
+
+uint64_t ConfigManager::add_listener(Listener listener) {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    const uint64_t id = next_listener_id_++;
+    listeners_.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void ConfigManager::remove_listener(uint64_t listener_id) {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    std::erase_if(listeners_, [listener_id](const auto& entry) { return entry.first == listener_id; });
+}
+
+void ConfigManager::request_reload() noexcept {
+    reload_requested_.store(true, std::memory_order_relaxed);
+}
+
+bool ConfigManager::poll() {
+    if (!reload_requested_.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+    return reload();
+}
+
+std::string find_config_argument(int argc, char* argv[]) {
+    constexpr std::string_view kPrefix = "--config=";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.substr(0, kPrefix.size()) == kPrefix) {
+            return std::string(arg.substr(kPrefix.size()));
+        }
+        if (arg == "--config" && i + 1 < argc) {
+            return argv[i + 1];
+        }
+    }
+    return {};
+}
+
+} // namespace mmorpg::config
@@ -0,0 +1,369 @@
+#include "config/server_config.hpp"
+#include "common/logger.hpp"
+#include <charconv>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+namespace mmorpg::config {
+
+namespace {
+
+std::string_view trim(std::string_view value) {
+    const auto begin = value.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const auto end = value.find_last_not_of(" \t\r");
+    return value.substr(begin, end - begin + 1);
+}
+
+void set_error(std::string* error, std::string message) {
+    if (error) {
+        *error = std::move(message);
+    }
+}
+
+template <typename T>
+bool parse_integer(const std::string& text, T min, T max, T& out) {
+    long long value = 0;
+    const auto* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, value);
+    if (ec != std::errc() || ptr != end || value < static_cast<long long>(min) ||
+        value > static_cast<long long>(max)) {
+        return false;
+    }
+    out = static_cast<T>(value);
+    return true;
+}
+
+bool parse_float(const std::string& text, float min, float max, float& out) {
+    try {
+        std::size_t pos = 0;
+        const float value = std::stof(text, &pos);
+        if (pos != text.size() || value < min || value > max) {
+            return false;
+        }
+        out = value;
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool parse_seconds(const std::string& text, int64_t min, int64_t max, std::chrono::seconds& out) {
+    // "300" 또는 "300s" / "5m" / "1h"
+    std::string number = text;
+    int64_t multiplier = 1;
+    if (!number.empty()) {
+        switch (number.back()) {
+            case 's': number.pop_back(); break;
+            case 'm': number.pop_back(); multiplier = 60; break;
+            case 'h': number.pop_back(); multiplier = 3600; break;
+            default: break;
+        }
+    }
+
+    int64_t value = 0;
+    if (!parse_integer<int64_t>(number, 0, max, value) || value * multiplier < min ||
+        value * multiplier > max) {
+        return false;
+    }
+    out = std::chrono::seconds(value * multiplier);
+    return true;
+}
+
+bool parse_peers(const std::string& text, std::map<std::string, std::string>& out) {
+    // "b=10.0.0.2:7100, c=10.0.0.3:7100" (빈 값이면 피어 없음)
+    std::map<std::string, std::string> peers;
+    std::string_view rest = text;
+    while (!rest.empty()) {
+        const auto comma = rest.find(',');
+        const std::string_view entry = trim(rest.substr(0, comma));
+        rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+        if (entry.empty()) {
+            continue;
+        }
+
+        const auto equals = entry.find('=');
+        if (equals == std::string_view::npos) {
+            return false;
+        }
+        const std::string_view node_id = trim(entry.substr(0, equals));
+        const std::string_view address = trim(entry.substr(equals + 1));
+        if (node_id.empty() || address.find(':') == std::string_view::npos) {
+            return false;
+        }
+        peers[std::string(node_id)] = std::string(address);
+    }
+    out = std::move(peers);
+    return true;
+}
+
+bool parse_address_list(const std::string& text, std::vector<std::string>& out) {
+    // "10.0.0.2:7200, 10.0.0.3:7200"
+    std::vector<std::string> addresses;
+    std::string_view rest = text;
+    while (!rest.empty()) {
+        const auto comma = rest.find(',');
+        const std::string_view entry = trim(rest.substr(0, comma));
+        rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+        if (entry.empty()) {
+            continue;
+        }
+        if (entry.find(':') == std::string_view::npos) {
+            return false;
+        }
+        addresses.emplace_back(entry);
+    }
+    out = std::move(addresses);
+    return true;
+}
+
+bool parse_bool(const std::string& text, bool& out) {
+    if (text == "true" || text == "on" || text == "yes" || text == "1") {
+        out = true;
+        return true;
+    }
+    if (text == "false" || text == "off" || text == "no" || text == "0") {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+bool parse_session_mode(const std::string& text, network::SessionMode& out) {
+    // "callback" / "coroutine"
+    if (text == "callback") {
+        out = network::SessionMode::CALLBACK_CHAIN;
+    } else if (text == "coroutine") {
+        out = network::SessionMode::COROUTINE;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parse_huge_page_mode(const std::string& text, common::HugePageMode& out) {
+    // "off" / "transparent" / "explicit"
+    if (text == "off") {
+        out = common::HugePageMode::OFF;
+    } else if (text == "transparent") {
+        out = common::HugePageMode::TRANSPARENT;
+    } else if (text == "explicit") {
+        out = common::HugePageMode::EXPLICIT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 설정 키별 파서 테이블
+ */
+using FieldParser = std::function<bool(const std::string&, ServerConfig&)>;
+
+const std::map<std::string, FieldParser>& field_parsers() {
+    static const std::map<std::string, FieldParser> parsers = {
+        {"server.port", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint16_t>(v, 0, 65535, c.port); }},
+        {"server.max_connections", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 1, 1000000, c.max_connections); }},
+        {"server.tick_rate", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 1, 1000, c.tick_rate); }},
+        {"server.worker_threads", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 0, 1024, c.worker_threads); }},
+        {"server.idle_timeout", [](const std::string& v, ServerConfig& c) {
+            return parse_seconds(v, 1, 86400, c.idle_timeout); }},
+        {"server.max_frame_bytes_pre_auth", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 64, 16 * 1024 * 1024, c.max_frame_bytes_pre_auth); }},
+        {"server.max_frame_bytes", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 64, 16 * 1024 * 1024, c.max_frame_bytes); }},
+        {"server.ping_interval", [](const std::string& v, ServerConfig& c) {
+            return parse_seconds(v, 0, 3600, c.ping_interval); }},
+        {"server.drain_timeout", [](const std::string& v, ServerConfig& c) {
+            return parse_seconds(v, 0, 600, c.drain_timeout); }},
+        {"server.session_mode", [](const std::string& v, ServerConfig& c) {
+            return parse_session_mode(v, c.session_mode); }},
+        {"monitoring.metrics_port", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint16_t>(v, 0, 65535, c.metrics_port); }},
+        {"monitoring.interval", [](const std::string& v, ServerConfig& c) {
+            return parse_seconds(v, 1, 3600, c.monitoring_interval); }},
+        {"rate_limit.messages_per_second", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 1, 100000, c.messages_per_second); }},
+        {"rate_limit.burst", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 1, 1000000, c.message_burst); }},
+        {"bandwidth.connection_bytes_per_second", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint64_t>(v, 0, 10'000'000'000, c.connection_bytes_per_second); }},
+        {"bandwidth.node_bytes_per_second", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint64_t>(v, 0, 100'000'000'000, c.node_bytes_per_second); }},
+        {"aoi.radius", [](const std::string& v, ServerConfig& c) {
+            return parse_float(v, 1.0f, 100000.0f, c.aoi_radius); }},
+        {"aoi.hysteresis", [](const std::string& v, ServerConfig& c) {
+            return parse_float(v, 0.0f, 10000.0f, c.aoi_hysteresis); }},
+        {"database.host", [](const std::string& v, ServerConfig& c) {
+            c.database_host = v; return !v.empty(); }},
+        {"database.port", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint16_t>(v, 1, 65535, c.database_port); }},
+        {"database.database", [](const std::string& v, ServerConfig& c) {
+            c.database_name = v; return !v.empty(); }},
+        {"cluster.node_id", [](const std::string& v, ServerConfig& c) {
+            c.cluster_node_id = v; return true; }},
+        {"cluster.listen", [](const std::string& v, ServerConfig& c) {
+            c.cluster_listen = v; return v.find(':') != std::string::npos; }},
+        {"cluster.peers", [](const std::string& v, ServerConfig& c) {
+            return parse_peers(v, c.cluster_peers); }},
+        {"cluster.max_in_flight_batches", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 1, 1024, c.cluster_max_in_flight_batches); }},
+        {"cluster.gossip_listen", [](const std::string& v, ServerConfig& c) {
+            c.cluster_gossip_listen = v; return v.find(':') != std::string::npos; }},
+        {"cluster.seeds", [](const std::string& v, ServerConfig& c) {
+            return parse_address_list(v, c.cluster_seeds); }},
+        {"cluster.service_host", [](const std::string& v, ServerConfig& c) {
+            c.cluster_service_host = v; return !v.empty(); }},
+        {"cluster.suspect_timeout", [](const std::string& v, ServerConfig& c) {
+            return parse_seconds(v, 1, 600, c.cluster_suspect_timeout); }},
+        {"udp.enabled", [](const std::string& v, ServerConfig& c) {
+            return parse_bool(v, c.udp_enabled); }},
+        {"udp.listen", [](const std::string& v, ServerConfig& c) {
+            c.udp_listen = v; return v.find(':') != std::string::npos; }},
+        {"memory.numa", [](const std::string& v, ServerConfig& c) {
+            return parse_bool(v, c.numa_aware); }},
+        {"memory.huge_pages", [](const std::string& v, ServerConfig& c) {
+            return parse_huge_page_mode(v, c.huge_pages); }},
+        {"memory.connection_budget_mb", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 0, 1048576, c.connection_budget_mb); }},
+        {"memory.buffer_budget_mb", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 0, 1048576, c.buffer_budget_mb); }},
+        {"memory.cache_budget_mb", [](const std::string& v, ServerConfig& c) {
+            return parse_integer<uint32_t>(v, 0, 1048576, c.cache_budget_mb); }},
+    };
+    return parsers;
+}
+
+} // namespace
+
+std::vector<std::string> ServerConfig::restart_required_changes(const ServerConfig& other) const {
+    std::vector<std::string> changes;
+    if (port != other.port) changes.emplace_back("server.port");
+    if (worker_threads != other.worker_threads) changes.emplace_back("server.worker_threads");
+    if (ping_interval != other.ping_interval) changes.emplace_back("server.ping_interval");
+    if (session_mode != other.session_mode) changes.emplace_back("server.session_mode");
+    if (metrics_port != other.metrics_port) changes.emplace_back("monitoring.metrics_port");
+    if (monitoring_interval != other.monitoring_interval) changes.emplace_back("monitoring.interval");
+    if (database_host != other.database_host) changes.emplace_back("database.host");
+    if (database_port != other.database_port) changes.emplace_back("database.port");
+    if (database_name != other.database_name) changes.emplace_back("database.database");
+    if (cluster_node_id != other.cluster_node_id) changes.emplace_back("cluster.node_id");
+    if (cluster_listen != other.cluster_listen) changes.emplace_back("cluster.listen");
+    if (cluster_peers != other.cluster_peers) changes.emplace_back("cluster.peers");
+    if (cluster_max_in_flight_batches != other.cluster_max_in_flight_batches) {
+        changes.emplace_back("cluster.max_in_flight_batches");
+    }
+    if (cluster_gossip_listen != other.cluster_gossip_listen) changes.emplace_back("cluster.gossip_listen");
+    if (cluster_seeds != other.cluster_seeds) changes.emplace_back("cluster.seeds");
+    if (cluster_service_host != other.cluster_service_host) changes.emplace_back("cluster.service_host");
+    if (cluster_suspect_timeout != other.cluster_suspect_timeout) changes.emplace_back("cluster.suspect_timeout");
+    if (udp_enabled != other.udp_enabled) changes.emplace_back("udp.enabled");
+    if (udp_listen != other.udp_listen) changes.emplace_back("udp.listen");
+    if (numa_aware != other.numa_aware) changes.emplace_back("memory.numa");
+    if (huge_pages != other.huge_pages) changes.emplace_back("memory.huge_pages");
+    return changes;
+}
+
+std::optional<std::map<std::string, std::string>> parse_ini(std::string_view text, std::string* error) {
+    std::map<std::string, std::string> values;
+    std::string section;
+    size_t line_number = 0;
+
+    while (!text.empty()) {
+        const auto newline = text.find('\n');
+        std::string_view line = trim(text.substr(0, newline));
+        text = newline == std::string_view::npos ? std::string_view{} : text.substr(newline + 1);
+        ++line_number;
+
+        if (line.empty() || line.front() == '#' || line.front() == ';') {
+            continue;
+        }
+
+        if (line.front() == '[') {
+            if (line.back() != ']' || line.size() < 3) {
+                set_error(error, "line " + std::to_string(line_number) + ": malformed section header");
+                return std::nullopt;
+            }
+            section = std::string(trim(line.substr(1, line.size() - 2)));
+            continue;
+        }
+
+        const auto equals = line.find('=');
+        if (equals == std::string_view::npos) {
+            set_error(error, "line " + std::to_string(line_number) + ": expected key = value");
+            return std::nullopt;
+        }
+
+        const std::string key = std::string(trim(line.substr(0, equals)));
+        std::string_view value = trim(line.substr(equals + 1));
+
+        // 값 뒤 인라인 주석 제거
+        const auto comment = value.find(" #");
+        if (comment != std::string_view::npos) {
+            value = trim(value.substr(0, comment));
+        }
+        if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+            value = value.substr(1, value.size() - 2);
+        }
+
+        if (key.empty()) {
+            set_error(error, "line " + std::to_string(line_number) + ": empty key");
+            return std::nullopt;
+        }
+
+        values[section.empty() ? key : section + "." + key] = std::string(value);
+    }
+
+    return values;
+}
+
+std::optional<ServerConfig> parse_server_config(std::string_view text, std::string* error) {
+    auto values = parse_ini(text, error);
+    if (!values) {
+        return std::nullopt;
+    }
+
+    ServerConfig config;
+    const auto& parsers = field_parsers();
+
+    for (const auto& [key, value] : *values) {
+        auto it = parsers.find(key);
+        if (it == parsers.end()) {
+            LOG_WARNING("Unknown config key ignored: {}", key);
+            continue;
+        }
+        if (!it->second(value, config)) {
+            set_error(error, "invalid value for " + key + ": '" + value + "'");
+            return std::nullopt;
+        }
+    }
+
+    return config;
+}
+
+std::optional<ServerConfig> load_server_config(const std::string& path, std::string* error) {
+    std::ifstream file(path);
+    if (!file) {
+        set_error(error, "cannot open " + path);
+        return std::nullopt;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    std::string parse_error;
+    auto config = parse_server_config(buffer.str(), &parse_error);
+    if (!config) {
+        set_error(error, path + ": " + parse_error);
+    }
+    return config;
+}
+
+} // namespace mmorpg::config
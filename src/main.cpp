@@ -1,24 +1,145 @@
+#include "common/agent_supervisor.hpp"
 #include "common/logger.hpp"
+#include "common/memory_accounting.hpp"
+#include "common/numa.hpp"
+#include "common/profiler.hpp"
+#include "config/config_manager.hpp"
 #include "agents/connection_manager/connection_manager.hpp"
+#include "agents/connection_manager/session_migrator.hpp"
+#include "agents/monitoring/monitoring_agent.hpp"
+#include "cluster/cluster_transport.hpp"
+#include "cluster/gossip_membership.hpp"
+#include "cluster/player_directory.hpp"
+#include "common/process_usage.hpp"
+#include <charconv>
+#include <csignal>
 #include <iostream>
 #include <signal.h>
+#include <unistd.h>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace mmorpg {
 
 // 전역 변수로 에이전트 관리
 std::unique_ptr<mmorpg::agents::connection_manager::ConnectionManagerAgent> connection_manager;
+std::unique_ptr<mmorpg::agents::monitoring::MonitoringAgent> monitoring;
+std::unique_ptr<mmorpg::cluster::ClusterTransport> cluster_transport;
+std::unique_ptr<mmorpg::cluster::GossipMembership> membership;
+std::unique_ptr<mmorpg::cluster::PlayerDirectory> player_directory;
+std::unique_ptr<mmorpg::agents::connection_manager::SessionMigrator> session_migrator;
+std::unique_ptr<mmorpg::common::AgentSupervisor> supervisor;
 
-// 시그널 핸들러
-void signal_handler(int signal) {
-    std::cout << "\nReceived signal " << signal << ". Shutting down gracefully..." << std::endl;
+// 종료 요청 플래그 (드레인과 종료는 메인 루프가 수행)
+volatile std::sig_atomic_t shutdown_requested = 0;
+
+// 종료 시그널 핸들러 (async-signal-safe: 플래그만 설정, 두 번째 시그널은 드레인을 건너뛰고 즉시 종료)
+void signal_handler(int) {
+    if (shutdown_requested) {
+        _exit(1);
+    }
+    shutdown_requested = 1;
+}
+
+// 프로파일 덤프 시그널 핸들러 (플래그만 설정, 실제 덤프는 메인 루프에서 수행)
+void profiler_dump_signal_handler(int) {
+    mmorpg::common::Profiler::instance().request_dump();
+}
+
+// 설정 리로드 시그널 핸들러 (플래그만 설정, 실제 리로드는 메인 루프에서 수행)
+void config_reload_signal_handler(int) {
+    mmorpg::config::ConfigManager::instance().request_reload();
+}
+
+// 인증된 user_id를 디렉터리 키(player_id)로 변환 (숫자가 아니면 디렉터리에 올리지 않음)
+std::optional<uint64_t> parse_player_id(const std::string& user_id) {
+    uint64_t player_id = 0;
+    const auto [end, error] = std::from_chars(user_id.data(), user_id.data() + user_id.size(), player_id);
+    if (error != std::errc() || end != user_id.data() + user_id.size()) {
+        return std::nullopt;
+    }
+    return player_id;
+}
+
+// 설정의 서브시스템별 메모리 예산을 계정에 반영 (시작 시와 리로드 시)
+void apply_memory_budgets(const config::ServerConfig& config) {
+    constexpr size_t kMiB = 1024 * 1024;
+    auto& memory = common::MemoryRegistry::instance();
+    const auto& connection_owner = connection_manager->get_agent_id();
+    memory.set_budget(connection_owner, common::MemoryCategory::CONNECTIONS, config.connection_budget_mb * kMiB);
+    memory.set_budget(connection_owner, common::MemoryCategory::BUFFERS, config.buffer_budget_mb * kMiB);
+    memory.set_budget(cluster::DirectoryOptions{}.memory_owner, common::MemoryCategory::CACHES,
+                      config.cache_budget_mb * kMiB);
+}
+
+// 설정의 수신 프레임 한도를 연결 계층에 반영 (시작 시와 리로드 시)
+void apply_frame_limits(const config::ServerConfig& config) {
+    connection_manager->set_frame_limits(config.max_frame_bytes_pre_auth, config.max_frame_bytes,
+                                         config.messages_per_second, config.message_burst);
+}
+
+// 설정의 송신 대역폭 한도를 연결 계층에 반영 (시작 시와 리로드 시)
+void apply_bandwidth_limits(const config::ServerConfig& config) {
+    connection_manager->set_bandwidth_limits(config.connection_bytes_per_second, config.node_bytes_per_second);
+}
+
+// 에이전트가 start() 후 준비를 알릴 때까지 기다리는 최대 시간
+constexpr std::chrono::seconds kAgentReadyTimeout{10};
+
+// 비활성 연결 정리 주기
+constexpr std::chrono::seconds kIdleSweepInterval{1};
+
+// 노드 간 세션 재분배 주기와 한 번에 옮길 최대 세션 수
+constexpr std::chrono::seconds kRebalanceInterval{10};
+constexpr size_t kRebalanceBatch = 50;
+
+// 종료 드레인 시 재접속 안내 지연을 흩뿌리는 구간 (클라이언트가 한 시점에 몰려 재접속하지 않도록)
+constexpr std::chrono::milliseconds kReconnectSpread{5000};
+
+// 이번 틱에 쌓인 디렉터리/세션 이전 메시지를 노드 간 배치로 전송
+void flush_cluster(uint64_t tick) {
+    if (!cluster_transport) {
+        return;
+    }
+    player_directory->poll();
+    session_migrator->poll();
+    cluster_transport->flush(tick);
+}
+
+// 노드 종료 드레인: 수락 중지 -> 클러스터 탈퇴 -> 세션 이전/재접속 안내 -> 송신 큐와 노드 간 배치 비우기
+void drain(std::chrono::seconds timeout, uint64_t& tick) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    connection_manager->begin_drain();
     
-    if (connection_manager) {
-        connection_manager->stop();
+    // 다른 노드가 이 노드로 세션을 보내지 않도록 먼저 탈퇴 (LoadBalancer의 다른 노드 정보는 유지됨)
+    if (membership) {
+        membership->leave();
     }
     
-    mmorpg::common::Logger::shutdown();
-    exit(0);
+    // 인증된 세션은 상태와 미전송 프레임째 다른 노드로, 나머지는 재접속 안내 후 닫음
+    std::string self_node_id;
+    if (session_migrator) {
+        session_migrator->evacuate();
+        self_node_id = cluster_transport->get_node_id();
+    }
+    connection_manager->drain_connections(kReconnectSpread, self_node_id);
+    
+    // 연결은 송신 큐를 다 보낸 뒤 닫히므로 연결 수가 0이 되면 클라이언트 쪽 전송이 끝난 것
+    const auto& handler = connection_manager->get_websocket_handler();
+    while (handler.get_connection_count() > 0 && std::chrono::steady_clock::now() < deadline) {
+        flush_cluster(++tick);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    flush_cluster(++tick);
+    
+    const size_t remaining = handler.get_connection_count();
+    if (remaining > 0) {
+        LOG_WARNING("Drain timed out after {}s with {} connections left", timeout.count(), remaining);
+    } else {
+        LOG_INFO("Drain complete");
+    }
 }
 
 } // namespace mmorpg
@@ -32,39 +153,207 @@ int main(int argc, char* argv[]) {
         LOG_INFO("Version: 1.0.0");
         LOG_INFO("Build: {}", __DATE__ " " __TIME__);
         
+        // 설정 로드 (--config=path). 지정하지 않으면 기본값 사용
+        auto& config_manager = mmorpg::config::ConfigManager::instance();
+        const std::string config_path = mmorpg::config::find_config_argument(argc, argv);
+        if (!config_path.empty() && !config_manager.load(config_path)) {
+            return 1;
+        }
+        const auto& config = config_manager.current();
+        
         // 시그널 핸들러 등록
         signal(SIGINT, mmorpg::signal_handler);
         signal(SIGTERM, mmorpg::signal_handler);
+        signal(SIGUSR1, mmorpg::profiler_dump_signal_handler);
+        signal(SIGHUP, mmorpg::config_reload_signal_handler);
         
-        // Connection Manager Agent 생성 및 시작
-        connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(5000);
+        mmorpg::common::Profiler::instance().set_thread_name("main");
         
-        LOG_INFO("Starting Connection Manager Agent...");
-        connection_manager->start();
+        // 메모리 배치 정책 - I/O 스레드와 풀을 만들기 전에 적용
+        mmorpg::common::configure_memory_placement({config.numa_aware, config.huge_pages});
+        const auto& topology = mmorpg::common::NumaTopology::instance();
+        LOG_INFO("NUMA nodes: {} (numa {}, huge pages {})", topology.node_count(),
+                 config.numa_aware ? "on" : "off", mmorpg::common::to_string(config.huge_pages));
+        
+        // 에이전트 시작 순서 - 의존 대상이 준비된 구성 요소부터 병렬로 시작
+        mmorpg::supervisor = std::make_unique<mmorpg::common::AgentSupervisor>(mmorpg::kAgentReadyTimeout);
+        
+        // Connection Manager Agent 생성 (세션 리스너 등록 후 시작)
+        mmorpg::connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(
+            config.max_connections, config.port, config.worker_threads);
+        mmorpg::apply_memory_budgets(config);
+        mmorpg::apply_frame_limits(config);
+        mmorpg::apply_bandwidth_limits(config);
+        mmorpg::connection_manager->set_ping_interval(config.ping_interval);
+        mmorpg::connection_manager->set_session_mode(config.session_mode);
+        
+        // 이동/스냅샷용 UDP 보조 채널 (WebSocket은 제어 채널로 유지)
+        if (config.udp_enabled) {
+            mmorpg::network::UdpChannelOptions udp_options;
+            udp_options.bind_address = config.udp_listen;
+            mmorpg::connection_manager->enable_udp_channel(udp_options);
+        }
+        
+        // Monitoring Agent - 에이전트/네트워크 통계 집계, /metrics 노출 및 상태 요약 로그
+        mmorpg::monitoring = std::make_unique<mmorpg::agents::monitoring::MonitoringAgent>(
+            config.monitoring_interval, config.metrics_port);
+        mmorpg::monitoring->register_agent(mmorpg::connection_manager.get());
+        mmorpg::monitoring->register_agent(mmorpg::monitoring.get());
+        mmorpg::monitoring->attach_network(&mmorpg::connection_manager->get_websocket_handler());
+        mmorpg::supervisor->add(*mmorpg::monitoring);
+        
+        // 클라이언트 리스너 뒤에서 처리하는 구성 요소 (클러스터 모드에서는 노드 간 전송 계층 추가)
+        std::vector<std::string> listener_dependencies;
+        
+        // 클러스터 전송 계층 - node_id가 설정된 경우에만 노드 간 스트림을 엶
+        if (!config.cluster_node_id.empty()) {
+            mmorpg::cluster::TransportOptions cluster_options;
+            cluster_options.node_id = config.cluster_node_id;
+            cluster_options.listen_address = config.cluster_listen;
+            cluster_options.max_in_flight_batches = config.cluster_max_in_flight_batches;
+            
+            mmorpg::cluster_transport = std::make_unique<mmorpg::cluster::ClusterTransport>(cluster_options);
+            
+            // 플레이어 위치 디렉터리 - 로그인/로그아웃을 해시 링 소유 노드에 반영
+            mmorpg::player_directory = std::make_unique<mmorpg::cluster::PlayerDirectory>(*mmorpg::cluster_transport);
+            
+            // 세션 이전 - 다른 노드로 옮길 세션을 노드 간 채널로 넘기고 넘겨받은 세션을 재개
+            mmorpg::session_migrator = std::make_unique<mmorpg::agents::connection_manager::SessionMigrator>(
+                *mmorpg::connection_manager, *mmorpg::cluster_transport);
+            mmorpg::cluster_transport->set_batch_handler([](const mmorpg::cluster::ClusterBatch& batch) {
+                mmorpg::player_directory->on_batch(batch);
+                mmorpg::session_migrator->on_batch(batch);
+            });
+            mmorpg::connection_manager->set_session_listener([](const std::string& user_id, bool online) {
+                const auto player_id = mmorpg::parse_player_id(user_id);
+                if (!player_id) {
+                    return;
+                }
+                if (online) {
+                    mmorpg::player_directory->on_login(*player_id);
+                } else {
+                    mmorpg::player_directory->on_logout(*player_id);
+                }
+            });
+            
+            mmorpg::monitoring->attach_cluster(mmorpg::cluster_transport.get());
+            mmorpg::supervisor->add("ClusterTransport",
+                [&config]() {
+                    if (!mmorpg::cluster_transport->start()) {
+                        return false;
+                    }
+                    for (const auto& [node_id, address] : config.cluster_peers) {
+                        mmorpg::cluster_transport->add_peer(node_id, address);
+                    }
+                    return true;
+                },
+                []() { mmorpg::cluster_transport->stop(); });
+            listener_dependencies.push_back("ClusterTransport");
+            
+            // 멤버십 가십 - 노드 생존 여부와 부하를 LoadBalancer에 자동 반영
+            mmorpg::cluster::MembershipOptions membership_options;
+            membership_options.node_id = config.cluster_node_id;
+            membership_options.bind_address = config.cluster_gossip_listen;
+            membership_options.service_host = config.cluster_service_host;
+            membership_options.service_port = config.port;
+            membership_options.seeds = config.cluster_seeds;
+            membership_options.suspect_timeout = config.cluster_suspect_timeout;
+            
+            mmorpg::membership = std::make_unique<mmorpg::cluster::GossipMembership>(membership_options);
+            mmorpg::membership->set_load_provider(
+                [sampler = mmorpg::common::ProcessUsageSampler()]() mutable {
+                    mmorpg::cluster::MemberLoad load;
+                    load.cpu_usage = sampler.sample_cpu_usage();
+                    load.memory_usage = mmorpg::common::ProcessUsageSampler::memory_usage();
+                    load.connections = mmorpg::connection_manager->get_connection_count();
+                    load.max_connections = mmorpg::connection_manager->get_max_connections();
+                    return load;
+                });
+            mmorpg::membership->attach_load_balancer(&mmorpg::connection_manager->get_load_balancer());
+            mmorpg::membership->set_listener([](const mmorpg::cluster::MemberInfo& member) {
+                mmorpg::player_directory->on_member(member);
+            });
+        }
+        
+        // 리스너는 뒷단이 모두 준비된 뒤에 엶
+        mmorpg::supervisor->add(*mmorpg::connection_manager, listener_dependencies);
+        
+        // 다른 노드에 이 노드를 알리는 것은 리스너가 열린 뒤 (먼저 알리면 리다이렉트된 세션이 접속 실패)
+        if (mmorpg::membership) {
+            mmorpg::supervisor->add("GossipMembership",
+                []() { return mmorpg::membership->start(); },
+                []() { mmorpg::membership->leave(); },
+                {mmorpg::connection_manager->get_agent_id()});
+        }
+        
+        LOG_INFO("Starting agents...");
+        if (!mmorpg::supervisor->start()) {
+            return 1;
+        }
+        
+        // 리로드 시 즉시 반영되는 값 적용 (나머지 live 값은 사용하는 쪽에서 current()로 읽음)
+        config_manager.add_listener(
+            [](const mmorpg::config::ServerConfig& previous, const mmorpg::config::ServerConfig& current) {
+                if (previous.max_connections != current.max_connections) {
+                    mmorpg::connection_manager->set_max_connections(current.max_connections);
+                }
+                mmorpg::apply_memory_budgets(current);
+                mmorpg::apply_frame_limits(current);
+                mmorpg::apply_bandwidth_limits(current);
+            });
         
         LOG_INFO("MMORPG Server started successfully!");
-        LOG_INFO("WebSocket server listening on port 8080");
-        LOG_INFO("Maximum connections: 5000");
+        LOG_INFO("WebSocket server listening on port {}",
+                 mmorpg::connection_manager->get_websocket_handler().get_port());
+        LOG_INFO("Maximum connections: {}", config.max_connections);
+        if (config.metrics_port != 0) {
+            LOG_INFO("Metrics endpoint: http://localhost:{}/metrics", config.metrics_port);
+        }
+        
+        auto next_idle_sweep = std::chrono::steady_clock::now() + mmorpg::kIdleSweepInterval;
+        auto next_rebalance = std::chrono::steady_clock::now() + mmorpg::kRebalanceInterval;
+        uint64_t tick = 0;
         
         // 메인 루프
-        while (connection_manager->is_running()) {
+        while (mmorpg::connection_manager->is_running() && !mmorpg::shutdown_requested) {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
             
-            // 주기적으로 상태 출력
-            static auto last_status_time = std::chrono::steady_clock::now();
-            auto now = std::chrono::steady_clock::now();
+            const uint64_t tick_start = mmorpg::common::Profiler::now_ns();
             
-            if (now - last_status_time > std::chrono::seconds(30)) {
-                auto stats = connection_manager->get_connection_stats();
-                LOG_INFO("Server Status - Connections: {:.0f}/{:.0f} ({:.1f}%)", 
-                        stats["total_connections"], 
-                        stats["max_connections"],
-                        stats["connection_utilization"] * 100.0);
-                
-                last_status_time = now;
+            // SIGHUP 수신 시 설정 파일 재적용
+            config_manager.poll();
+            const auto& live_config = config_manager.current();
+            
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= next_idle_sweep) {
+                mmorpg::connection_manager->cleanup_inactive_connections(live_config.idle_timeout);
+                next_idle_sweep = now + mmorpg::kIdleSweepInterval;
             }
+            
+            // 이번 틱에 쌓인 노드 간 메시지를 피어별 배치 하나로 전송
+            ++tick;
+            if (mmorpg::cluster_transport && now >= next_rebalance) {
+                mmorpg::session_migrator->rebalance(mmorpg::kRebalanceBatch);
+                next_rebalance = now + mmorpg::kRebalanceInterval;
+            }
+            mmorpg::flush_cluster(tick);
+            
+            // 틱 예산 초과 또는 SIGUSR1 수신 시 최근 구간을 Chrome trace로 덤프
+            const auto tick_budget = live_config.tick_budget();
+            if (mmorpg::common::Profiler::instance().end_tick(tick_start, tick_budget)) {
+                LOG_WARNING("Main tick exceeded budget of {} us", tick_budget.count());
+            }
+            mmorpg::common::Profiler::instance().poll();
         }
         
+        if (mmorpg::shutdown_requested) {
+            LOG_INFO("Shutdown requested, draining connections...");
+            mmorpg::drain(config_manager.current().drain_timeout, tick);
+        }
+        
+        // 시작 순서의 역순 (멤버십 탈퇴 -> 리스너 종료 -> 뒷단 구성 요소)
+        mmorpg::supervisor->stop();
+        
     } catch (const std::exception& e) {
         LOG_CRITICAL("Fatal error: {}", e.what());
         return 1;
@@ -74,6 +363,8 @@ int main(int argc, char* argv[]) {
     }
     
     LOG_INFO("MMORPG Server shutdown complete");
+    mmorpg::common::Profiler::instance().shutdown();
+    mmorpg::common::Logger::shutdown();
     return 0;
 }
 
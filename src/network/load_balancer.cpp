@@ -1,5 +1,6 @@
 #include "network/load_balancer.hpp"
 #include "common/logger.hpp"
+#include "common/profiler.hpp"
 #include <algorithm>
 #include <random>
 #include <thread>
@@ -62,7 +63,18 @@ void LoadBalancer::remove_server(const std::string& id) {
     }
 }
 
+bool LoadBalancer::has_server(const std::string& id) const {
+    std::lock_guard<std::mutex> lock(servers_mutex_);
+    
+    return std::any_of(servers_.begin(), servers_.end(),
+        [&id](const std::unique_ptr<ServerNode>& server) {
+            return server->id == id;
+        });
+}
+
 std::string LoadBalancer::select_server(const std::string& client_ip) {
+    PROFILE_ZONE_CAT("lb.select_server", "network");
+    
     std::lock_guard<std::mutex> lock(servers_mutex_);
     
     if (servers_.empty()) {
@@ -99,6 +111,50 @@ std::string LoadBalancer::select_server(const std::string& client_ip) {
     }
 }
 
+std::vector<std::string> LoadBalancer::select_servers(size_t count, const std::string& exclude_id) {
+    PROFILE_ZONE_CAT("lb.select_servers", "network");
+    
+    struct Candidate {
+        const ServerNode* server;
+        int64_t weight;    // 남은 수용량
+        int64_t current;   // smooth weighted round robin 누적값
+    };
+    
+    std::lock_guard<std::mutex> lock(servers_mutex_);
+    
+    std::vector<Candidate> candidates;
+    int64_t total_weight = 0;
+    for (const auto& server : servers_) {
+        const uint32_t current = server->current_connections.load();
+        const uint32_t max = server->max_connections.load();
+        if (server->id == exclude_id || !server->is_healthy.load(std::memory_order_acquire) || current >= max) {
+            continue;
+        }
+        candidates.push_back(Candidate{server.get(), static_cast<int64_t>(max - current), 0});
+        total_weight += max - current;
+    }
+    
+    std::vector<std::string> selected;
+    if (candidates.empty()) {
+        return selected;
+    }
+    
+    // 매번 누적값이 가장 큰 서버를 고르고 전체 가중치만큼 빼면 수용량 비율대로 고르게 섞임
+    selected.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Candidate* best = nullptr;
+        for (auto& candidate : candidates) {
+            candidate.current += candidate.weight;
+            if (!best || candidate.current > best->current) {
+                best = &candidate;
+            }
+        }
+        best->current -= total_weight;
+        selected.push_back(best->server->id);
+    }
+    return selected;
+}
+
 std::string LoadBalancer::select_round_robin() {
     if (servers_.empty()) {
         return "";
@@ -252,6 +308,25 @@ void LoadBalancer::update_server_status(const std::string& server_id, double cpu
     }
 }
 
+void LoadBalancer::update_server_load(const std::string& server_id, double cpu_usage, double memory_usage,
+                                      uint32_t current_connections, bool is_healthy) {
+    std::lock_guard<std::mutex> lock(servers_mutex_);
+    
+    auto server_it = std::find_if(servers_.begin(), servers_.end(),
+        [&server_id](const std::unique_ptr<ServerNode>& server) {
+            return server->id == server_id;
+        });
+    
+    if (server_it != servers_.end()) {
+        auto* server = server_it->get();
+        server->cpu_usage.store(cpu_usage, std::memory_order_release);
+        server->memory_usage.store(memory_usage, std::memory_order_release);
+        server->current_connections.store(current_connections, std::memory_order_release);
+        server->is_healthy.store(is_healthy, std::memory_order_release);
+        server->last_health_check = std::chrono::steady_clock::now();
+    }
+}
+
 const ServerNode* LoadBalancer::get_server(const std::string& server_id) const {
     std::lock_guard<std::mutex> lock(servers_mutex_);
     
@@ -279,8 +354,9 @@ void LoadBalancer::set_strategy(LoadBalancingStrategy strategy) {
     LOG_INFO("Load balancing strategy changed to: {}", static_cast<int>(strategy));
 }
 
-void LoadBalancer::start_health_check(std::chrono::seconds interval) {
+void LoadBalancer::start_health_check(std::chrono::seconds interval, std::chrono::seconds stale_after) {
     health_check_interval_ = interval;
+    health_check_stale_after_ = stale_after;
     
     health_check_thread_ = std::thread([this]() {
         while (running_.load(std::memory_order_acquire)) {
@@ -300,7 +376,7 @@ void LoadBalancer::perform_health_check() {
     for (auto& server : servers_) {
         // 마지막 헬스 체크로부터 너무 오래 지났으면 비헬시로 표시
         auto time_since_check = now - server->last_health_check;
-        if (time_since_check > std::chrono::minutes(5)) {
+        if (time_since_check > health_check_stale_after_) {
             server->is_healthy.store(false, std::memory_order_release);
             LOG_WARNING("Server {} marked as unhealthy due to no recent health check", server->id);
         }
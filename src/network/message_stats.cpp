@@ -0,0 +1,33 @@
+#include "network/message_stats.hpp"
+
+namespace mmorpg::network {
+
+std::string MessageStats::slot_name(uint16_t slot) {
+    switch (slot) {
+        case kTextSlot:
+            return "text";
+        case kOtherSlot:
+            return "other";
+        default:
+            return std::to_string(slot);
+    }
+}
+
+std::array<OpcodeStatsSnapshot, MessageStats::kSlots> MessageStats::snapshot() const {
+    std::array<OpcodeStatsSnapshot, kSlots> result;
+
+    for (size_t i = 0; i < kSlots; ++i) {
+        const auto& counters = slots_[i];
+        auto& out = result[i];
+        out.slot = static_cast<uint16_t>(i);
+        out.inbound_count = counters.inbound_count.load(std::memory_order_relaxed);
+        out.inbound_bytes = counters.inbound_bytes.load(std::memory_order_relaxed);
+        out.outbound_count = counters.outbound_count.load(std::memory_order_relaxed);
+        out.outbound_bytes = counters.outbound_bytes.load(std::memory_order_relaxed);
+        out.handler_latency = counters.handler_latency.snapshot();
+    }
+
+    return result;
+}
+
+} // namespace mmorpg::network
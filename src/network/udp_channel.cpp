@@ -0,0 +1,432 @@
+#include "network/udp_channel.hpp"
+#include "common/logger.hpp"
+#include <cstring>
+#include <vector>
+
+namespace mmorpg::network {
+
+namespace {
+
+template <typename T>
+void write_le(char* out, T value) noexcept {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+template <typename T>
+T read_le(const char* in) noexcept {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<uint8_t>(in[i])) << (8 * i);
+    }
+    return value;
+}
+
+std::string make_packet(const UdpPacketHeader& header, std::string_view payload = {}) {
+    std::string packet(UdpPacketHeader::kSize + payload.size(), '\0');
+    header.encode(packet.data());
+    if (!payload.empty()) {
+        std::memcpy(packet.data() + UdpPacketHeader::kSize, payload.data(), payload.size());
+    }
+    return packet;
+}
+
+} // namespace
+
+void UdpPacketHeader::encode(char* out) const noexcept {
+    write_le<uint64_t>(out, token);
+    out[8] = static_cast<char>(type);
+    out[9] = static_cast<char>(flags);
+    write_le<uint16_t>(out + 10, lane);
+    write_le<uint32_t>(out + 12, sequence);
+}
+
+std::optional<UdpPacketHeader> UdpPacketHeader::decode(std::string_view packet) noexcept {
+    if (packet.size() < kSize) {
+        return std::nullopt;
+    }
+    const auto type = static_cast<uint8_t>(packet[8]);
+    if (type < static_cast<uint8_t>(UdpPacketType::BIND) || type > static_cast<uint8_t>(UdpPacketType::ACK)) {
+        return std::nullopt;
+    }
+
+    UdpPacketHeader header;
+    header.token = read_le<uint64_t>(packet.data());
+    header.type = static_cast<UdpPacketType>(type);
+    header.flags = static_cast<uint8_t>(packet[9]);
+    header.lane = read_le<uint16_t>(packet.data() + 10);
+    header.sequence = read_le<uint32_t>(packet.data() + 12);
+    return header;
+}
+
+UdpChannel::UdpChannel(UdpChannelOptions options)
+    : options_(std::move(options))
+    , socket_(io_context_)
+    , resend_timer_(io_context_)
+    , token_random_(std::random_device{}())
+    , loss_random_(options_.loss_seed ? options_.loss_seed : std::random_device{}()) {
+}
+
+UdpChannel::~UdpChannel() {
+    stop();
+}
+
+void UdpChannel::set_receive_handler(ReceiveHandler handler) {
+    receive_handler_ = std::move(handler);
+}
+
+std::optional<boost::asio::ip::udp::endpoint> UdpChannel::resolve(const std::string& address) {
+    const auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return std::nullopt;
+    }
+    boost::system::error_code ec;
+    udp::resolver resolver(io_context_);
+    auto results = resolver.resolve(udp::v4(), address.substr(0, colon), address.substr(colon + 1), ec);
+    if (ec || results.empty()) {
+        LOG_WARNING("Cannot resolve UDP address {}: {}", address, ec.message());
+        return std::nullopt;
+    }
+    return results.begin()->endpoint();
+}
+
+bool UdpChannel::start() {
+    if (thread_.joinable()) {
+        return true;
+    }
+
+    auto bind_endpoint = resolve(options_.bind_address);
+    boost::system::error_code ec;
+    if (bind_endpoint) {
+        socket_.open(bind_endpoint->protocol(), ec);
+        if (!ec) {
+            socket_.bind(*bind_endpoint, ec);
+        }
+    }
+    if (!bind_endpoint || ec) {
+        LOG_ERROR("Failed to bind UDP channel on {}: {}", options_.bind_address, ec.message());
+        socket_.close(ec);
+        return false;
+    }
+    bound_port_ = socket_.local_endpoint().port();
+
+    io_context_.restart();
+    start_receive();
+    schedule_resend();
+    thread_ = std::thread([this]() { io_context_.run(); });
+
+    if (options_.loss_rate > 0.0) {
+        LOG_WARNING("UDP channel simulating {:.0f}% packet loss", options_.loss_rate * 100.0);
+    }
+    LOG_INFO("UDP channel listening on port {}", bound_port_);
+    return true;
+}
+
+void UdpChannel::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    io_context_.stop();
+    thread_.join();
+
+    boost::system::error_code ec;
+    resend_timer_.cancel();
+    socket_.close(ec);
+
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    sessions_.clear();
+    tokens_.clear();
+    LOG_INFO("UDP channel stopped");
+}
+
+uint64_t UdpChannel::open_session(const std::string& connection_id) {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+
+    // 0은 "토큰 없음"으로 예약
+    uint64_t token = 0;
+    while (token == 0 || tokens_.count(token)) {
+        token = token_random_();
+    }
+
+    auto& session = sessions_[connection_id];
+    if (session.token != 0) {
+        tokens_.erase(session.token);
+    }
+    session = Session{};
+    session.connection_id = connection_id;
+    session.token = token;
+    tokens_.emplace(token, connection_id);
+    return token;
+}
+
+void UdpChannel::close_session(const std::string& connection_id) {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    auto it = sessions_.find(connection_id);
+    if (it == sessions_.end()) {
+        return;
+    }
+    tokens_.erase(it->second.token);
+    sessions_.erase(it);
+}
+
+bool UdpChannel::is_bound(const std::string& connection_id) const {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    auto it = sessions_.find(connection_id);
+    return it != sessions_.end() && it->second.endpoint.has_value();
+}
+
+bool UdpChannel::send(const std::string& connection_id, uint16_t lane, std::string_view payload, bool reliable) {
+    if (payload.size() > kMaxPayloadSize) {
+        return false;
+    }
+
+    std::string packet;
+    udp::endpoint endpoint;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        auto it = sessions_.find(connection_id);
+        if (it == sessions_.end() || !it->second.endpoint) {
+            return false;
+        }
+        auto& session = it->second;
+
+        UdpPacketHeader header;
+        header.token = session.token;
+        header.type = UdpPacketType::DATA;
+        header.lane = lane;
+        if (reliable) {
+            header.flags = UdpPacketHeader::kReliable;
+            header.sequence = session.next_reliable_sequence++;
+        } else {
+            header.sequence = session.next_sequence++;
+        }
+        packet = make_packet(header, payload);
+        endpoint = *session.endpoint;
+
+        if (reliable) {
+            session.pending.push_back(PendingReliable{header.sequence, packet, Clock::now(), 0});
+        }
+    }
+
+    send_packet(packet, endpoint);
+    return true;
+}
+
+size_t UdpChannel::get_session_count() const {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    return sessions_.size();
+}
+
+UdpChannelStats UdpChannel::get_stats() const {
+    UdpChannelStats stats;
+    stats.packets_sent = packets_sent_.load(std::memory_order_relaxed);
+    stats.packets_received = packets_received_.load(std::memory_order_relaxed);
+    stats.delivered = delivered_.load(std::memory_order_relaxed);
+    stats.stale_dropped = stale_dropped_.load(std::memory_order_relaxed);
+    stats.duplicates_dropped = duplicates_dropped_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    stats.resends = resends_.load(std::memory_order_relaxed);
+    stats.reliable_expired = reliable_expired_.load(std::memory_order_relaxed);
+    stats.simulated_losses = simulated_losses_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void UdpChannel::start_receive() {
+    socket_.async_receive_from(
+        boost::asio::buffer(receive_buffer_), receive_from_,
+        [this](const boost::system::error_code& ec, size_t bytes) {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+            if (!ec) {
+                on_receive(bytes);
+            }
+            start_receive();
+        });
+}
+
+void UdpChannel::on_receive(size_t bytes) {
+    if (simulate_loss()) {
+        return;
+    }
+    packets_received_.fetch_add(1, std::memory_order_relaxed);
+
+    const std::string_view packet(receive_buffer_.data(), bytes);
+    const auto header = UdpPacketHeader::decode(packet);
+    if (!header || header->token == 0) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::string connection_id;
+    std::string reply;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        auto token_it = tokens_.find(header->token);
+        if (token_it == tokens_.end()) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto& session = sessions_.at(token_it->second);
+
+        if (header->type == UdpPacketType::BIND) {
+            // 같은 토큰의 재바인드는 허용 (NAT 매핑 변경, BIND_ACK 유실 후 재시도)
+            if (session.endpoint != receive_from_) {
+                LOG_DEBUG("UDP session bound: {} -> {}:{}", session.connection_id,
+                          receive_from_.address().to_string(), receive_from_.port());
+            }
+            session.endpoint = receive_from_;
+            UdpPacketHeader ack;
+            ack.token = session.token;
+            ack.type = UdpPacketType::BIND_ACK;
+            reply = make_packet(ack);
+        } else if (session.endpoint != receive_from_) {
+            // 토큰만 엿본 제3자가 세션에 끼어들지 못하도록 바인드한 엔드포인트만 받음
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else if (header->type == UdpPacketType::ACK) {
+            auto& pending = session.pending;
+            for (auto it = pending.begin(); it != pending.end(); ++it) {
+                if (it->sequence == header->sequence) {
+                    pending.erase(it);
+                    break;
+                }
+            }
+        } else if (header->type == UdpPacketType::DATA) {
+            bool deliver = false;
+            if (header->reliable()) {
+                // 중복이어도 ACK는 다시 보냄 (이전 ACK가 유실됐을 수 있음)
+                UdpPacketHeader ack;
+                ack.token = session.token;
+                ack.type = UdpPacketType::ACK;
+                ack.lane = header->lane;
+                ack.sequence = header->sequence;
+                reply = make_packet(ack);
+
+                deliver = accept_reliable(session, header->sequence);
+                if (!deliver) {
+                    duplicates_dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+            } else {
+                auto [latest, inserted] = session.latest_by_lane.try_emplace(header->lane, header->sequence);
+                if (inserted || sequence_newer(header->sequence, latest->second)) {
+                    latest->second = header->sequence;
+                    deliver = true;
+                } else {
+                    stale_dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (deliver) {
+                connection_id = session.connection_id;
+            }
+        } else {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    if (!reply.empty()) {
+        send_packet(reply, receive_from_);
+    }
+    if (!connection_id.empty()) {
+        delivered_.fetch_add(1, std::memory_order_relaxed);
+        if (receive_handler_) {
+            receive_handler_(connection_id, header->lane, packet.substr(UdpPacketHeader::kSize));
+        }
+    }
+}
+
+bool UdpChannel::accept_reliable(Session& session, uint32_t sequence) {
+    if (session.reliable_highest == 0 || sequence_newer(sequence, session.reliable_highest)) {
+        const uint32_t shift = session.reliable_highest == 0 ? 64 : sequence - session.reliable_highest;
+        session.reliable_window = shift >= 64 ? 0 : session.reliable_window << shift;
+        session.reliable_window |= 1;
+        session.reliable_highest = sequence;
+        return true;
+    }
+
+    const uint32_t age = session.reliable_highest - sequence;
+    if (age >= 64) {
+        // 창보다 오래된 번호는 이미 받은 것으로 간주 (송신 측 재전송 횟수가 창보다 훨씬 작음)
+        return false;
+    }
+    const uint64_t bit = uint64_t{1} << age;
+    if (session.reliable_window & bit) {
+        return false;
+    }
+    session.reliable_window |= bit;
+    return true;
+}
+
+void UdpChannel::schedule_resend() {
+    resend_timer_.expires_after(options_.resend_interval);
+    resend_timer_.async_wait([this](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted) {
+            return;
+        }
+        on_resend_timer();
+        schedule_resend();
+    });
+}
+
+void UdpChannel::on_resend_timer() {
+    std::vector<std::pair<std::string, udp::endpoint>> resend;
+    const auto now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        for (auto& [connection_id, session] : sessions_) {
+            auto& pending = session.pending;
+            for (auto it = pending.begin(); it != pending.end();) {
+                if (now - it->sent_at < options_.resend_interval) {
+                    ++it;
+                    continue;
+                }
+                if (it->resends >= options_.max_resends) {
+                    LOG_DEBUG("UDP reliable packet {} to {} expired", it->sequence, connection_id);
+                    reliable_expired_.fetch_add(1, std::memory_order_relaxed);
+                    it = pending.erase(it);
+                    continue;
+                }
+                ++it->resends;
+                it->sent_at = now;
+                resend.emplace_back(it->packet, *session.endpoint);
+                ++it;
+            }
+        }
+    }
+
+    resends_.fetch_add(resend.size(), std::memory_order_relaxed);
+    for (const auto& [packet, endpoint] : resend) {
+        send_packet(packet, endpoint);
+    }
+}
+
+void UdpChannel::send_packet(std::string_view packet, const udp::endpoint& to) {
+    if (simulate_loss()) {
+        return;
+    }
+    // 데이터그램 송신은 블로킹되지 않으므로 호출 스레드에서 바로 보냄 (수신은 채널 스레드의 비동기 작업)
+    boost::system::error_code ec;
+    socket_.send_to(boost::asio::buffer(packet.data(), packet.size()), to, 0, ec);
+    if (ec) {
+        LOG_DEBUG("UDP send to {}:{} failed: {}", to.address().to_string(), to.port(), ec.message());
+        return;
+    }
+    packets_sent_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool UdpChannel::simulate_loss() {
+    if (options_.loss_rate <= 0.0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(loss_mutex_);
+    if (std::uniform_real_distribution<double>(0.0, 1.0)(loss_random_) >= options_.loss_rate) {
+        return false;
+    }
+    simulated_losses_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace mmorpg::network
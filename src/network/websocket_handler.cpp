@@ -1,8 +1,11 @@
 #include "network/websocket_handler.hpp"
 #include "common/logger.hpp"
+#include "common/numa.hpp"
+#include "common/profiler.hpp"
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/asio/strand.hpp>
+#include <algorithm>
 #include <iostream>
 
 namespace mmorpg::network {
@@ -13,7 +16,25 @@ WebSocketConnection::WebSocketConnection(tcp::socket socket, const std::string&
     , ws_(std::move(socket)) {
 }
 
-void WebSocketConnection::perform_handshake() {
+WebSocketConnection::~WebSocketConnection() {
+    if (connection_account_) {
+        connection_account_->release(sizeof(WebSocketConnection));
+    }
+    size_t queued = charged_read_capacity_;
+    for (const auto* queue : {&write_queue_, &deferred_queue_}) {
+        for (const auto& frame : *queue) {
+            queued += frame.payload->size();
+        }
+    }
+    release_queued(queued);
+}
+
+void WebSocketConnection::perform_handshake(SessionMode mode) {
+    if (mode == SessionMode::COROUTINE) {
+        net::co_spawn(ws_.get_executor(), run_session(), net::detached);
+        return;
+    }
+    
     ws_.async_accept(
         [self = shared_from_this()](beast::error_code ec) {
             self->on_handshake(ec);
@@ -21,16 +42,54 @@ void WebSocketConnection::perform_handshake() {
     );
 }
 
+net::awaitable<void> WebSocketConnection::run_session() {
+    // 프레임이 연결을 붙잡으므로 홉마다 shared_from_this()를 캡처하지 않음
+    const auto self = shared_from_this();
+    beast::error_code ec;
+    
+    co_await ws_.async_accept(net::redirect_error(net::use_awaitable, ec));
+    if (!complete_handshake(ec)) {
+        co_return;
+    }
+    
+    for (;;) {
+        const std::size_t bytes_transferred =
+            co_await ws_.async_read(buffer_, net::redirect_error(net::use_awaitable, ec));
+        if (!complete_read(ec, bytes_transferred)) {
+            co_return;
+        }
+    }
+}
+
 void WebSocketConnection::on_handshake(beast::error_code ec) {
+    if (complete_handshake(ec)) {
+        start_reading();
+    }
+}
+
+bool WebSocketConnection::complete_handshake(beast::error_code ec) {
     if (ec) {
         LOG_ERROR("WebSocket handshake failed: {}", ec.message());
-        return;
+        notify_closed();
+        return false;
+    }
+    
+    if (closing_) {
+        // 핸드셰이크 도중 close()가 호출된 경우
+        notify_closed();
+        return false;
     }
     
     connected_.store(true, std::memory_order_release);
     LOG_INFO("WebSocket connection established: {}", connection_id_);
     
-    start_reading();
+    // 퐁은 읽기 작업 안에서 이 콜백으로만 전달됨 (콜백에서 스트림 작업은 시작하지 않음)
+    ws_.control_callback([this](websocket::frame_type kind, beast::string_view payload) {
+        if (kind == websocket::frame_type::pong) {
+            on_pong(std::string_view(payload.data(), payload.size()));
+        }
+    });
+    return true;
 }
 
 void WebSocketConnection::start_reading() {
@@ -43,74 +102,427 @@ void WebSocketConnection::start_reading() {
 }
 
 void WebSocketConnection::on_read(beast::error_code ec, std::size_t bytes_transferred) {
+    if (complete_read(ec, bytes_transferred)) {
+        // 다음 메시지 읽기 계속
+        start_reading();
+    }
+}
+
+bool WebSocketConnection::complete_read(beast::error_code ec, std::size_t bytes_transferred) {
+    PROFILE_ZONE_CAT("ws.on_read", "network");
+    
     if (ec) {
-        if (ec == websocket::error::closed) {
+        if (ec == websocket::error::message_too_big) {
+            // Beast가 too_big close 프레임을 보내고 연결을 닫음 - 한도를 넘는 만큼 버퍼를 키우지 않음
+            LOG_WARNING("Rejected oversized frame from {} (limit {} bytes)", connection_id_,
+                        ws_.read_message_max());
+            if (rejection_stats_) {
+                rejection_stats_->record(FrameRejection::TOO_LARGE);
+            }
+        } else if (ec == websocket::error::closed || ec == net::error::eof ||
+                   ec == net::error::connection_reset) {
             LOG_INFO("WebSocket connection closed: {}", connection_id_);
-        } else {
+        } else if (ec != net::error::operation_aborted) {
             LOG_ERROR("WebSocket read error: {}", ec.message());
         }
         
         connected_.store(false, std::memory_order_release);
-        if (close_handler_) {
-            close_handler_();
+        notify_closed();
+        return false;
+    }
+    
+    const bool is_binary = ws_.got_binary();
+    bytes_in_.fetch_add(bytes_transferred, std::memory_order_relaxed);
+    
+    // 디코드와 핸들러 전에 상태별 규칙 검사 - 위반한 연결은 끊음
+    if (!message_bucket_.try_consume()) {
+        reject_frame(FrameRejection::RATE_LIMITED);
+        return false;
+    }
+    if (frame_policy_) {
+        const auto frame = buffer_.cdata();
+        if (!frame_policy_->allows(std::string_view(static_cast<const char*>(frame.data()), frame.size()),
+                                   is_binary, authenticated_)) {
+            reject_frame(FrameRejection::OPCODE_NOT_ALLOWED);
+            return false;
         }
-        return;
     }
     
-    // 메시지 처리
-    std::string message = beast::buffers_to_string(buffer_.data());
-    buffer_.consume(buffer_.size());
+    if (!is_binary) {
+        // 텍스트 프레임은 커밋되지 않은 꼬리에 NUL을 써서 핸들러가 제자리 파싱할 수 있게 함
+        // (용량이 유지되므로 정상 상태에서는 재할당 없음)
+        auto terminator = buffer_.prepare(1);
+        static_cast<char*>(terminator.data())[0] = '\0';
+    }
+    
+    // flat_buffer는 연속 메모리이므로 복사 없이 수신 버퍼를 그대로 핸들러에 넘김
+    // (prepare가 버퍼를 옮길 수 있으므로 그 뒤에 뷰를 만듦)
+    const auto data = buffer_.cdata();
+    const std::string_view message(static_cast<const char*>(data.data()), data.size());
     
-    LOG_DEBUG("Received message from {}: {}", connection_id_, message);
+    LOG_DEBUG("Received {} byte {} message from {}", message.size(), is_binary ? "binary" : "text",
+              connection_id_);
     
-    if (message_handler_) {
-        message_handler_(message);
+    messages_in_.fetch_add(1, std::memory_order_relaxed);
+    
+    const uint64_t handler_start = mmorpg::common::Profiler::now_ns();
+    if (dispatch_ && dispatch_->on_message) {
+        dispatch_->on_message(connection_id_, message, is_binary);
+    }
+    
+    if (message_stats_) {
+        message_stats_->record_inbound(MessageStats::classify(message, is_binary),
+                                       bytes_transferred,
+                                       mmorpg::common::Profiler::now_ns() - handler_start);
     }
     
-    // 다음 메시지 읽기 계속
-    start_reading();
+    // 핸들러가 반환된 뒤에야 버퍼를 비움 (메시지 뷰 수명)
+    buffer_.consume(buffer_.size());
+    
+    track_read_buffer();
+    return true;
 }
 
-void WebSocketConnection::send_message(const std::string& message) {
+void WebSocketConnection::send_message(const std::string& message, bool binary, SendPriority priority) {
+    send_message(std::make_shared<const std::string>(message), binary, priority);
+}
+
+void WebSocketConnection::send_message(std::shared_ptr<const std::string> message, bool binary,
+                                       SendPriority priority) {
+    PROFILE_ZONE_CAT("ws.send_message", "network");
+    
     if (!connected_.load(std::memory_order_acquire)) {
         LOG_WARNING("Attempted to send message to disconnected connection: {}", connection_id_);
         return;
     }
     
-    std::lock_guard<std::mutex> lock(mutex_);
+    pending_writes_.fetch_add(1, std::memory_order_relaxed);
+    net::post(ws_.get_executor(),
+        [self = shared_from_this(), message = std::move(message), binary, priority]() mutable {
+            self->do_send(std::move(message), binary, priority);
+        }
+    );
+}
+
+void WebSocketConnection::do_send(std::shared_ptr<const std::string> message, bool binary,
+                                  SendPriority priority) {
+    if (!connected_.load(std::memory_order_acquire) || closing_ || detached_) {
+        pending_writes_.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    if (message_stats_) {
+        message_stats_->record_outbound(MessageStats::classify(*message, binary), message->size());
+    }
+    
+    if (buffer_account_) {
+        buffer_account_->charge(message->size());
+    }
+    auto& queue = priority == SendPriority::LOW ? deferred_queue_ : write_queue_;
+    queue.push_back(OutboundFrame{std::move(message), binary});
+    
+    if (write_queue_.size() + deferred_queue_.size() > kMaxPendingWrites) {
+        LOG_WARNING("Outbound queue overflow, closing slow connection: {}", connection_id_);
+        do_close();
+        return;
+    }
+    
+    // 이미 쓰기 중이면 on_write에서, LOW가 토큰을 기다리는 중이면 타이머에서 이어서 전송
+    if (!writing_ && (priority == SendPriority::NORMAL || !shaping_wait_)) {
+        write_next();
+    }
+}
+
+void WebSocketConnection::write_next() {
+    const OutboundFrame* frame = nullptr;
+    const auto now = common::TokenBucket::Clock::now();
     
+    if (!write_queue_.empty()) {
+        // NORMAL은 한도와 관계없이 보내되 빚으로 남겨 LOW 프레임이 그만큼 더 기다리게 함
+        frame = &write_queue_.front();
+        const size_t bytes = frame->payload->size();
+        egress_bucket_.consume(static_cast<double>(bytes), now);
+        if (egress_shaper_) {
+            egress_shaper_->charge(bytes, now);
+        }
+        writing_deferred_ = false;
+    } else if (!deferred_queue_.empty()) {
+        frame = &deferred_queue_.front();
+        const size_t bytes = frame->payload->size();
+        auto wait = egress_bucket_.time_until(static_cast<double>(bytes), now);
+        if (wait == common::TokenBucket::Clock::duration::zero() && egress_shaper_) {
+            wait = egress_shaper_->acquire(bytes, now);
+        }
+        if (wait != common::TokenBucket::Clock::duration::zero()) {
+            wait_for_bandwidth(wait, bytes);
+            return;
+        }
+        egress_bucket_.consume(static_cast<double>(bytes), now);
+        writing_deferred_ = true;
+    } else {
+        if (detached_) {
+            do_close(flushed_close_code_);
+        }
+        return;
+    }
+    
+    writing_ = true;
+    ws_.binary(frame->binary);
     ws_.async_write(
-        net::buffer(message),
+        net::buffer(*frame->payload),
         [self = shared_from_this()](beast::error_code ec, std::size_t bytes_transferred) {
             self->on_write(ec, bytes_transferred);
         }
     );
 }
 
+void WebSocketConnection::wait_for_bandwidth(common::TokenBucket::Clock::duration wait, size_t bytes) {
+    // 이미 기다리는 중이면 그 타이머가 다시 시도
+    if (shaping_wait_) {
+        return;
+    }
+    shaping_wait_ = true;
+    if (egress_shaper_) {
+        egress_shaper_->record_deferred(bytes);
+    }
+    
+    shaping_timer_.expires_after(wait);
+    shaping_timer_.async_wait([self = shared_from_this()](beast::error_code ec) {
+        if (ec) {
+            return;
+        }
+        self->shaping_wait_ = false;
+        if (!self->writing_ && !self->closing_) {
+            self->write_next();
+        }
+    });
+}
+
 void WebSocketConnection::on_write(beast::error_code ec, std::size_t bytes_transferred) {
+    PROFILE_ZONE_CAT("ws.on_write", "network");
+    
+    auto& queue = writing_deferred_ ? deferred_queue_ : write_queue_;
+    release_queued(queue.front().payload->size());
+    queue.pop_front();
+    pending_writes_.fetch_sub(1, std::memory_order_relaxed);
+    writing_ = false;
+    
     if (ec) {
-        LOG_ERROR("WebSocket write error: {}", ec.message());
+        if (ec != net::error::operation_aborted) {
+            LOG_ERROR("WebSocket write error: {}", ec.message());
+        }
         connected_.store(false, std::memory_order_release);
-        if (close_handler_) {
-            close_handler_();
+        shaping_timer_.cancel();
+        
+        // 남은 큐는 버림 - 더 이상 전송할 수 없음
+        for (auto* pending : {&write_queue_, &deferred_queue_}) {
+            pending_writes_.fetch_sub(static_cast<uint32_t>(pending->size()), std::memory_order_relaxed);
+            for (const auto& frame : *pending) {
+                release_queued(frame.payload->size());
+            }
+            pending->clear();
         }
+        
+        beast::error_code ignored;
+        beast::get_lowest_layer(ws_).close(ignored);
+        notify_closed();
+        return;
+    }
+    
+    // 실제로 쓴 뒤에 기록 (큐에서 버려진 프레임은 세지 않음)
+    messages_out_.fetch_add(1, std::memory_order_relaxed);
+    bytes_out_.fetch_add(bytes_transferred, std::memory_order_relaxed);
+    
+    if (!closing_) {
+        write_next();
     }
 }
 
 void WebSocketConnection::close() {
-    if (connected_.load(std::memory_order_acquire)) {
-        connected_.store(false, std::memory_order_release);
-        
-        beast::error_code ec;
-        ws_.close(websocket::close_code::normal, ec);
+    net::post(ws_.get_executor(), [self = shared_from_this()]() {
+        self->do_close();
+    });
+}
+
+void WebSocketConnection::abort() {
+    net::post(ws_.get_executor(), [self = shared_from_this()]() {
+        self->closing_ = true;
+        self->connected_.store(false, std::memory_order_release);
+        self->shaping_timer_.cancel();
         
-        if (ec) {
-            LOG_ERROR("WebSocket close error: {}", ec.message());
+        // 대기 중인 읽기/쓰기/close 작업은 operation_aborted로 완료되며 각 경로에서 notify_closed 호출
+        beast::error_code ignored;
+        beast::get_lowest_layer(self->ws_).close(ignored);
+        self->notify_closed();
+    });
+}
+
+void WebSocketConnection::detach(std::shared_ptr<const std::string> final_frame, bool binary,
+                                 DetachCallback on_detached) {
+    net::post(ws_.get_executor(),
+        [self = shared_from_this(), final_frame = std::move(final_frame), binary,
+         on_detached = std::move(on_detached)]() mutable {
+            self->do_detach(std::move(final_frame), binary, std::move(on_detached));
         }
-        
-        if (close_handler_) {
-            close_handler_();
+    );
+}
+
+void WebSocketConnection::do_detach(std::shared_ptr<const std::string> final_frame, bool binary,
+                                    DetachCallback on_detached) {
+    // 쓰기 중인 프레임은 남기고 나머지를 NORMAL, LOW 순서대로 떼어 냄
+    std::vector<common::PendingFrame> pending;
+    for (auto* queue : {&write_queue_, &deferred_queue_}) {
+        const bool in_flight = writing_ && writing_deferred_ == (queue == &deferred_queue_);
+        auto first = in_flight ? std::next(queue->begin()) : queue->begin();
+        for (auto it = first; it != queue->end(); ++it) {
+            pending.push_back(common::PendingFrame{*it->payload, it->binary});
+            release_queued(it->payload->size());
+            pending_writes_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        queue->erase(first, queue->end());
+    }
+    shaping_timer_.cancel();
+    shaping_wait_ = false;
+    on_detached(std::move(pending));
+    
+    if (!connected_.load(std::memory_order_acquire) || closing_ || detached_) {
+        return;
+    }
+    
+    pending_writes_.fetch_add(1, std::memory_order_relaxed);
+    do_send(std::move(final_frame), binary, SendPriority::NORMAL);
+    detached_ = true;
+}
+
+void WebSocketConnection::drain(std::shared_ptr<const std::string> final_frame, bool binary) {
+    net::post(ws_.get_executor(),
+        [self = shared_from_this(), final_frame = std::move(final_frame), binary]() mutable {
+            self->do_drain(std::move(final_frame), binary);
         }
+    );
+}
+
+void WebSocketConnection::do_drain(std::shared_ptr<const std::string> final_frame, bool binary) {
+    if (!connected_.load(std::memory_order_acquire) || closing_ || detached_) {
+        return;
+    }
+    
+    // 미뤄 둔 LOW 프레임도 한도와 관계없이 보내고, 마지막 프레임까지 쓰고 나면 write_next에서 종료
+    if (!deferred_queue_.empty()) {
+        const bool in_flight = writing_ && writing_deferred_;
+        auto first = in_flight ? std::next(deferred_queue_.begin()) : deferred_queue_.begin();
+        std::move(first, deferred_queue_.end(), std::back_inserter(write_queue_));
+        deferred_queue_.erase(first, deferred_queue_.end());
+    }
+    shaping_timer_.cancel();
+    shaping_wait_ = false;
+    pending_writes_.fetch_add(1, std::memory_order_relaxed);
+    do_send(std::move(final_frame), binary, SendPriority::NORMAL);
+    detached_ = true;
+    flushed_close_code_ = websocket::close_code::going_away;
+}
+
+void WebSocketConnection::send_ping() {
+    net::post(ws_.get_executor(), [self = shared_from_this()]() {
+        self->do_ping();
+    });
+}
+
+void WebSocketConnection::do_ping() {
+    if (!connected_.load(std::memory_order_acquire) || closing_ || ping_writing_) {
+        return;
+    }
+    
+    ping_sent_ns_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    
+    websocket::ping_data payload;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+        payload.push_back(static_cast<char>((ping_sent_ns_ >> (8 * i)) & 0xFF));
+    }
+    
+    ping_writing_ = true;
+    ws_.async_ping(payload,
+        [self = shared_from_this()](beast::error_code) {
+            // 쓰기 실패는 읽기 경로가 감지해 연결을 정리함
+            self->ping_writing_ = false;
+        }
+    );
+}
+
+void WebSocketConnection::on_pong(std::string_view payload) {
+    if (ping_sent_ns_ == 0 || payload.size() != sizeof(uint64_t)) {
+        return;
+    }
+    
+    uint64_t echoed = 0;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+        echoed |= static_cast<uint64_t>(static_cast<uint8_t>(payload[i])) << (8 * i);
+    }
+    if (echoed != ping_sent_ns_) {
+        return;   // 요청하지 않은 퐁이거나 대체된 핑의 응답
+    }
+    ping_sent_ns_ = 0;
+    
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    const uint64_t rtt_ns = static_cast<uint64_t>(now) - echoed;
+    rtt_.record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(rtt_ns)));
+    if (rtt_histogram_) {
+        rtt_histogram_->record(rtt_ns);
+    }
+}
+
+void WebSocketConnection::reject_frame(FrameRejection rejection) {
+    LOG_WARNING("Rejected frame from {} ({}), closing connection", connection_id_, to_string(rejection));
+    if (rejection_stats_) {
+        rejection_stats_->record(rejection);
+    }
+    buffer_.consume(buffer_.size());
+    track_read_buffer();
+    do_close(websocket::close_code::policy_error);
+}
+
+void WebSocketConnection::do_close(websocket::close_code code) {
+    if (closing_) {
+        return;
+    }
+    closing_ = true;
+    shaping_timer_.cancel();
+    
+    if (!connected_.exchange(false, std::memory_order_acq_rel)) {
+        // 핸드셰이크 전이거나 이미 끊긴 연결: 소켓만 닫아 대기 중인 작업을 취소
+        beast::error_code ignored;
+        beast::get_lowest_layer(ws_).close(ignored);
+        notify_closed();
+        return;
+    }
+    
+    ws_.async_close(code,
+        [self = shared_from_this()](beast::error_code ec) {
+            self->on_close(ec);
+        }
+    );
+}
+
+void WebSocketConnection::on_close(beast::error_code ec) {
+    if (ec && ec != net::error::operation_aborted) {
+        LOG_ERROR("WebSocket close error: {}", ec.message());
+    }
+    
+    beast::error_code ignored;
+    beast::get_lowest_layer(ws_).close(ignored);
+    notify_closed();
+}
+
+void WebSocketConnection::notify_closed() {
+    // 읽기/쓰기/종료 경로 중 어느 쪽이 먼저 오더라도 종료 핸들러는 한 번만
+    if (closed_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    
+    if (close_handler_) {
+        close_handler_();
     }
 }
 
@@ -122,18 +534,138 @@ bool WebSocketConnection::is_connected() const {
     return connected_.load(std::memory_order_acquire);
 }
 
-void WebSocketConnection::set_message_handler(std::function<void(const std::string&)> handler) {
-    message_handler_ = std::move(handler);
+void WebSocketConnection::set_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch) {
+    dispatch_ = std::move(dispatch);
+}
+
+void WebSocketConnection::update_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch) {
+    net::post(ws_.get_executor(), [self = shared_from_this(), dispatch = std::move(dispatch)]() mutable {
+        self->dispatch_ = std::move(dispatch);
+    });
 }
 
 void WebSocketConnection::set_close_handler(std::function<void()> handler) {
     close_handler_ = std::move(handler);
 }
 
+void WebSocketConnection::set_message_stats(MessageStats* stats) {
+    message_stats_ = stats;
+}
+
+void WebSocketConnection::set_memory_accounts(common::MemoryAccount* connections, common::MemoryAccount* buffers) {
+    connection_account_ = connections;
+    buffer_account_ = buffers;
+    if (connection_account_) {
+        connection_account_->charge(sizeof(WebSocketConnection));
+    }
+}
+
+void WebSocketConnection::set_frame_policy(std::shared_ptr<const FramePolicy> policy, FrameRejectionStats* stats) {
+    frame_policy_ = std::move(policy);
+    rejection_stats_ = stats;
+    apply_frame_policy();
+}
+
+void WebSocketConnection::update_frame_policy(std::shared_ptr<const FramePolicy> policy) {
+    net::post(ws_.get_executor(), [self = shared_from_this(), policy = std::move(policy)]() mutable {
+        self->frame_policy_ = std::move(policy);
+        self->apply_frame_policy();
+    });
+}
+
+void WebSocketConnection::set_authenticated(bool authenticated) {
+    net::post(ws_.get_executor(), [self = shared_from_this(), authenticated]() {
+        self->authenticated_ = authenticated;
+        self->apply_frame_policy();
+    });
+}
+
+void WebSocketConnection::apply_frame_policy() {
+    if (!frame_policy_) {
+        return;
+    }
+    // 한도는 다음 프레임 헤더를 읽을 때 적용되므로 대기 중인 읽기에도 반영됨
+    ws_.read_message_max(frame_policy_->max_frame(authenticated_));
+    message_bucket_.configure(frame_policy_->messages_per_second, frame_policy_->message_burst);
+}
+
+void WebSocketConnection::release_queued(size_t bytes) {
+    if (buffer_account_ && bytes != 0) {
+        buffer_account_->release(bytes);
+    }
+}
+
+void WebSocketConnection::track_read_buffer() {
+    // flat_buffer는 가장 큰 메시지 크기만큼 용량을 유지하므로 바뀔 때만 기록
+    const size_t capacity = buffer_.capacity();
+    if (!buffer_account_ || capacity == charged_read_capacity_) {
+        return;
+    }
+    if (capacity > charged_read_capacity_) {
+        buffer_account_->charge(capacity - charged_read_capacity_);
+    } else {
+        buffer_account_->release(charged_read_capacity_ - capacity);
+    }
+    charged_read_capacity_ = capacity;
+}
+
+void WebSocketConnection::set_rtt_histogram(common::LatencyHistogram* histogram) {
+    rtt_histogram_ = histogram;
+}
+
+void WebSocketConnection::set_egress_shaper(NodeEgressShaper* shaper) {
+    egress_shaper_ = shaper;
+}
+
+void WebSocketConnection::set_bandwidth_limit(uint64_t bytes_per_second) {
+    net::post(ws_.get_executor(), [self = shared_from_this(), bytes_per_second]() {
+        self->egress_bucket_.configure(static_cast<double>(bytes_per_second),
+                                       BandwidthLimits::burst_for(bytes_per_second));
+    });
+}
+
+RttSnapshot WebSocketConnection::get_rtt() const {
+    return rtt_.snapshot();
+}
+
+ConnectionTraffic WebSocketConnection::get_traffic() const {
+    ConnectionTraffic traffic;
+    traffic.connection_id = connection_id_;
+    traffic.messages_in = messages_in_.load(std::memory_order_relaxed);
+    traffic.bytes_in = bytes_in_.load(std::memory_order_relaxed);
+    traffic.messages_out = messages_out_.load(std::memory_order_relaxed);
+    traffic.bytes_out = bytes_out_.load(std::memory_order_relaxed);
+    traffic.pending_writes = pending_writes_.load(std::memory_order_relaxed);
+    const auto rtt = rtt_.snapshot();
+    traffic.rtt_us = rtt.smoothed_us;
+    traffic.rtt_jitter_us = rtt.jitter_us;
+    return traffic;
+}
+
 // WebSocketHandler 구현
-WebSocketHandler::WebSocketHandler(uint16_t port)
+WebSocketHandler::WebSocketHandler(uint16_t port, uint32_t worker_threads)
     : port_(port)
-    , acceptor_(io_context_) {
+    , worker_thread_count_(worker_threads)
+    , shards_(make_shards())
+    , acceptor_(net::make_strand(shards_.front()->io_context))
+    , ping_timer_(net::make_strand(shards_.front()->io_context))
+    , frame_policy_(std::make_shared<const FramePolicy>())
+    , dispatch_(std::make_shared<const WebSocketDispatch>()) {
+}
+
+std::vector<std::unique_ptr<WebSocketHandler::IoShard>> WebSocketHandler::make_shards() {
+    const auto& topology = mmorpg::common::NumaTopology::instance();
+    const size_t count = mmorpg::common::memory_placement().numa_aware ? topology.node_count() : 1;
+    
+    std::vector<std::unique_ptr<IoShard>> shards;
+    for (size_t i = 0; i < count; ++i) {
+        shards.push_back(std::make_unique<IoShard>());
+    }
+    return shards;
+}
+
+WebSocketHandler::~WebSocketHandler() {
+    stop();
 }
 
 void WebSocketHandler::start() {
@@ -144,15 +676,30 @@ void WebSocketHandler::start() {
     
     running_.store(true, std::memory_order_release);
     
-    // 워커 스레드 시작
-    const size_t num_threads = std::thread::hardware_concurrency();
-    work_ = std::make_unique<net::io_context::work>(io_context_);
+    // stop() 이후 재시작 지원
+    for (auto& shard : shards_) {
+        shard->io_context.restart();
+        shard->work = std::make_unique<net::io_context::work>(shard->io_context);
+    }
+    
+    // 워커 스레드 시작 - 샤드가 여럿이면 스레드 i는 노드 (i % 샤드 수)에 고정
+    const size_t configured_threads = worker_thread_count_ ? worker_thread_count_
+                                                           : std::max(1u, std::thread::hardware_concurrency());
+    const size_t num_threads = std::max(configured_threads, shards_.size());
     
     for (size_t i = 0; i < num_threads; ++i) {
-        worker_threads_.emplace_back([this]() {
-            io_context_.run();
+        const size_t shard_index = i % shards_.size();
+        worker_threads_.emplace_back([this, i, shard_index]() {
+            mmorpg::common::Profiler::instance().set_thread_name("ws_io_" + std::to_string(i));
+            if (shards_.size() > 1 && !mmorpg::common::bind_thread_to_node(shard_index)) {
+                LOG_WARNING("Failed to bind I/O thread {} to NUMA node {}", i, shard_index);
+            }
+            shards_[shard_index]->io_context.run();
         });
     }
+    if (shards_.size() > 1) {
+        LOG_INFO("WebSocket I/O split into {} NUMA shards ({} threads)", shards_.size(), num_threads);
+    }
     
     // 서버 시작
     beast::error_code ec;
@@ -182,8 +729,15 @@ void WebSocketHandler::start() {
         return;
     }
     
-    LOG_INFO("WebSocket server started on port {}", port_);
+    LOG_INFO("WebSocket server started on port {} ({} backend, {} sessions, {} shards)", get_port(),
+             get_io_backend(), to_string(session_mode_), shards_.size());
     start_accept();
+    
+    if (ping_interval_.count() > 0) {
+        net::post(ping_timer_.get_executor(), [this]() {
+            schedule_ping();
+        });
+    }
 }
 
 void WebSocketHandler::stop() {
@@ -193,18 +747,30 @@ void WebSocketHandler::stop() {
     
     running_.store(false, std::memory_order_release);
     
-    // 모든 연결 종료
-    {
-        std::lock_guard<std::mutex> lock(connections_mutex_);
-        for (auto& [id, connection] : connections_) {
-            connection->close();
+    // 새 연결 수락 중지 (acceptor는 자기 strand에서만 조작)
+    stop_accepting();
+    net::post(ping_timer_.get_executor(), [this]() {
+        ping_timer_.cancel();
+    });
+    
+    // 모든 연결 종료: 종료 핸들러가 connections_mutex_를 잡으므로 잠금 밖에서 close() 호출
+    for (auto& connection : snapshot_connections()) {
+        connection->close();
+    }
+    
+    // close 프레임 교환을 잠시 기다린 뒤, 응답하지 않는 연결은 강제로 끊음
+    if (!wait_for_connections_drained(kShutdownGracePeriod)) {
+        for (auto& connection : snapshot_connections()) {
+            connection->abort();
         }
-        connections_.clear();
+        wait_for_connections_drained(kShutdownGracePeriod);
     }
     
     // 워커 스레드 중지
-    work_.reset();
-    io_context_.stop();
+    for (auto& shard : shards_) {
+        shard->work.reset();
+        shard->io_context.stop();
+    }
     
     for (auto& thread : worker_threads_) {
         if (thread.joinable()) {
@@ -213,125 +779,361 @@ void WebSocketHandler::stop() {
     }
     
     worker_threads_.clear();
+    
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        connections_.clear();
+    }
+    
     LOG_INFO("WebSocket server stopped");
 }
 
 void WebSocketHandler::start_accept() {
+    // 연결마다 독립 strand - 연결 내부 작업은 직렬화, 연결 간에는 병렬. 샤드는 번갈아 배정
+    auto& shard = *shards_[next_shard_++ % shards_.size()];
     acceptor_.async_accept(
+        net::make_strand(shard.io_context),
         [this](beast::error_code ec, tcp::socket socket) {
             on_accept(ec, std::move(socket));
         }
     );
 }
 
+void WebSocketHandler::schedule_ping() {
+    ping_timer_.expires_after(ping_interval_);
+    ping_timer_.async_wait([this](beast::error_code ec) {
+        on_ping_timer(ec);
+    });
+}
+
+void WebSocketHandler::on_ping_timer(beast::error_code ec) {
+    if (ec || !running_.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    // 실제 전송은 각 연결의 strand에서 (타이머 스트랜드는 post만 함)
+    for (auto& connection : snapshot_connections()) {
+        connection->send_ping();
+    }
+    schedule_ping();
+}
+
 void WebSocketHandler::on_accept(beast::error_code ec, tcp::socket socket) {
+    PROFILE_ZONE_CAT("ws.on_accept", "network");
+    
     if (ec) {
+        if (ec == net::error::operation_aborted || !running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        
+        // EMFILE 등 일시적 오류로 수락 루프가 멈추지 않도록 계속 대기
         LOG_ERROR("Accept error: {}", ec.message());
+        start_accept();
         return;
     }
     
+    // 작은 게임 패킷이 Nagle + delayed ACK에 묶여 수십 ms 지연되지 않도록
+    beast::error_code option_ec;
+    socket.set_option(tcp::no_delay(true), option_ec);
+    
     // 새 연결 ID 생성
     std::string connection_id = "conn_" + std::to_string(next_connection_id_.fetch_add(1));
     
+    if (shards_.size() > 1) {
+        // 연결 객체와 버퍼를 배정된 샤드의 스레드에서 만들어 그 노드 메모리에 놓음
+        net::post(socket.get_executor(),
+                  [this, socket = std::move(socket), connection_id = std::move(connection_id)]() mutable {
+                      create_connection(std::move(socket), connection_id);
+                  });
+    } else {
+        create_connection(std::move(socket), connection_id);
+    }
+    
+    // 다음 연결 대기
+    start_accept();
+}
+
+void WebSocketHandler::create_connection(tcp::socket socket, const std::string& connection_id) {
+    if (!running_.load(std::memory_order_acquire)) {
+        return;   // 샤드로 넘기는 사이 stop()이 시작됨 (소켓은 소멸 시 닫힘)
+    }
+    
     // WebSocket 연결 생성
     auto connection = std::make_shared<WebSocketConnection>(std::move(socket), connection_id);
     
-    // 핸들러 설정
-    connection->set_message_handler(
-        [this, connection_id](const std::string& message) {
-            on_message(connection_id, message);
-        }
-    );
-    
+    // 종료 핸들러 설정 (수신 메시지는 게시된 콜백 묶음으로 연결이 직접 전달)
     connection->set_close_handler(
         [this, connection_id]() {
             on_disconnection(connection_id);
         }
     );
     
-    // 연결 저장
+    connection->set_message_stats(&message_stats_);
+    connection->set_rtt_histogram(&rtt_histogram_);
+    connection->set_egress_shaper(&egress_shaper_);
+    connection->set_memory_accounts(connection_account_, buffer_account_);
+    
+    // 연결 저장 (규칙/한도/콜백 게시와 같은 잠금 안에서 받아야 새 값을 놓치지 않음)
+    std::shared_ptr<const WebSocketDispatch> dispatch;
     {
         std::lock_guard<std::mutex> lock(connections_mutex_);
-        connections_[connection_id] = connection;
+        dispatch = dispatch_;
+        connection->set_dispatch(dispatch);
+        connection->set_frame_policy(frame_policy_, &frame_rejections_);
+        if (bandwidth_limits_.connection_bytes_per_second != 0) {
+            connection->set_bandwidth_limit(bandwidth_limits_.connection_bytes_per_second);
+        }
+        connections_.insert_or_assign(connection_id, connection);
     }
     
     // 연결 핸드셰이크 시작
-    connection->perform_handshake();
+    connection->perform_handshake(session_mode_);
     
     // 연결 핸들러 호출
-    on_connection(connection_id);
-    
-    // 다음 연결 대기
-    start_accept();
+    on_connection(connection_id, *dispatch);
 }
 
-void WebSocketHandler::send_to_connection(const std::string& connection_id, const std::string& message) {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
-    
-    auto it = connections_.find(connection_id);
-    if (it != connections_.end()) {
-        it->second->send_message(message);
-    } else {
+void WebSocketHandler::send_to_connection(const std::string& connection_id, const std::string& message,
+                                          bool binary, SendPriority priority) {
+    const bool found = connections_.visit(connection_id, [&](const ConnectionPtr& connection) {
+        connection->send_message(message, binary, priority);
+    });
+    if (!found) {
         LOG_WARNING("Connection not found: {}", connection_id);
     }
 }
 
-void WebSocketHandler::broadcast(const std::string& message) {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
+bool WebSocketHandler::detach_connection(const std::string& connection_id, const std::string& final_frame,
+                                         bool binary, WebSocketConnection::DetachCallback on_detached) {
+    return connections_.visit(connection_id, [&](const ConnectionPtr& connection) {
+        connection->detach(std::make_shared<const std::string>(final_frame), binary, std::move(on_detached));
+    });
+}
+
+bool WebSocketHandler::drain_connection(const std::string& connection_id, const std::string& final_frame,
+                                        bool binary) {
+    const auto connection = connections_.find(connection_id);
+    if (!connection) {
+        return false;
+    }
     
-    for (auto& [id, connection] : connections_) {
+    (*connection)->drain(std::make_shared<const std::string>(final_frame), binary);
+    return true;
+}
+
+void WebSocketHandler::stop_accepting() {
+    net::post(acceptor_.get_executor(), [this]() {
+        beast::error_code ignored;
+        acceptor_.close(ignored);
+    });
+}
+
+std::vector<std::string> WebSocketHandler::get_connection_ids() const {
+    std::vector<std::string> ids;
+    ids.reserve(connections_.size());
+    connections_.for_each([&ids](const std::string& id, const ConnectionPtr&) {
+        ids.push_back(id);
+    });
+    return ids;
+}
+
+void WebSocketHandler::broadcast(const std::string& message, bool binary, SendPriority priority) {
+    PROFILE_ZONE_CAT("ws.broadcast", "network");
+    
+    // 모든 연결이 같은 버퍼를 공유
+    auto shared_message = std::make_shared<const std::string>(message);
+    
+    connections_.for_each([&](const std::string&, const ConnectionPtr& connection) {
         if (connection->is_connected()) {
-            connection->send_message(message);
+            connection->send_message(shared_message, binary, priority);
         }
+    });
+}
+
+std::vector<WebSocketHandler::ConnectionPtr> WebSocketHandler::snapshot_connections() const {
+    std::vector<ConnectionPtr> result;
+    result.reserve(connections_.size());
+    connections_.for_each([&result](const std::string&, const ConnectionPtr& connection) {
+        result.push_back(connection);
+    });
+    return result;
+}
+
+bool WebSocketHandler::wait_for_connections_drained(std::chrono::milliseconds timeout) const {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;) {
+        if (connections_.empty()) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
     }
 }
 
+uint16_t WebSocketHandler::get_port() const {
+    beast::error_code ec;
+    auto endpoint = acceptor_.local_endpoint(ec);
+    return ec ? port_ : endpoint.port();
+}
+
 size_t WebSocketHandler::get_connection_count() const {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
     return connections_.size();
 }
 
 bool WebSocketHandler::has_connection(const std::string& connection_id) const {
+    return connections_.contains(connection_id);
+}
+
+void WebSocketHandler::set_handlers(WebSocketDispatch handlers) {
     std::lock_guard<std::mutex> lock(connections_mutex_);
-    return connections_.find(connection_id) != connections_.end();
+    publish_dispatch(std::make_shared<const WebSocketDispatch>(std::move(handlers)));
 }
 
 void WebSocketHandler::set_message_handler(MessageHandler handler) {
-    message_handler_ = std::move(handler);
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto handlers = *dispatch_;
+    handlers.on_message = std::move(handler);
+    publish_dispatch(std::make_shared<const WebSocketDispatch>(std::move(handlers)));
 }
 
 void WebSocketHandler::set_connection_handler(ConnectionHandler handler) {
-    connection_handler_ = std::move(handler);
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto handlers = *dispatch_;
+    handlers.on_connection = std::move(handler);
+    publish_dispatch(std::make_shared<const WebSocketDispatch>(std::move(handlers)));
 }
 
 void WebSocketHandler::set_disconnection_handler(ConnectionHandler handler) {
-    disconnection_handler_ = std::move(handler);
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto handlers = *dispatch_;
+    handlers.on_disconnection = std::move(handler);
+    publish_dispatch(std::make_shared<const WebSocketDispatch>(std::move(handlers)));
 }
 
-void WebSocketHandler::on_message(const std::string& connection_id, const std::string& message) {
-    if (message_handler_) {
-        message_handler_(connection_id, message);
-    }
+void WebSocketHandler::publish_dispatch(std::shared_ptr<const WebSocketDispatch> dispatch) {
+    // connections_mutex_를 잡은 상태에서 호출 (복사-수정-게시가 다른 교체와 섞이지 않도록)
+    dispatch_ = dispatch;
+    connections_.for_each([&dispatch](const std::string&, const ConnectionPtr& connection) {
+        connection->update_dispatch(dispatch);
+    });
+}
+
+void WebSocketHandler::set_memory_accounts(common::MemoryAccount* connections, common::MemoryAccount* buffers) {
+    connection_account_ = connections;
+    buffer_account_ = buffers;
+}
+
+void WebSocketHandler::set_frame_policy(FramePolicy policy) {
+    auto published = std::make_shared<const FramePolicy>(std::move(policy));
+    
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    frame_policy_ = published;
+    connections_.for_each([&published](const std::string&, const ConnectionPtr& connection) {
+        connection->update_frame_policy(published);
+    });
+}
+
+bool WebSocketHandler::set_connection_authenticated(const std::string& connection_id, bool authenticated) {
+    return connections_.visit(connection_id, [authenticated](const ConnectionPtr& connection) {
+        connection->set_authenticated(authenticated);
+    });
+}
+
+FrameRejectionCounts WebSocketHandler::get_frame_rejections() const {
+    return frame_rejections_.snapshot();
+}
+
+void WebSocketHandler::set_session_mode(SessionMode mode) {
+    session_mode_ = mode;
+}
+
+SessionMode WebSocketHandler::get_session_mode() const noexcept {
+    return session_mode_;
+}
+
+void WebSocketHandler::set_ping_interval(std::chrono::milliseconds interval) {
+    ping_interval_ = interval;
+}
+
+std::optional<RttSnapshot> WebSocketHandler::get_connection_rtt(const std::string& connection_id) const {
+    std::optional<RttSnapshot> rtt;
+    connections_.visit(connection_id, [&rtt](const ConnectionPtr& connection) {
+        rtt = connection->get_rtt();
+    });
+    return rtt;
+}
+
+common::HistogramSnapshot WebSocketHandler::get_rtt_histogram() const {
+    return rtt_histogram_.snapshot();
+}
+
+void WebSocketHandler::set_bandwidth_limits(const BandwidthLimits& limits) {
+    egress_shaper_.configure(limits.node_bytes_per_second);
+    
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    bandwidth_limits_ = limits;
+    connections_.for_each([&limits](const std::string&, const ConnectionPtr& connection) {
+        connection->set_bandwidth_limit(limits.connection_bytes_per_second);
+    });
+}
+
+EgressStats WebSocketHandler::get_egress_stats() const {
+    return egress_shaper_.get_stats();
+}
+
+std::optional<ConnectionTraffic> WebSocketHandler::get_connection_traffic(const std::string& connection_id) const {
+    std::optional<ConnectionTraffic> traffic;
+    connections_.visit(connection_id, [&traffic](const ConnectionPtr& connection) {
+        traffic = connection->get_traffic();
+    });
+    return traffic;
+}
+
+const MessageStats& WebSocketHandler::get_message_stats() const {
+    return message_stats_;
+}
+
+std::vector<ConnectionTraffic> WebSocketHandler::collect_connection_traffic() const {
+    std::vector<ConnectionTraffic> result;
+    result.reserve(connections_.size());
+    connections_.for_each([&result](const std::string&, const ConnectionPtr& connection) {
+        result.push_back(connection->get_traffic());
+    });
+    
+    return result;
+}
+
+size_t WebSocketHandler::get_outbound_queue_depth() const {
+    size_t depth = 0;
+    connections_.for_each([&depth](const std::string&, const ConnectionPtr& connection) {
+        depth += connection->get_traffic().pending_writes;
+    });
+    
+    return depth;
 }
 
-void WebSocketHandler::on_connection(const std::string& connection_id) {
+void WebSocketHandler::on_connection(const std::string& connection_id, const WebSocketDispatch& dispatch) {
     LOG_INFO("New WebSocket connection: {}", connection_id);
     
-    if (connection_handler_) {
-        connection_handler_(connection_id);
+    if (dispatch.on_connection) {
+        dispatch.on_connection(connection_id);
     }
 }
 
 void WebSocketHandler::on_disconnection(const std::string& connection_id) {
     LOG_INFO("WebSocket connection disconnected: {}", connection_id);
     
+    std::shared_ptr<const WebSocketDispatch> dispatch;
     {
         std::lock_guard<std::mutex> lock(connections_mutex_);
         connections_.erase(connection_id);
+        dispatch = dispatch_;
     }
     
-    if (disconnection_handler_) {
-        disconnection_handler_(connection_id);
+    if (dispatch->on_disconnection) {
+        dispatch->on_disconnection(connection_id);
     }
 }
 
@@ -0,0 +1,103 @@
+#include "protocol/json_codec.hpp"
+#include <rapidjson/error/en.h>
+#include <algorithm>
+#include <bit>
+
+namespace mmorpg::protocol::json {
+
+namespace {
+
+// 파서 값 스택 초기 용량 (스택도 풀에서 할당)
+constexpr size_t kParseStackCapacity = 1024;
+
+} // namespace
+
+JsonReader::JsonReader(size_t initial_pool_size, size_t max_pool_size)
+    : pool_size_(initial_pool_size)
+    , max_pool_size_(std::max(initial_pool_size, max_pool_size)) {
+    rebuild(pool_size_);
+}
+
+void JsonReader::rebuild(size_t pool_size) {
+    // 문서가 할당자를, 할당자가 버퍼를 참조하므로 역순으로 파괴
+    document_.reset();
+    stack_allocator_.reset();
+    value_allocator_.reset();
+
+    pool_size_ = pool_size;
+    value_buffer_ = std::make_unique<char[]>(pool_size_);
+    stack_buffer_ = std::make_unique<char[]>(pool_size_);
+
+    value_allocator_.emplace(value_buffer_.get(), pool_size_);
+    stack_allocator_.emplace(stack_buffer_.get(), pool_size_);
+    document_.emplace(&*value_allocator_, kParseStackCapacity, &*stack_allocator_);
+}
+
+const Document* JsonReader::parse_insitu(char* text) {
+    // 이전 메시지의 값은 풀에 있으므로 풀을 비우기 전에 루트를 먼저 비움
+    document_->SetNull();
+
+    // 사용자 버퍼를 넘어 청크를 추가로 할당한 적이 있으면 그만큼 키워서 다시 만듦
+    const size_t used = std::max(value_allocator_->Capacity(), stack_allocator_->Capacity());
+    if (used > pool_size_) {
+        ++overflow_count_;
+
+        const size_t next = std::min(std::bit_ceil(used), max_pool_size_);
+        if (next > pool_size_) {
+            rebuild(next);
+        }
+    }
+
+    value_allocator_->Clear();
+    stack_allocator_->Clear();
+
+    document_->ParseInsitu(text);
+    return document_->HasParseError() ? nullptr : &*document_;
+}
+
+std::string_view JsonReader::get_error() const {
+    if (!document_->HasParseError()) {
+        return {};
+    }
+    return rapidjson::GetParseError_En(document_->GetParseError());
+}
+
+size_t JsonReader::get_error_offset() const {
+    return document_->GetErrorOffset();
+}
+
+JsonWriter::JsonWriter(size_t reserve)
+    : stream_(output_)
+    , writer_(stream_) {
+    output_.reserve(reserve);
+}
+
+Writer& JsonWriter::begin() {
+    output_.clear();
+    writer_.Reset(stream_);
+    return writer_;
+}
+
+std::optional<std::string_view> get_string(const Value& object, const char* key) {
+    if (!object.IsObject()) {
+        return std::nullopt;
+    }
+    const auto member = object.FindMember(key);
+    if (member == object.MemberEnd() || !member->value.IsString()) {
+        return std::nullopt;
+    }
+    return std::string_view(member->value.GetString(), member->value.GetStringLength());
+}
+
+std::optional<uint64_t> get_uint64(const Value& object, const char* key) {
+    if (!object.IsObject()) {
+        return std::nullopt;
+    }
+    const auto member = object.FindMember(key);
+    if (member == object.MemberEnd() || !member->value.IsUint64()) {
+        return std::nullopt;
+    }
+    return member->value.GetUint64();
+}
+
+} // namespace mmorpg::protocol::json
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "common/metrics.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace mmorpg::tests::stress {
+
+/**
+ * @brief 소크 모드 실행 시간 (MMORPG_SOAK_SECONDS, 미설정 시 0 = 소크 테스트 건너뜀)
+ */
+inline std::chrono::seconds soak_duration() {
+    const char* value = std::getenv("MMORPG_SOAK_SECONDS");
+    if (value == nullptr) {
+        return std::chrono::seconds(0);
+    }
+    return std::chrono::seconds(std::strtoll(value, nullptr, 10));
+}
+
+/**
+ * @brief 반복 횟수에 MMORPG_STRESS_SCALE 배율 적용 (기본 1.0, TSan 빌드에서는 0.1 등으로 낮춤)
+ */
+inline uint32_t scaled_iterations(uint32_t base) {
+    const char* value = std::getenv("MMORPG_STRESS_SCALE");
+    const double scale = value != nullptr ? std::strtod(value, nullptr) : 1.0;
+    if (scale <= 0.0) {
+        return base;
+    }
+    return std::max<uint32_t>(1, static_cast<uint32_t>(base * scale));
+}
+
+/**
+ * @brief 현재 프로세스 RSS (바이트)
+ */
+inline size_t current_rss_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/**
+ * @brief 현재 열린 파일 디스크립터 수
+ */
+inline size_t open_fd_count() {
+    size_t count = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::directory_iterator("/proc/self/fd", ec);
+         !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @brief 연산별 처리량/지연 기록기
+ *
+ * 여러 스레드에서 record()를 호출하고 마지막에 report()로 연산별
+ * ops/s와 p50/p99를 출력합니다. 값은 gtest 속성으로도 남겨
+ * --gtest_output=xml 결과에서 회귀를 추적할 수 있습니다.
+ */
+class ThroughputReport {
+public:
+    explicit ThroughputReport(std::string suite)
+        : suite_(std::move(suite))
+        , started_(std::chrono::steady_clock::now()) {
+    }
+
+    common::LatencyHistogram& histogram(const std::string& operation) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return histograms_[operation];
+    }
+
+    void report() {
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - started_).count();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::cout << "[stress] " << suite_ << " (" << std::fixed << std::setprecision(2)
+                  << seconds << " s)\n";
+        for (const auto& [operation, histogram] : histograms_) {
+            const auto snapshot = histogram.snapshot();
+            const double ops_per_sec = static_cast<double>(snapshot.count) / seconds;
+            std::cout << "  " << std::left << std::setw(28) << operation << std::right
+                      << std::setw(10) << snapshot.count << " ops "
+                      << std::setw(12) << std::setprecision(0) << ops_per_sec << " ops/s"
+                      << "  p50=" << std::setprecision(1) << snapshot.percentile(0.50) / 1e3 << "us"
+                      << "  p99=" << snapshot.percentile(0.99) / 1e3 << "us\n";
+            ::testing::Test::RecordProperty(operation + "_ops_per_sec",
+                                            std::to_string(static_cast<uint64_t>(ops_per_sec)));
+        }
+        std::cout << std::flush;
+    }
+
+private:
+    std::string suite_;
+    std::chrono::steady_clock::time_point started_;
+    std::mutex mutex_;
+    std::map<std::string, common::LatencyHistogram> histograms_;
+};
+
+/**
+ * @brief 히스토그램에 경과 시간을 기록하는 RAII 타이머
+ */
+class ScopedLatency {
+public:
+    explicit ScopedLatency(common::LatencyHistogram& histogram)
+        : histogram_(histogram)
+        , start_(std::chrono::steady_clock::now()) {
+    }
+
+    ~ScopedLatency() {
+        histogram_.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count()));
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    common::LatencyHistogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief 소크 구간별 자원 사용량 샘플
+ */
+struct SoakWindow {
+    size_t rss_bytes = 0;
+    size_t open_fds = 0;
+    common::HistogramSnapshot latency;
+};
+
+/**
+ * @brief 소크 결과 검증: 메모리 증가, fd 누수, 지연 드리프트
+ *
+ * 첫 구간은 할당자/해시 테이블 워밍업으로 보고 두 번째 구간을 기준으로 비교합니다.
+ */
+inline void expect_no_soak_regression(const std::vector<SoakWindow>& windows,
+                                      size_t max_rss_growth_bytes = 64ull * 1024 * 1024,
+                                      size_t max_fd_growth = 16,
+                                      double max_p99_drift = 4.0) {
+    ASSERT_GE(windows.size(), 3u) << "soak run too short to compare windows";
+
+    const auto& baseline = windows[1];
+    const auto& last = windows.back();
+
+    for (size_t i = 0; i < windows.size(); ++i) {
+        std::cout << "[soak] window " << i
+                  << " rss=" << windows[i].rss_bytes / 1024 << "KB"
+                  << " fds=" << windows[i].open_fds
+                  << " p99=" << windows[i].latency.percentile(0.99) / 1e3 << "us"
+                  << " ops=" << windows[i].latency.count << "\n";
+    }
+    std::cout << std::flush;
+
+    EXPECT_LE(last.rss_bytes, baseline.rss_bytes + max_rss_growth_bytes) << "memory growth during soak";
+    EXPECT_LE(last.open_fds, baseline.open_fds + max_fd_growth) << "file descriptor leak during soak";
+
+    const double baseline_p99 = std::max(baseline.latency.percentile(0.99), 1.0);
+    EXPECT_LE(last.latency.percentile(0.99) / baseline_p99, max_p99_drift) << "p99 latency drift during soak";
+}
+
+} // namespace mmorpg::tests::stress
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include "agents/connection_manager/connection_manager.hpp"
+#include "common/logger.hpp"
+#include "stress_utils.hpp"
+#include <atomic>
+#include <barrier>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests::stress {
+
+using mmorpg::agents::connection_manager::ConnectionManagerAgent;
+
+class ConnectionManagerStressTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 연결마다 남는 INFO 로그가 측정을 지배하지 않도록
+        spdlog::set_level(spdlog::level::warn);
+    }
+
+    void TearDown() override {
+        spdlog::set_level(spdlog::level::info);
+    }
+
+    static uint32_t thread_count() {
+        return std::max(4u, std::min(16u, std::thread::hardware_concurrency() * 2));
+    }
+
+    static double stat(const ConnectionManagerAgent& manager, const std::string& key) {
+        return manager.get_connection_stats().at(key);
+    }
+};
+
+// 모든 스레드가 동시에 한도에 도달해도 max_connections를 넘지 않아야 함
+TEST_F(ConnectionManagerStressTest, ConcurrentConnectRespectsLimit) {
+    constexpr uint32_t kMaxConnections = 256;
+    ConnectionManagerAgent manager(kMaxConnections);
+
+    const uint32_t threads = thread_count();
+    const uint32_t attempts_per_thread = scaled_iterations(200);
+    std::atomic<uint32_t> accepted{0};
+    std::barrier start_line(threads);
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            start_line.arrive_and_wait();
+            for (uint32_t i = 0; i < attempts_per_thread; ++i) {
+                const std::string id = "t" + std::to_string(t) + "_" + std::to_string(i);
+                if (manager.handle_new_connection(id, "10.0.0.1")) {
+                    accepted.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const uint32_t expected = std::min(kMaxConnections, threads * attempts_per_thread);
+    EXPECT_EQ(accepted.load(), expected);
+    EXPECT_EQ(stat(manager, "total_connections"), expected);
+}
+
+// 같은 ID로 동시에 접속하면 정확히 한 번만 수락되어야 함
+TEST_F(ConnectionManagerStressTest, DuplicateIdAcceptedOnce) {
+    ConnectionManagerAgent manager(1000);
+
+    const uint32_t threads = thread_count();
+    const uint32_t rounds = scaled_iterations(200);
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        const std::string id = "dup_" + std::to_string(round);
+        std::atomic<uint32_t> accepted{0};
+        std::barrier start_line(threads);
+
+        std::vector<std::thread> workers;
+        for (uint32_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                start_line.arrive_and_wait();
+                if (manager.handle_new_connection(id, "10.0.0.2")) {
+                    accepted.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        ASSERT_EQ(accepted.load(), 1u) << "round " << round;
+        manager.handle_disconnection(id);
+    }
+
+    EXPECT_EQ(stat(manager, "total_connections"), 0.0);
+}
+
+// 공유 ID 풀에서 모든 연산을 무작위로 섞어 실행 - 카운터가 실제 맵과 일치해야 함
+TEST_F(ConnectionManagerStressTest, MixedOperationChurn) {
+    constexpr uint32_t kIdPool = 512;
+    ConnectionManagerAgent manager(kIdPool);
+    ThroughputReport report("ConnectionManagerAgent mixed churn");
+
+    auto& connect_latency = report.histogram("handle_new_connection");
+    auto& disconnect_latency = report.histogram("handle_disconnection");
+    auto& authenticate_latency = report.histogram("authenticate_connection");
+    auto& activity_latency = report.histogram("update_activity");
+    auto& info_latency = report.histogram("get_connection_info");
+    auto& cleanup_latency = report.histogram("cleanup_inactive_connections");
+
+    const uint32_t threads = thread_count();
+    const uint32_t operations_per_thread = scaled_iterations(50000);
+    std::atomic<bool> churning{true};
+    std::barrier start_line(threads + 1);
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::mt19937 rng(t + 1);
+            std::uniform_int_distribution<uint32_t> pick_id(0, kIdPool - 1);
+            std::uniform_int_distribution<uint32_t> pick_op(0, 99);
+
+            start_line.arrive_and_wait();
+            for (uint32_t i = 0; i < operations_per_thread; ++i) {
+                const std::string id = "conn_" + std::to_string(pick_id(rng));
+                const uint32_t op = pick_op(rng);
+
+                if (op < 25) {
+                    ScopedLatency timer(connect_latency);
+                    manager.handle_new_connection(id, "10.0.0.3");
+                } else if (op < 45) {
+                    ScopedLatency timer(disconnect_latency);
+                    manager.handle_disconnection(id);
+                } else if (op < 60) {
+                    ScopedLatency timer(authenticate_latency);
+                    manager.authenticate_connection(id, "user_" + id);
+                } else if (op < 95) {
+                    ScopedLatency timer(activity_latency);
+                    manager.update_activity(id);
+                } else {
+                    ScopedLatency timer(info_latency);
+                    auto info = manager.get_connection_info(id);
+                    if (info) {
+                        EXPECT_EQ(info->connection_id, id);
+                    }
+                }
+            }
+        });
+    }
+
+    // 정리 스레드: 짧은 타임아웃으로 워커와 경쟁
+    std::thread janitor([&]() {
+        start_line.arrive_and_wait();
+        while (churning.load(std::memory_order_relaxed)) {
+            {
+                ScopedLatency timer(cleanup_latency);
+                manager.cleanup_inactive_connections(std::chrono::seconds(0));
+            }
+            auto stats = manager.get_connection_stats();
+            EXPECT_LE(stats.at("authenticated_connections"), stats.at("total_connections"));
+            EXPECT_LE(stats.at("total_connections"), kIdPool);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    churning.store(false, std::memory_order_relaxed);
+    janitor.join();
+
+    // 정지 상태에서 카운터와 실제 맵 비교
+    uint32_t present = 0;
+    uint32_t authenticated = 0;
+    for (uint32_t i = 0; i < kIdPool; ++i) {
+        auto info = manager.get_connection_info("conn_" + std::to_string(i));
+        if (info) {
+            ++present;
+            authenticated += info->is_authenticated ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(stat(manager, "total_connections"), present);
+    EXPECT_EQ(stat(manager, "authenticated_connections"), authenticated);
+
+    manager.cleanup_inactive_connections(std::chrono::seconds(0));
+    EXPECT_EQ(stat(manager, "total_connections"), 0.0);
+    EXPECT_EQ(stat(manager, "authenticated_connections"), 0.0);
+
+    report.report();
+}
+
+// 소크: 장시간 접속/인증/해제 순환에서 메모리, fd, 지연 드리프트 확인
+TEST_F(ConnectionManagerStressTest, Soak) {
+    const auto duration = soak_duration();
+    if (duration.count() <= 0) {
+        GTEST_SKIP() << "set MMORPG_SOAK_SECONDS to run the soak test";
+    }
+
+    ConnectionManagerAgent manager(5000);
+    const uint32_t threads = thread_count();
+    const auto window_length = std::max<std::chrono::seconds>(std::chrono::seconds(1), duration / 10);
+
+    std::vector<SoakWindow> windows;
+    common::LatencyHistogram cycle_latency;
+    std::atomic<bool> running{true};
+
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            uint64_t sequence = 0;
+            while (running.load(std::memory_order_relaxed)) {
+                // 매번 새 ID - 해시 테이블 재해시/문자열 할당이 누적되지 않는지 확인
+                const std::string id = "soak_" + std::to_string(t) + "_" + std::to_string(sequence++);
+                ScopedLatency timer(cycle_latency);
+                if (manager.handle_new_connection(id, "10.0.0.4")) {
+                    manager.authenticate_connection(id, "user_" + id);
+                    manager.update_activity(id);
+                    manager.handle_disconnection(id);
+                }
+            }
+        });
+    }
+
+    const auto end = std::chrono::steady_clock::now() + duration;
+    auto previous = cycle_latency.snapshot();
+    while (std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(window_length);
+        manager.cleanup_inactive_connections(std::chrono::seconds(60));
+
+        auto current = cycle_latency.snapshot();
+        windows.push_back({current_rss_bytes(), open_fd_count(), current - previous});
+        previous = current;
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(stat(manager, "total_connections"), 0.0);
+    expect_no_soak_regression(windows);
+}
+
+} // namespace mmorpg::tests::stress
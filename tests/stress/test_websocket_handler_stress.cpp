@@ -0,0 +1,315 @@
+#include <gtest/gtest.h>
+#include "network/websocket_handler.hpp"
+#include "common/logger.hpp"
+#include "stress_utils.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests::stress {
+
+using mmorpg::network::WebSocketHandler;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+
+/**
+ * @brief 동기식 테스트 클라이언트 (스레드 하나가 하나씩 소유)
+ */
+class TestClient {
+public:
+    void connect(uint16_t port) {
+        beast::get_lowest_layer(ws_).connect(tcp::endpoint(net::ip::address_v4::loopback(), port));
+        ws_.handshake("127.0.0.1", "/");
+    }
+
+    /**
+     * @brief 메시지를 보내고 같은 내용의 에코가 올 때까지 읽음 (브로드캐스트 프레임은 건너뜀)
+     */
+    bool echo(const std::string& message) {
+        ws_.write(net::buffer(message));
+        for (;;) {
+            buffer_.consume(buffer_.size());
+            ws_.read(buffer_);
+            if (beast::buffers_to_string(buffer_.data()) == message) {
+                return true;
+            }
+        }
+    }
+
+    void send(const std::string& message) {
+        ws_.write(net::buffer(message));
+    }
+
+    void close() {
+        beast::error_code ec;
+        ws_.close(websocket::close_code::normal, ec);
+    }
+
+    /**
+     * @brief close 프레임 없이 TCP만 끊음 (클라이언트 크래시/네트워크 단절 모사)
+     */
+    void drop() {
+        beast::error_code ec;
+        beast::get_lowest_layer(ws_).close(ec);
+    }
+
+private:
+    net::io_context io_context_;
+    websocket::stream<tcp::socket> ws_{io_context_};
+    beast::flat_buffer buffer_;
+};
+
+class WebSocketHandlerStressTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        spdlog::set_level(spdlog::level::warn);
+
+        handler_ = std::make_unique<WebSocketHandler>(0);
+        handler_->set_message_handler([this](const std::string& connection_id, std::string_view message,
+                                             bool is_binary) {
+            handler_->send_to_connection(connection_id, std::string(message), is_binary);
+        });
+        handler_->set_connection_handler([this](const std::string&) {
+            connections_opened_.fetch_add(1, std::memory_order_relaxed);
+        });
+        handler_->set_disconnection_handler([this](const std::string&) {
+            connections_closed_.fetch_add(1, std::memory_order_relaxed);
+        });
+        handler_->start();
+        port_ = handler_->get_port();
+        ASSERT_NE(port_, 0);
+    }
+
+    void TearDown() override {
+        handler_->stop();
+        handler_.reset();
+        spdlog::set_level(spdlog::level::info);
+    }
+
+    /**
+     * @brief 서버 측 정리가 끝날 때까지 대기 (연결 해제는 비동기)
+     */
+    bool wait_for_drain(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (handler_->get_connection_count() == 0 &&
+                connections_opened_.load() == connections_closed_.load()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return false;
+    }
+
+    /**
+     * @brief 배경 부하: 주기적 브로드캐스트와 모니터링 조회
+     */
+    std::thread start_background_load(std::atomic<bool>& running) {
+        return std::thread([this, &running]() {
+            while (running.load(std::memory_order_relaxed)) {
+                handler_->broadcast("bcast");
+                handler_->collect_connection_traffic();
+                handler_->get_outbound_queue_depth();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    }
+
+    static uint32_t client_threads() {
+        return std::max(4u, std::min(16u, std::thread::hardware_concurrency()));
+    }
+
+    std::unique_ptr<WebSocketHandler> handler_;
+    uint16_t port_ = 0;
+    std::atomic<uint32_t> connections_opened_{0};
+    std::atomic<uint32_t> connections_closed_{0};
+};
+
+// 접속 -> 에코 -> 종료를 여러 스레드에서 반복하면서 브로드캐스트/모니터링과 경쟁
+TEST_F(WebSocketHandlerStressTest, ConnectEchoCloseChurn) {
+    ThroughputReport report("WebSocketHandler connect/echo/close churn");
+    auto& connect_latency = report.histogram("connect+handshake");
+    auto& echo_latency = report.histogram("echo_round_trip");
+    auto& close_latency = report.histogram("close");
+
+    const size_t fds_before = open_fd_count();
+    const uint32_t threads = client_threads();
+    const uint32_t cycles = scaled_iterations(40);
+    constexpr uint32_t kMessagesPerCycle = 20;
+
+    std::atomic<bool> running{true};
+    std::thread background = start_background_load(running);
+
+    std::vector<std::thread> clients;
+    std::atomic<uint32_t> failures{0};
+    for (uint32_t t = 0; t < threads; ++t) {
+        clients.emplace_back([&, t]() {
+            for (uint32_t cycle = 0; cycle < cycles; ++cycle) {
+                try {
+                    TestClient client;
+                    {
+                        ScopedLatency timer(connect_latency);
+                        client.connect(port_);
+                    }
+                    for (uint32_t i = 0; i < kMessagesPerCycle; ++i) {
+                        ScopedLatency timer(echo_latency);
+                        client.echo("msg_" + std::to_string(t) + "_" + std::to_string(cycle) + "_" + std::to_string(i));
+                    }
+                    ScopedLatency timer(close_latency);
+                    client.close();
+                } catch (const std::exception& e) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                    ADD_FAILURE() << "client " << t << " cycle " << cycle << ": " << e.what();
+                }
+            }
+        });
+    }
+
+    for (auto& client : clients) {
+        client.join();
+    }
+    running.store(false, std::memory_order_relaxed);
+    background.join();
+
+    EXPECT_EQ(failures.load(), 0u);
+    ASSERT_TRUE(wait_for_drain()) << "connections left: " << handler_->get_connection_count();
+    EXPECT_EQ(connections_opened_.load(), threads * cycles);
+    EXPECT_EQ(connections_closed_.load(), threads * cycles);
+    EXPECT_EQ(handler_->get_outbound_queue_depth(), 0u);
+    EXPECT_LE(open_fd_count(), fds_before + 4);
+
+    report.report();
+}
+
+// close 프레임 없이 끊긴 연결도 정리되고 해제 핸들러가 정확히 한 번 호출되어야 함
+TEST_F(WebSocketHandlerStressTest, AbruptDisconnectsAreReclaimed) {
+    const size_t fds_before = open_fd_count();
+    const uint32_t threads = client_threads();
+    const uint32_t cycles = scaled_iterations(50);
+
+    std::atomic<bool> running{true};
+    std::thread background = start_background_load(running);
+
+    std::vector<std::thread> clients;
+    for (uint32_t t = 0; t < threads; ++t) {
+        clients.emplace_back([&, t]() {
+            for (uint32_t cycle = 0; cycle < cycles; ++cycle) {
+                try {
+                    TestClient client;
+                    client.connect(port_);
+                    client.send("payload_" + std::to_string(t));
+                    client.drop();
+                } catch (const std::exception& e) {
+                    ADD_FAILURE() << "client " << t << ": " << e.what();
+                }
+            }
+        });
+    }
+
+    for (auto& client : clients) {
+        client.join();
+    }
+    running.store(false, std::memory_order_relaxed);
+    background.join();
+
+    ASSERT_TRUE(wait_for_drain()) << "connections left: " << handler_->get_connection_count();
+    EXPECT_EQ(connections_opened_.load(), threads * cycles);
+    EXPECT_EQ(connections_closed_.load(), threads * cycles);
+    EXPECT_LE(open_fd_count(), fds_before + 4);
+}
+
+// 연결이 살아 있는 상태에서 stop()이 교착 없이 끝나고 모든 연결을 해제해야 함
+TEST_F(WebSocketHandlerStressTest, StopWithLiveConnections) {
+    const uint32_t client_count = scaled_iterations(64);
+    std::vector<std::unique_ptr<TestClient>> clients;
+    for (uint32_t i = 0; i < client_count; ++i) {
+        clients.push_back(std::make_unique<TestClient>());
+        clients.back()->connect(port_);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (handler_->get_connection_count() < client_count && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQ(handler_->get_connection_count(), client_count);
+
+    std::atomic<bool> running{true};
+    std::thread background = start_background_load(running);
+
+    auto stopped = std::async(std::launch::async, [this]() { handler_->stop(); });
+    ASSERT_EQ(stopped.wait_for(std::chrono::seconds(10)), std::future_status::ready) << "stop() deadlocked";
+
+    running.store(false, std::memory_order_relaxed);
+    background.join();
+
+    EXPECT_EQ(handler_->get_connection_count(), 0u);
+    EXPECT_EQ(connections_closed_.load(), client_count);
+}
+
+// 소크: 장시간 연결 순환에서 메모리, fd, 에코 지연 드리프트 확인
+TEST_F(WebSocketHandlerStressTest, Soak) {
+    const auto duration = soak_duration();
+    if (duration.count() <= 0) {
+        GTEST_SKIP() << "set MMORPG_SOAK_SECONDS to run the soak test";
+    }
+
+    const uint32_t threads = client_threads();
+    const auto window_length = std::max<std::chrono::seconds>(std::chrono::seconds(1), duration / 10);
+
+    common::LatencyHistogram echo_latency;
+    std::vector<SoakWindow> windows;
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> failures{0};
+    std::thread background = start_background_load(running);
+
+    std::vector<std::thread> clients;
+    for (uint32_t t = 0; t < threads; ++t) {
+        clients.emplace_back([&, t]() {
+            uint64_t sequence = 0;
+            while (running.load(std::memory_order_relaxed)) {
+                try {
+                    TestClient client;
+                    client.connect(port_);
+                    for (int i = 0; i < 50; ++i) {
+                        ScopedLatency timer(echo_latency);
+                        client.echo("soak_" + std::to_string(t) + "_" + std::to_string(sequence++));
+                    }
+                    // 절반은 정상 종료, 절반은 강제 단절
+                    if (sequence % 100 < 50) {
+                        client.close();
+                    } else {
+                        client.drop();
+                    }
+                } catch (const std::exception&) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    const auto end = std::chrono::steady_clock::now() + duration;
+    auto previous = echo_latency.snapshot();
+    while (std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(window_length);
+        auto current = echo_latency.snapshot();
+        windows.push_back({current_rss_bytes(), open_fd_count(), current - previous});
+        previous = current;
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (auto& client : clients) {
+        client.join();
+    }
+    background.join();
+
+    EXPECT_EQ(failures.load(), 0u);
+    ASSERT_TRUE(wait_for_drain());
+    // fd 수는 클라이언트 소켓 개수만큼 흔들리므로 여유를 둠
+    expect_no_soak_regression(windows, 64ull * 1024 * 1024, threads * 2 + 16);
+}
+
+} // namespace mmorpg::tests::stress
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "common/agent_supervisor.hpp"
+#include "common/base_agent.hpp"
+#include "common/logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::common::AgentSupervisor;
+using mmorpg::common::StartupRecord;
+using mmorpg::common::StartupState;
+
+namespace {
+
+/**
+ * @brief start()에 걸리는 시간과 준비 알림 시점을 조절할 수 있는 에이전트
+ */
+class FakeAgent : public mmorpg::common::BaseAgent {
+public:
+    FakeAgent(const std::string& id, std::chrono::milliseconds start_delay,
+              std::chrono::milliseconds ready_delay = std::chrono::milliseconds(0), bool becomes_ready = true)
+        : BaseAgent(id)
+        , start_delay_(start_delay)
+        , ready_delay_(ready_delay)
+        , becomes_ready_(becomes_ready) {
+    }
+
+    ~FakeAgent() override {
+        if (ready_thread_.joinable()) {
+            ready_thread_.join();
+        }
+    }
+
+    void start() override {
+        std::this_thread::sleep_for(start_delay_);
+        running_.store(true, std::memory_order_release);
+        if (!becomes_ready_) {
+            return;
+        }
+        // 준비는 start()가 반환된 뒤 비동기로 (예: 리스너 바인드, 첫 동기화 완료)
+        ready_thread_ = std::thread([this]() {
+            std::this_thread::sleep_for(ready_delay_);
+            mark_ready();
+        });
+    }
+
+    void stop() override {
+        running_.store(false, std::memory_order_release);
+        clear_ready();
+    }
+
+private:
+    std::chrono::milliseconds start_delay_;
+    std::chrono::milliseconds ready_delay_;
+    bool becomes_ready_;
+    std::thread ready_thread_;
+};
+
+const StartupRecord& find_record(const std::vector<StartupRecord>& report, const std::string& name) {
+    for (const auto& record : report) {
+        if (record.name == name) {
+            return record;
+        }
+    }
+    static const StartupRecord missing;
+    ADD_FAILURE() << "no record for " << name;
+    return missing;
+}
+
+} // namespace
+
+class AgentSupervisorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mmorpg::common::Logger::initialize("test.log");
+    }
+};
+
+TEST_F(AgentSupervisorTest, StartsIndependentAgentsInParallelAndListenerLast) {
+    FakeAgent world("World", std::chrono::milliseconds(150));
+    FakeAgent chat("Chat", std::chrono::milliseconds(150));
+    FakeAgent database("Database", std::chrono::milliseconds(150));
+    FakeAgent listener("Listener", std::chrono::milliseconds(10));
+
+    AgentSupervisor supervisor;
+    ASSERT_TRUE(supervisor.add(database));
+    ASSERT_TRUE(supervisor.add(world, {"Database"}));
+    ASSERT_TRUE(supervisor.add(chat));
+    ASSERT_TRUE(supervisor.add(listener, {"World", "Chat"}));
+
+    ASSERT_TRUE(supervisor.start());
+    EXPECT_TRUE(listener.is_ready());
+
+    const auto report = supervisor.get_startup_report();
+    ASSERT_EQ(report.size(), 4u);
+    const auto& world_record = find_record(report, "World");
+    const auto& chat_record = find_record(report, "Chat");
+    const auto& database_record = find_record(report, "Database");
+    const auto& listener_record = find_record(report, "Listener");
+
+    EXPECT_EQ(database_record.stage, 0u);
+    EXPECT_EQ(chat_record.stage, 0u);
+    EXPECT_EQ(world_record.stage, 1u);
+    EXPECT_EQ(listener_record.stage, 2u);
+
+    // 의존 대상이 준비된 뒤에만 시작
+    EXPECT_GE(world_record.started_at, database_record.ready_at);
+    EXPECT_GE(listener_record.started_at, world_record.ready_at);
+    EXPECT_GE(listener_record.started_at, chat_record.ready_at);
+
+    // Chat은 Database와 동시에 시작하므로 전체 시간은 가장 긴 경로(약 310ms), 직렬 합(460ms)보다 짧음
+    EXPECT_LT(chat_record.started_at, 0.05);
+    EXPECT_LT(supervisor.get_total_startup_time(), 0.42);
+
+    EXPECT_GE(world.get_metric("ready_time"), 0.15);
+
+    supervisor.stop();
+    EXPECT_FALSE(listener.is_running());
+    EXPECT_FALSE(database.is_running());
+}
+
+TEST_F(AgentSupervisorTest, WaitsForExplicitReadinessSignal) {
+    FakeAgent cache("Cache", std::chrono::milliseconds(0), std::chrono::milliseconds(100));
+    FakeAgent listener("Listener", std::chrono::milliseconds(0));
+
+    AgentSupervisor supervisor;
+    ASSERT_TRUE(supervisor.add(cache));
+    ASSERT_TRUE(supervisor.add(listener, {"Cache"}));
+    ASSERT_TRUE(supervisor.start());
+
+    // start()는 즉시 반환했지만 준비 알림까지 기다림
+    const auto report = supervisor.get_startup_report();
+    EXPECT_GE(find_record(report, "Cache").startup_time, 0.1);
+    EXPECT_GE(find_record(report, "Listener").started_at, 0.1);
+
+    supervisor.stop();
+}
+
+TEST_F(AgentSupervisorTest, FailureSkipsDependentsAndStopsStartedInReverse) {
+    FakeAgent metrics("Metrics", std::chrono::milliseconds(0));
+    FakeAgent stuck("Stuck", std::chrono::milliseconds(0), std::chrono::milliseconds(0), false);
+    FakeAgent listener("Listener", std::chrono::milliseconds(0));
+
+    std::mutex order_mutex;
+    std::vector<std::string> stopped;
+    const auto record_stop = [&](const std::string& name) {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        stopped.push_back(name);
+    };
+    bool stuck_running_at_transport_stop = true;
+
+    AgentSupervisor supervisor(std::chrono::milliseconds(100));
+    ASSERT_TRUE(supervisor.add(metrics));
+    ASSERT_TRUE(supervisor.add("Transport", []() { return true; }, [&]() {
+        stuck_running_at_transport_stop = stuck.is_running();
+        record_stop("Transport");
+    }));
+    ASSERT_TRUE(supervisor.add("Store", []() { return false; }, [&]() { record_stop("Store"); }));
+    ASSERT_TRUE(supervisor.add("Session", []() { return true; }, [&]() { record_stop("Session"); }, {"Store"}));
+    ASSERT_TRUE(supervisor.add(stuck, {"Transport"}));
+    ASSERT_TRUE(supervisor.add(listener, {"Session", "Stuck"}));
+
+    EXPECT_FALSE(supervisor.start());
+
+    const auto report = supervisor.get_startup_report();
+    EXPECT_EQ(find_record(report, "Metrics").state, StartupState::READY);
+    EXPECT_EQ(find_record(report, "Store").state, StartupState::FAILED);
+    EXPECT_EQ(find_record(report, "Stuck").state, StartupState::FAILED);   // 준비 시간 초과
+    EXPECT_EQ(find_record(report, "Session").state, StartupState::SKIPPED);
+    EXPECT_EQ(find_record(report, "Listener").state, StartupState::SKIPPED);
+
+    // 시작한 구성 요소만 중지되고, Transport는 그에 의존한 Stuck보다 나중에 중지
+    EXPECT_FALSE(metrics.is_running());
+    EXPECT_FALSE(stuck.is_running());
+    EXPECT_FALSE(listener.is_running());
+    std::sort(stopped.begin(), stopped.end());
+    EXPECT_EQ(stopped, (std::vector<std::string>{"Store", "Transport"}));
+    EXPECT_FALSE(stuck_running_at_transport_stop);
+}
+
+TEST_F(AgentSupervisorTest, RejectsDuplicateAndUnknownDependencies) {
+    FakeAgent agent("Agent", std::chrono::milliseconds(0));
+
+    AgentSupervisor supervisor;
+    ASSERT_TRUE(supervisor.add(agent));
+    EXPECT_FALSE(supervisor.add(agent));
+    EXPECT_FALSE(supervisor.add("Later", []() { return true; }, nullptr, {"Missing"}));
+
+    ASSERT_TRUE(supervisor.start());
+    EXPECT_FALSE(supervisor.add("Late", []() { return true; }, nullptr));
+    supervisor.stop();
+}
+
+} // namespace mmorpg::tests
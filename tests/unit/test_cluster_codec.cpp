@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "cluster/cluster_codec.hpp"
+#include <string>
+
+namespace mmorpg::tests {
+
+using mmorpg::cluster::ClusterBatch;
+using mmorpg::cluster::ClusterBatchWriter;
+using mmorpg::cluster::MessageArena;
+using mmorpg::common::BufferPool;
+
+namespace {
+
+void add_whisper(ClusterBatchWriter& writer, uint64_t sender, const std::string& text) {
+    auto* whisper = writer.add_message()->mutable_whisper();
+    whisper->set_sender_id(sender);
+    whisper->set_target_id(sender + 1);
+    whisper->set_sender_name("sender_" + std::to_string(sender));
+    whisper->set_text(text);
+}
+
+} // namespace
+
+TEST(ClusterCodecTest, BatchRoundTrip) {
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+
+    add_whisper(writer, 10, "meet at the bridge");
+    auto* guild = writer.add_message()->mutable_guild_chat();
+    guild->set_guild_id(7);
+    guild->set_text("raid in 5");
+    EXPECT_EQ(writer.size(), 2);
+
+    auto frame = writer.flush(42, pool);
+    EXPECT_TRUE(writer.empty());
+
+    MessageArena arena;
+    const ClusterBatch* batch = mmorpg::cluster::decode_batch(*frame, arena);
+    ASSERT_NE(batch, nullptr);
+    EXPECT_EQ(batch->GetArena(), arena.get());
+    EXPECT_EQ(batch->source_node(), "node-a");
+    EXPECT_EQ(batch->tick(), 42u);
+    ASSERT_EQ(batch->messages_size(), 2);
+    EXPECT_EQ(batch->messages(0).sequence(), 1u);
+    EXPECT_EQ(batch->messages(0).whisper().text(), "meet at the bridge");
+    EXPECT_EQ(batch->messages(1).sequence(), 2u);
+    EXPECT_EQ(batch->messages(1).guild_chat().guild_id(), 7u);
+}
+
+TEST(ClusterCodecTest, SequenceContinuesAcrossBatches) {
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+
+    add_whisper(writer, 1, "a");
+    writer.flush(1, pool);
+    add_whisper(writer, 2, "b");
+    auto frame = writer.flush(2, pool);
+
+    MessageArena arena;
+    const ClusterBatch* batch = mmorpg::cluster::decode_batch(*frame, arena);
+    ASSERT_NE(batch, nullptr);
+    EXPECT_EQ(batch->messages(0).sequence(), 2u);
+}
+
+TEST(ClusterCodecTest, RejectsCorruptFrame) {
+    MessageArena arena;
+    const std::string garbage("\x1a\xff\xff\xff\x0f", 5);
+    EXPECT_EQ(mmorpg::cluster::decode_batch(garbage, arena), nullptr);
+}
+
+TEST(ClusterCodecTest, ArenaReusesInitialBlockAcrossBatches) {
+    MessageArena arena(16 * 1024);
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a", 16 * 1024);
+
+    for (int i = 0; i < 8; ++i) {
+        add_whisper(writer, static_cast<uint64_t>(i), "short message");
+    }
+    auto frame = writer.flush(1, pool);
+
+    // 첫 블록 안에서 끝나는 배치는 리셋 후 같은 블록을 다시 씀
+    for (int round = 0; round < 100; ++round) {
+        ASSERT_NE(mmorpg::cluster::decode_batch(*frame, arena), nullptr);
+        EXPECT_LE(arena.get()->SpaceAllocated(), arena.get_initial_block_size());
+        arena.reset();
+    }
+    EXPECT_EQ(arena.get_overflow_count(), 0u);
+    EXPECT_GT(arena.get_high_water_mark(), 0u);
+}
+
+TEST(ClusterCodecTest, ArenaGrowsInitialBlockAfterOverflow) {
+    MessageArena arena(1024, 1024 * 1024);
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+
+    for (int i = 0; i < 200; ++i) {
+        add_whisper(writer, static_cast<uint64_t>(i), std::string(100, 'x'));
+    }
+    auto frame = writer.flush(1, pool);
+
+    ASSERT_NE(mmorpg::cluster::decode_batch(*frame, arena), nullptr);
+    arena.reset();
+    EXPECT_EQ(arena.get_overflow_count(), 1u);
+    EXPECT_GT(arena.get_initial_block_size(), 1024u);
+
+    // 키운 뒤에는 같은 크기의 배치가 넘치지 않음
+    ASSERT_NE(mmorpg::cluster::decode_batch(*frame, arena), nullptr);
+    arena.reset();
+    EXPECT_EQ(arena.get_overflow_count(), 1u);
+}
+
+TEST(ClusterCodecTest, HugePageInitialBlockHoldsBatch) {
+    // huge page 크기 이상의 첫 블록은 HugePageRegion에 둠
+    MessageArena arena(mmorpg::common::HugePageRegion::kHugePageSize);
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+
+    for (int i = 0; i < 1000; ++i) {
+        add_whisper(writer, static_cast<uint64_t>(i), std::string(100, 'x'));
+    }
+    auto frame = writer.flush(1, pool);
+
+    for (int batch = 0; batch < 3; ++batch) {
+        auto* decoded = mmorpg::cluster::decode_batch(*frame, arena);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(decoded->messages_size(), 1000);
+        arena.reset();
+    }
+    EXPECT_EQ(arena.get_overflow_count(), 0u);
+}
+
+TEST(ClusterCodecTest, BufferPoolReusesCapacity) {
+    BufferPool pool(4);
+
+    const char* first_data = nullptr;
+    {
+        auto buffer = pool.acquire(4096);
+        EXPECT_GE(buffer->capacity(), 4096u);
+        buffer->assign(100, 'a');
+        first_data = buffer->data();
+    }
+    EXPECT_EQ(pool.get_pooled_count(), 1u);
+
+    auto again = pool.acquire(1024);
+    EXPECT_TRUE(again->empty());
+    EXPECT_EQ(again->data(), first_data);
+    EXPECT_EQ(pool.get_created_count(), 1u);
+}
+
+} // namespace mmorpg::tests
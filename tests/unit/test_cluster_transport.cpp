@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include "cluster/cluster_router.hpp"
+#include "cluster/cluster_transport.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::cluster::ClusterBatch;
+using mmorpg::cluster::ClusterRouter;
+using mmorpg::cluster::ClusterTransport;
+using mmorpg::cluster::PeerStats;
+using mmorpg::cluster::RouteResult;
+using mmorpg::cluster::TransportOptions;
+
+namespace {
+
+/**
+ * @brief 수신 배치를 복사해 모아 두는 핸들러
+ */
+class Inbox {
+public:
+    ClusterTransport::BatchHandler handler() {
+        return [this](const ClusterBatch& batch) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batches_.push_back(batch);
+            messages_ += static_cast<size_t>(batch.messages_size());
+        };
+    }
+
+    size_t message_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return messages_;
+    }
+
+    std::vector<ClusterBatch> batches() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batches_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<ClusterBatch> batches_;
+    size_t messages_ = 0;
+};
+
+TransportOptions make_options(const std::string& node_id) {
+    TransportOptions options;
+    options.node_id = node_id;
+    options.listen_address = "127.0.0.1:0";
+    options.reconnect_backoff = std::chrono::milliseconds(50);
+    return options;
+}
+
+std::string address_of(const ClusterTransport& transport) {
+    return "127.0.0.1:" + std::to_string(transport.get_port());
+}
+
+PeerStats peer_stats(const ClusterTransport& transport, const std::string& node_id) {
+    for (const auto& stats : transport.get_peer_stats()) {
+        if (stats.node_id == node_id) {
+            return stats;
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief 조건이 참이 될 때까지 틱을 돌리며 대기
+ */
+template<typename Predicate>
+bool run_ticks_until(ClusterTransport& transport, uint64_t& tick, Predicate predicate,
+                     std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        transport.flush(++tick);
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return predicate();
+}
+
+void add_whisper(ClusterTransport& transport, const std::string& node_id, uint64_t sender) {
+    auto* message = transport.add_message(node_id);
+    ASSERT_NE(message, nullptr);
+    auto* whisper = message->mutable_whisper();
+    whisper->set_sender_id(sender);
+    whisper->set_target_id(sender + 1);
+    whisper->set_text("hello from " + std::to_string(sender));
+}
+
+} // namespace
+
+TEST(ClusterTransportTest, DeliversBatchesAndCollectsAcks) {
+    Inbox inbox;
+    ClusterTransport a(make_options("a"));
+    ClusterTransport b(make_options("b"));
+    b.set_batch_handler(inbox.handler());
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    a.add_peer("b", address_of(b));
+
+    uint64_t tick = 0;
+    for (uint64_t i = 0; i < 3; ++i) {
+        add_whisper(a, "b", i);
+    }
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() {
+        return peer_stats(a, "b").batches_acked == 1;
+    }));
+
+    const auto batches = inbox.batches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0].source_node(), "a");
+    ASSERT_EQ(batches[0].messages_size(), 3);
+    EXPECT_EQ(batches[0].messages(2).whisper().text(), "hello from 2");
+
+    const PeerStats stats = peer_stats(a, "b");
+    EXPECT_TRUE(stats.connected);
+    EXPECT_EQ(stats.batches_sent, 1u);
+    EXPECT_EQ(stats.messages_sent, 3u);
+    EXPECT_GT(stats.bytes_sent, 0u);
+    EXPECT_EQ(stats.in_flight_batches, 0u);
+    EXPECT_EQ(stats.ack_latency.count, 1u);
+
+    const auto inbound = b.get_inbound_stats();
+    ASSERT_EQ(inbound.size(), 1u);
+    EXPECT_EQ(inbound[0].node_id, "a");
+    EXPECT_EQ(inbound[0].messages_received, 3u);
+    EXPECT_EQ(inbound[0].bytes_received, stats.bytes_sent);
+}
+
+TEST(ClusterTransportTest, EmptyTicksSendNothing) {
+    ClusterTransport a(make_options("a"));
+    ClusterTransport b(make_options("b"));
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    a.add_peer("b", address_of(b));
+
+    uint64_t tick = 0;
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return peer_stats(a, "b").connected; }));
+    for (int i = 0; i < 10; ++i) {
+        a.flush(++tick);
+    }
+    EXPECT_EQ(peer_stats(a, "b").batches_sent, 0u);
+}
+
+TEST(ClusterTransportTest, FlowControlWindowHoldsBackBatches) {
+    Inbox inbox;
+    TransportOptions options = make_options("a");
+    options.max_in_flight_batches = 1;
+    options.max_pending_messages = 4;
+    ClusterTransport a(options);
+    ClusterTransport b(make_options("b"));
+
+    // 수신 측 핸들러를 막아 ack가 돌아오지 않게 함
+    std::atomic<bool> release{false};
+    b.set_batch_handler([&](const ClusterBatch& batch) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        inbox.handler()(batch);
+    });
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    a.add_peer("b", address_of(b));
+
+    uint64_t tick = 0;
+    add_whisper(a, "b", 1);
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return peer_stats(a, "b").batches_sent == 1; }));
+
+    // 창이 찼으므로 이후 메시지는 배치로 나가지 않고 쌓임
+    for (uint64_t i = 2; i <= 5; ++i) {
+        add_whisper(a, "b", i);
+    }
+    for (int i = 0; i < 5; ++i) {
+        a.flush(++tick);
+    }
+    PeerStats stats = peer_stats(a, "b");
+    EXPECT_EQ(stats.batches_sent, 1u);
+    EXPECT_EQ(stats.in_flight_batches, 1u);
+    EXPECT_EQ(stats.pending_messages, 4u);
+
+    // 대기 한도를 넘은 메시지는 버림
+    EXPECT_EQ(a.add_message("b"), nullptr);
+    EXPECT_EQ(peer_stats(a, "b").dropped_messages, 1u);
+
+    release = true;
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return inbox.message_count() == 5; }));
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return peer_stats(a, "b").in_flight_batches == 0; }));
+    stats = peer_stats(a, "b");
+    EXPECT_EQ(stats.batches_sent, 2u);
+    EXPECT_EQ(stats.batches_acked, 2u);
+    EXPECT_EQ(stats.pending_messages, 0u);
+}
+
+TEST(ClusterTransportTest, ReconnectsAfterPeerRestart) {
+    Inbox inbox;
+    ClusterTransport a(make_options("a"));
+    auto b = std::make_unique<ClusterTransport>(make_options("b"));
+    b->set_batch_handler(inbox.handler());
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b->start());
+    const std::string address = address_of(*b);
+    a.add_peer("b", address);
+
+    uint64_t tick = 0;
+    add_whisper(a, "b", 1);
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return inbox.message_count() == 1; }));
+
+    b.reset();
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return !peer_stats(a, "b").connected; }));
+
+    TransportOptions options = make_options("b");
+    options.listen_address = address;
+    b = std::make_unique<ClusterTransport>(options);
+    b->set_batch_handler(inbox.handler());
+    ASSERT_TRUE(b->start());
+
+    add_whisper(a, "b", 2);
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return inbox.message_count() == 2; }));
+    EXPECT_GE(peer_stats(a, "b").reconnects, 1u);
+}
+
+TEST(ClusterTransportTest, RemovePeerClosesStream) {
+    ClusterTransport a(make_options("a"));
+    ClusterTransport b(make_options("b"));
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    a.add_peer("b", address_of(b));
+    a.add_peer("a", address_of(a));  // 자기 자신은 무시
+
+    uint64_t tick = 0;
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() { return peer_stats(a, "b").connected; }));
+    EXPECT_EQ(a.get_peer_ids(), std::vector<std::string>{"b"});
+
+    a.remove_peer("b");
+    EXPECT_FALSE(a.has_peer("b"));
+    EXPECT_EQ(a.add_message("b"), nullptr);
+    EXPECT_EQ(a.flush(++tick), 0u);
+}
+
+TEST(ClusterRouterTest, RoutesByPlayerLocationZoneOwnerAndGuild) {
+    Inbox inbox_b;
+    Inbox inbox_c;
+    ClusterTransport a(make_options("a"));
+    ClusterTransport b(make_options("b"));
+    ClusterTransport c(make_options("c"));
+    b.set_batch_handler(inbox_b.handler());
+    c.set_batch_handler(inbox_c.handler());
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    ASSERT_TRUE(c.start());
+    a.add_peer("b", address_of(b));
+    a.add_peer("c", address_of(c));
+
+    ClusterRouter router(a);
+    router.set_player_locator([](uint64_t player_id) -> std::optional<std::string> {
+        if (player_id == 100) return "b";
+        if (player_id == 200) return "a";
+        return std::nullopt;
+    });
+    router.assign_zone(7, "c");
+
+    EXPECT_EQ(router.route_whisper(1, 100, "alice", "psst"), RouteResult::FORWARDED);
+    EXPECT_EQ(router.route_whisper(1, 200, "alice", "local"), RouteResult::LOCAL);
+    EXPECT_EQ(router.route_whisper(1, 300, "alice", "nobody"), RouteResult::UNROUTABLE);
+    EXPECT_EQ(router.route_zone_action(7, 1, 2, 3, "trade"), RouteResult::FORWARDED);
+    EXPECT_EQ(router.route_zone_action(8, 1, 2, 3), RouteResult::UNROUTABLE);
+    EXPECT_EQ(router.route_guild_chat(42, 1, "alice", "hi guild"), 2u);
+
+    uint64_t tick = 0;
+    ASSERT_TRUE(run_ticks_until(a, tick, [&]() {
+        return inbox_b.message_count() == 2 && inbox_c.message_count() == 2;
+    }));
+
+    const auto batch_b = inbox_b.batches().at(0);
+    EXPECT_EQ(batch_b.messages(0).whisper().target_id(), 100u);
+    EXPECT_EQ(batch_b.messages(0).whisper().text(), "psst");
+    EXPECT_GT(batch_b.messages(0).sent_at_us(), 0u);
+    EXPECT_EQ(batch_b.messages(1).guild_chat().guild_id(), 42u);
+
+    const auto batch_c = inbox_c.batches().at(0);
+    EXPECT_EQ(batch_c.messages(0).zone_action().zone_id(), 7u);
+    EXPECT_EQ(batch_c.messages(0).zone_action().payload(), "trade");
+    EXPECT_EQ(batch_c.messages(1).guild_chat().text(), "hi guild");
+}
+
+} // namespace mmorpg::tests
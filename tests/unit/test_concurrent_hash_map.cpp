@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include "common/concurrent_hash_map.hpp"
+#include "common/epoch_reclamation.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::common::ConcurrentHashMap;
+using mmorpg::common::EpochGuard;
+using mmorpg::common::EpochRetireList;
+
+namespace {
+
+/**
+ * @brief 소멸 횟수를 세는 값
+ */
+struct Tracked {
+    explicit Tracked(std::atomic<int>* destroyed) : destroyed(destroyed) {
+    }
+
+    ~Tracked() {
+        destroyed->fetch_add(1);
+    }
+
+    std::atomic<int>* destroyed;
+};
+
+} // namespace
+
+TEST(ConcurrentHashMapTest, InsertFindEraseLikeAMap) {
+    ConcurrentHashMap<std::string, int> map;
+    EXPECT_TRUE(map.empty());
+
+    EXPECT_TRUE(map.insert("a", 1));
+    EXPECT_FALSE(map.insert("a", 2));            // 이미 있으면 그대로
+    EXPECT_EQ(map.find("a"), 1);
+    EXPECT_FALSE(map.insert_or_assign("a", 3));  // 교체는 false
+    EXPECT_TRUE(map.insert_or_assign("b", 4));
+    EXPECT_EQ(map.find("a"), 3);
+    EXPECT_EQ(map.size(), 2u);
+
+    int seen = 0;
+    EXPECT_TRUE(map.visit("b", [&seen](const int& value) { seen = value; }));
+    EXPECT_EQ(seen, 4);
+    EXPECT_FALSE(map.visit("c", [](const int&) { FAIL(); }));
+
+    EXPECT_TRUE(map.erase("a"));
+    EXPECT_FALSE(map.erase("a"));
+    EXPECT_FALSE(map.contains("a"));
+    EXPECT_TRUE(map.contains("b"));
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(ConcurrentHashMapTest, GrowsAndReusesTombstones) {
+    ConcurrentHashMap<uint64_t, uint64_t> map;
+    constexpr uint64_t kKeys = 10000;
+    for (uint64_t key = 0; key < kKeys; ++key) {
+        ASSERT_TRUE(map.insert(key, key * 10));
+    }
+    EXPECT_EQ(map.size(), kKeys);
+    EXPECT_GE(map.capacity(), kKeys * 2);
+
+    for (uint64_t key = 0; key < kKeys; key += 2) {
+        ASSERT_TRUE(map.erase(key));
+    }
+    for (uint64_t key = 0; key < kKeys; ++key) {
+        ASSERT_EQ(map.contains(key), key % 2 == 1) << key;
+    }
+
+    // 지우고 넣기를 반복해도 묘비 정리로 크기가 계속 커지지 않음
+    const size_t capacity = map.capacity();
+    for (int round = 0; round < 20; ++round) {
+        for (uint64_t key = kKeys; key < kKeys + 1000; ++key) {
+            map.insert(key, key);
+        }
+        for (uint64_t key = kKeys; key < kKeys + 1000; ++key) {
+            map.erase(key);
+        }
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), kKeys / 2);
+
+    size_t visited = 0;
+    map.for_each([&visited](const uint64_t& key, const uint64_t& value) {
+        EXPECT_EQ(value, key * 10);
+        ++visited;
+    });
+    EXPECT_EQ(visited, kKeys / 2);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(1));
+}
+
+TEST(ConcurrentHashMapTest, ReadersNeverSeeTornOrFreedValues) {
+    using Value = std::shared_ptr<const std::string>;
+    ConcurrentHashMap<int, Value> map;
+    constexpr int kKeys = 512;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> hits{0};
+    std::atomic<int> errors{0};
+
+    // 값은 항상 "키:세대" 형태 - 다른 키의 값이나 해제된 문자열을 읽으면 접두사가 어긋남
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&, w]() {
+            for (int generation = 0; !stop.load(); ++generation) {
+                for (int key = w; key < kKeys; key += 2) {
+                    if (generation % 3 == 2) {
+                        map.erase(key);
+                    } else {
+                        map.insert_or_assign(key, std::make_shared<const std::string>(
+                                                      std::to_string(key) + ":" + std::to_string(generation)));
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                for (int key = 0; key < kKeys; ++key) {
+                    map.visit(key, [&](const Value& value) {
+                        const std::string prefix = std::to_string(key) + ":";
+                        if (value->compare(0, prefix.size(), prefix) != 0) {
+                            errors.fetch_add(1);
+                        }
+                        hits.fetch_add(1, std::memory_order_relaxed);
+                    });
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    stop = true;
+    for (auto& thread : writers) {
+        thread.join();
+    }
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_GT(hits.load(), 0u);
+    map.for_each([&](const int& key, const Value& value) {
+        EXPECT_EQ(value->rfind(std::to_string(key) + ":", 0), 0u);
+    });
+}
+
+TEST(EpochRetireListTest, DefersReclamationUntilReadersLeave) {
+    std::atomic<int> destroyed{0};
+    EpochRetireList retired;
+
+    // 다른 스레드가 읽기 구간에 있는 동안 떼어 낸 노드는 해제하지 않음
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool reading = false;
+    bool release = false;
+    std::thread reader([&]() {
+        EpochGuard guard;
+        std::unique_lock<std::mutex> lock(mutex);
+        reading = true;
+        cv.notify_all();
+        cv.wait(lock, [&]() { return release; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return reading; });
+    }
+
+    retired.retire(new Tracked(&destroyed));
+    EXPECT_EQ(destroyed.load(), 0);
+    EXPECT_EQ(retired.get_pending_count(), 1u);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    reader.join();
+
+    retired.collect();
+    EXPECT_EQ(destroyed.load(), 1);
+    EXPECT_EQ(retired.get_pending_count(), 0u);
+
+    // 읽는 스레드가 없으면 바로 해제, 중첩 구간은 바깥 구간이 끝날 때까지 보호
+    retired.retire(new Tracked(&destroyed));
+    EXPECT_EQ(destroyed.load(), 2);
+    {
+        EpochGuard outer;
+        {
+            EpochGuard inner;
+        }
+        retired.retire(new Tracked(&destroyed));
+        EXPECT_EQ(destroyed.load(), 2);
+    }
+    retired.collect();
+    EXPECT_EQ(destroyed.load(), 3);
+}
+
+TEST(ConcurrentHashMapTest, DestroysValuesOnEraseAndDestruction) {
+    std::atomic<int> destroyed{0};
+    {
+        ConcurrentHashMap<int, std::shared_ptr<Tracked>> map;
+        for (int key = 0; key < 100; ++key) {
+            map.insert(key, std::make_shared<Tracked>(&destroyed));
+        }
+        for (int key = 0; key < 10; ++key) {
+            map.erase(key);
+        }
+        EXPECT_EQ(destroyed.load(), 10);   // 읽는 스레드가 없으므로 바로 회수
+        map.insert_or_assign(50, std::make_shared<Tracked>(&destroyed));
+        EXPECT_EQ(destroyed.load(), 11);
+    }
+    EXPECT_EQ(destroyed.load(), 101);
+}
+
+} // namespace mmorpg::tests
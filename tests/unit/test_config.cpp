@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include "config/config_manager.hpp"
+#include "common/logger.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::config::ConfigManager;
+using mmorpg::config::ServerConfig;
+
+class ConfigTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "mmorpg_test_server.conf";
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+        // 싱글턴이므로 다른 테스트에 영향이 없도록 기본값으로 되돌림
+        ConfigManager::instance().publish(ServerConfig{});
+    }
+
+    void write_config(const std::string& text) {
+        std::ofstream file(path_, std::ios::trunc);
+        file << text;
+    }
+
+    std::string path_;
+};
+
+TEST_F(ConfigTest, ParsesSectionsAndDefaults) {
+    std::string error;
+    auto config = mmorpg::config::parse_server_config(
+        "# comment\n"
+        "[server]\n"
+        "max_connections = 1200   # inline comment\n"
+        "tick_rate = 30\n"
+        "idle_timeout = 5m\n"
+        "\n"
+        "[aoi]\n"
+        "radius = 64.5\n"
+        "[database]\n"
+        "host = \"db.local\"\n",
+        &error);
+
+    ASSERT_TRUE(config.has_value()) << error;
+    EXPECT_EQ(config->max_connections, 1200u);
+    EXPECT_EQ(config->tick_rate, 30u);
+    EXPECT_EQ(config->idle_timeout, std::chrono::seconds(300));
+    EXPECT_FLOAT_EQ(config->aoi_radius, 64.5f);
+    EXPECT_EQ(config->database_host, "db.local");
+
+    // 지정하지 않은 값은 기본값
+    EXPECT_EQ(config->port, 8080);
+    EXPECT_EQ(config->tick_budget(), std::chrono::microseconds(33333));
+}
+
+TEST_F(ConfigTest, RejectsInvalidValues) {
+    std::string error;
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[server]\nmax_connections = 0\n", &error));
+    EXPECT_NE(error.find("server.max_connections"), std::string::npos);
+
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[server]\nport = 70000\n", &error));
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[server]\ntick_rate = fast\n", &error));
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[server\nport = 1\n", &error));
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[server]\nport\n", &error));
+    EXPECT_NE(error.find("line 2"), std::string::npos);
+}
+
+TEST_F(ConfigTest, ParsesClusterPeers) {
+    std::string error;
+    auto config = mmorpg::config::parse_server_config(
+        "[cluster]\n"
+        "node_id = a\n"
+        "listen = 0.0.0.0:7100\n"
+        "peers = b=10.0.0.2:7100, c=10.0.0.3:7100\n"
+        "seeds = 10.0.0.2:7200,10.0.0.3:7200\n"
+        "suspect_timeout = 2s\n",
+        &error);
+
+    ASSERT_TRUE(config.has_value()) << error;
+    EXPECT_EQ(config->cluster_node_id, "a");
+    ASSERT_EQ(config->cluster_peers.size(), 2u);
+    EXPECT_EQ(config->cluster_peers.at("c"), "10.0.0.3:7100");
+    EXPECT_EQ(config->cluster_seeds, (std::vector<std::string>{"10.0.0.2:7200", "10.0.0.3:7200"}));
+    EXPECT_EQ(config->cluster_suspect_timeout, std::chrono::seconds(2));
+
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[cluster]\npeers = b\n", &error));
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[cluster]\npeers = b=nohost\n", &error));
+}
+
+TEST_F(ConfigTest, ParsesMemoryPlacement) {
+    std::string error;
+    auto config = mmorpg::config::parse_server_config("[memory]\nnuma = off\nhuge_pages = explicit\n", &error);
+
+    ASSERT_TRUE(config.has_value()) << error;
+    EXPECT_FALSE(config->numa_aware);
+    EXPECT_EQ(config->huge_pages, mmorpg::common::HugePageMode::EXPLICIT);
+    EXPECT_EQ(config->restart_required_changes(mmorpg::config::ServerConfig{}),
+              (std::vector<std::string>{"memory.numa", "memory.huge_pages"}));
+
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[memory]\nhuge_pages = 1g\n", &error));
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[memory]\nnuma = maybe\n", &error));
+}
+
+TEST_F(ConfigTest, ParsesMemoryBudgetsAsLiveValues) {
+    std::string error;
+    auto config = mmorpg::config::parse_server_config(
+        "[memory]\nconnection_budget_mb = 512\nbuffer_budget_mb = 1024\ncache_budget_mb = 0\n", &error);
+
+    ASSERT_TRUE(config.has_value()) << error;
+    EXPECT_EQ(config->connection_budget_mb, 512u);
+    EXPECT_EQ(config->buffer_budget_mb, 1024u);
+    EXPECT_EQ(config->cache_budget_mb, 0u);
+    EXPECT_TRUE(config->restart_required_changes(mmorpg::config::ServerConfig{}).empty());
+
+    EXPECT_FALSE(mmorpg::config::parse_server_config("[memory]\ncache_budget_mb = -1\n", &error));
+}
+
+TEST_F(ConfigTest, ReloadPublishesNewSnapshotAndKeepsOldOneValid) {
+    auto& manager = ConfigManager::instance();
+
+    write_config("[server]\nmax_connections = 100\n[rate_limit]\nmessages_per_second = 10\n");
+    ASSERT_TRUE(manager.load(path_));
+
+    const ServerConfig& before = manager.current();
+    const uint64_t generation = manager.get_generation();
+    EXPECT_EQ(before.max_connections, 100u);
+
+    std::vector<std::pair<uint32_t, uint32_t>> changes;
+    const uint64_t listener_id = manager.add_listener(
+        [&changes](const ServerConfig& previous, const ServerConfig& current) {
+            changes.emplace_back(previous.messages_per_second, current.messages_per_second);
+        });
+
+    write_config("[server]\nmax_connections = 100\n[rate_limit]\nmessages_per_second = 25\n");
+
+    // SIGHUP 경로: 플래그 설정 후 poll()에서 리로드
+    EXPECT_FALSE(manager.poll());
+    manager.request_reload();
+    EXPECT_TRUE(manager.poll());
+
+    EXPECT_EQ(manager.current().messages_per_second, 25u);
+    EXPECT_EQ(manager.get_generation(), generation + 1);
+    ASSERT_FALSE(changes.empty());
+    EXPECT_EQ(changes.back(), std::make_pair(10u, 25u));
+
+    // 이전 스냅샷 참조는 여전히 유효
+    EXPECT_EQ(before.messages_per_second, 10u);
+
+    manager.remove_listener(listener_id);
+}
+
+TEST_F(ConfigTest, InvalidReloadKeepsCurrentConfig) {
+    auto& manager = ConfigManager::instance();
+
+    write_config("[server]\nmax_connections = 321\n");
+    ASSERT_TRUE(manager.load(path_));
+
+    write_config("[server]\nmax_connections = -5\n");
+    EXPECT_FALSE(manager.reload());
+    EXPECT_EQ(manager.current().max_connections, 321u);
+}
+
+TEST_F(ConfigTest, RestartRequiredChangesAreReported) {
+    ServerConfig a;
+    ServerConfig b;
+    b.port = 9090;
+    b.max_connections = 10;  // live 값은 보고하지 않음
+
+    auto changes = a.restart_required_changes(b);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes.front(), "server.port");
+}
+
+TEST_F(ConfigTest, ConcurrentReadersSeeConsistentSnapshots) {
+    auto& manager = ConfigManager::instance();
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> torn_reads{0};
+
+    // 게시하는 스냅샷은 항상 burst == messages_per_second * 2 를 만족
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                const ServerConfig& config = manager.current();
+                if (config.message_burst != config.messages_per_second * 2) {
+                    torn_reads.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (uint32_t i = 1; i <= 500; ++i) {
+        ServerConfig config;
+        config.messages_per_second = i;
+        config.message_burst = i * 2;
+        manager.publish(config);
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn_reads.load(), 0u);
+}
+
+TEST_F(ConfigTest, FindsConfigArgument) {
+    char program[] = "mmorpg_server";
+    char equals_form[] = "--config=config/production/server.conf";
+    char* argv1[] = {program, equals_form};
+    EXPECT_EQ(mmorpg::config::find_config_argument(2, argv1), "config/production/server.conf");
+
+    char flag[] = "--config";
+    char value[] = "dev.conf";
+    char* argv2[] = {program, flag, value};
+    EXPECT_EQ(mmorpg::config::find_config_argument(3, argv2), "dev.conf");
+
+    char* argv3[] = {program};
+    EXPECT_TRUE(mmorpg::config::find_config_argument(1, argv3).empty());
+}
+
+} // namespace mmorpg::tests
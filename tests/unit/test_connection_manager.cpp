@@ -1,8 +1,16 @@
 #include <gtest/gtest.h>
 #include "agents/connection_manager/connection_manager.hpp"
 #include "common/logger.hpp"
+#include "protocol/game_protocol.hpp"
+#include "protocol/json_codec.hpp"
+#include <boost/beast.hpp>
+#include <algorithm>
+#include <atomic>
 #include <thread>
 #include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace mmorpg::tests {
 
@@ -20,6 +28,20 @@ protected:
         connection_manager.reset();
     }
     
+    /**
+     * @brief 서버 쪽 핸드셰이크 완료까지 대기
+     *
+     * 연결은 핸드셰이크 전에 등록되므로 has_connection()만으로는 서버가 보낸 프레임이 버려질 수 있습니다.
+     * 읽기는 핸드셰이크가 끝난 뒤 시작하므로 Heartbeat 응답을 받으면 송신도 가능합니다.
+     */
+    static void wait_established(boost::beast::websocket::stream<boost::asio::ip::tcp::socket>& client) {
+        mmorpg::protocol::Heartbeat heartbeat;
+        client.binary(true);
+        client.write(boost::asio::buffer(mmorpg::protocol::wire::encode(heartbeat)));
+        boost::beast::flat_buffer buffer;
+        client.read(buffer);
+    }
+    
     std::unique_ptr<mmorpg::agents::connection_manager::ConnectionManagerAgent> connection_manager;
 };
 
@@ -87,6 +109,28 @@ TEST_F(ConnectionManagerTest, AuthenticateConnection) {
     connection_manager->stop();
 }
 
+TEST_F(ConnectionManagerTest, SessionListenerSeesLoginAndLogout) {
+    std::vector<std::pair<std::string, bool>> events;
+    connection_manager->set_session_listener([&](const std::string& user_id, bool online) {
+        events.emplace_back(user_id, online);
+    });
+    connection_manager->start();
+    
+    connection_manager->handle_new_connection("test_conn_1", "127.0.0.1");
+    connection_manager->handle_new_connection("test_conn_2", "127.0.0.1");
+    connection_manager->authenticate_connection("test_conn_1", "1001");
+    connection_manager->authenticate_connection("test_conn_1", "1001");  // 같은 사용자 재인증은 무시
+    connection_manager->authenticate_connection("test_conn_1", "1002");  // 다른 사용자로 교체
+    connection_manager->handle_disconnection("test_conn_1");
+    connection_manager->handle_disconnection("test_conn_2");             // 미인증 연결은 알리지 않음
+    
+    const std::vector<std::pair<std::string, bool>> expected = {
+        {"1001", true}, {"1001", false}, {"1002", true}, {"1002", false}};
+    EXPECT_EQ(events, expected);
+    
+    connection_manager->stop();
+}
+
 TEST_F(ConnectionManagerTest, UpdateActivity) {
     connection_manager->start();
     
@@ -161,6 +205,33 @@ TEST_F(ConnectionManagerTest, MaxConnectionsLimit) {
     connection_manager->stop();
 }
 
+TEST_F(ConnectionManagerTest, MemoryBudgetRejectsNewConnections) {
+    using mmorpg::common::MemoryCategory;
+    auto& memory = mmorpg::common::MemoryRegistry::instance();
+    const auto& owner = connection_manager->get_agent_id();
+    connection_manager->start();
+    
+    ASSERT_TRUE(connection_manager->handle_new_connection("test_conn_1", "127.0.0.1"));
+    const auto health = connection_manager->health_check();
+    ASSERT_EQ(health.count("memory_connections_bytes"), 1u);
+    EXPECT_GT(std::stoull(health.at("memory_connections_bytes")), 0u);
+    
+    // 예산을 넘은 동안은 새 연결만 거부하고 기존 연결은 유지
+    memory.set_budget(owner, MemoryCategory::CONNECTIONS, 1);
+    EXPECT_FALSE(connection_manager->handle_new_connection("test_conn_2", "127.0.0.1"));
+    EXPECT_EQ(connection_manager->get_metric("connection_rejected_memory"), 1.0);
+    EXPECT_EQ(connection_manager->get_connection_count(), 1u);
+    
+    memory.set_budget(owner, MemoryCategory::CONNECTIONS, 0);
+    EXPECT_TRUE(connection_manager->handle_new_connection("test_conn_2", "127.0.0.1"));
+    
+    connection_manager->handle_disconnection("test_conn_1");
+    connection_manager->handle_disconnection("test_conn_2");
+    EXPECT_EQ(memory.account(owner, MemoryCategory::CONNECTIONS).get_bytes(), 0u);
+    
+    connection_manager->stop();
+}
+
 TEST_F(ConnectionManagerTest, CleanupInactiveConnections) {
     connection_manager->start();
     
@@ -187,6 +258,589 @@ TEST_F(ConnectionManagerTest, CleanupInactiveConnections) {
     connection_manager->stop();
 }
 
+TEST_F(ConnectionManagerTest, HeartbeatIsAnsweredWithBinaryAck) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    
+    // 포트 충돌을 피하기 위해 커널 할당 포트 사용
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->start();
+    const uint16_t port = connection_manager->get_websocket_handler().get_port();
+    ASSERT_NE(port, 0);
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), port));
+    client.handshake("127.0.0.1", "/");
+    
+    // 잘못된 프레임은 조용히 버려지고 연결은 유지됨
+    client.binary(true);
+    client.write(net::buffer(std::string("\x01", 1)));
+    
+    protocol::Heartbeat heartbeat;
+    heartbeat.client_time_ms = 12345;
+    client.write(net::buffer(protocol::wire::encode(heartbeat)));
+    
+    beast::flat_buffer buffer;
+    client.read(buffer);
+    EXPECT_TRUE(client.got_binary());
+    
+    const auto data = buffer.cdata();
+    protocol::HeartbeatAckView ack;
+    ASSERT_TRUE(ack.bind_frame(std::string_view(static_cast<const char*>(data.data()), data.size())));
+    EXPECT_EQ(ack.client_time_ms(), 12345u);
+    EXPECT_GT(ack.server_time_ms(), 0u);
+    EXPECT_GE(connection_manager->get_metric("protocol_rejected_frames"), 1.0);
+    
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, JsonHeartbeatIsAnsweredWithJsonAck) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->start();
+    const uint16_t port = connection_manager->get_websocket_handler().get_port();
+    ASSERT_NE(port, 0);
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), port));
+    client.handshake("127.0.0.1", "/");
+    
+    // 잘못된 JSON과 알 수 없는 type은 거부되고 연결은 유지됨
+    client.text(true);
+    client.write(net::buffer(std::string(R"({"type":)")));
+    client.write(net::buffer(std::string(R"({"type":"dance"})")));
+    client.write(net::buffer(std::string(R"({"type":"heartbeat","client_time_ms":12345})")));
+    
+    beast::flat_buffer buffer;
+    client.read(buffer);
+    EXPECT_TRUE(client.got_text());
+    
+    std::string reply = beast::buffers_to_string(buffer.cdata());
+    mmorpg::protocol::json::JsonReader reader;
+    const auto* ack = reader.parse_insitu(reply.data());
+    ASSERT_NE(ack, nullptr);
+    EXPECT_EQ(mmorpg::protocol::json::get_string(*ack, "type"), "heartbeat_ack");
+    EXPECT_EQ(mmorpg::protocol::json::get_uint64(*ack, "client_time_ms"), 12345u);
+    EXPECT_GT(mmorpg::protocol::json::get_uint64(*ack, "server_time_ms").value_or(0), 0u);
+    EXPECT_GE(connection_manager->get_metric("protocol_rejected_frames"), 2.0);
+    
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, UdpChannelIsOfferedAfterAuthentication) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    using mmorpg::network::UdpPacketHeader;
+    using mmorpg::network::UdpPacketType;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    mmorpg::network::UdpChannelOptions udp_options;
+    udp_options.bind_address = "127.0.0.1:0";
+    connection_manager->enable_udp_channel(udp_options);
+    connection_manager->start();
+    ASSERT_NE(connection_manager->get_udp_channel(), nullptr);
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(),
+                                                      connection_manager->get_websocket_handler().get_port()));
+    client.handshake("127.0.0.1", "/");
+    for (int i = 0; i < 200 && !connection_manager->get_websocket_handler().has_connection("conn_1"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+    wait_established(client);
+    connection_manager->authenticate_connection("conn_1", "1001");
+    
+    beast::flat_buffer buffer;
+    client.read(buffer);
+    std::string frame = beast::buffers_to_string(buffer.cdata());
+    protocol::UdpOfferView offer;
+    ASSERT_TRUE(offer.bind_frame(frame));
+    EXPECT_EQ(offer.port(), connection_manager->get_udp_channel()->get_port());
+    
+    // 같은 호스트의 UDP 포트로 토큰 바인드
+    net::ip::udp::socket udp_client(io_context, net::ip::udp::endpoint(net::ip::address_v4::loopback(), 0));
+    const net::ip::udp::endpoint server(net::ip::address_v4::loopback(), offer.port());
+    const auto send_packet = [&](UdpPacketType type, uint32_t sequence, const std::string& payload) {
+        UdpPacketHeader header;
+        header.token = offer.token();
+        header.type = type;
+        header.sequence = sequence;
+        std::string packet(UdpPacketHeader::kSize, '\0');
+        header.encode(packet.data());
+        udp_client.send_to(net::buffer(packet + payload), server);
+    };
+    std::array<char, 2048> datagram{};
+    send_packet(UdpPacketType::BIND, 0, {});
+    size_t bytes = udp_client.receive(net::buffer(datagram));
+    ASSERT_EQ(UdpPacketHeader::decode(std::string_view(datagram.data(), bytes))->type, UdpPacketType::BIND_ACK);
+    
+    // UDP로 보낸 프레임은 WebSocket 바이너리 프레임과 같은 경로로 처리 (응답은 제어 채널로)
+    protocol::Heartbeat heartbeat;
+    heartbeat.client_time_ms = 777;
+    send_packet(UdpPacketType::DATA, 1, protocol::wire::encode(heartbeat));
+    buffer.consume(buffer.size());
+    client.read(buffer);
+    frame = beast::buffers_to_string(buffer.cdata());
+    protocol::HeartbeatAckView ack;
+    ASSERT_TRUE(ack.bind_frame(frame));
+    EXPECT_EQ(ack.client_time_ms(), 777u);
+    
+    // 바인드된 연결에는 고빈도 프레임을 UDP로 보냄
+    connection_manager->send_datagram("conn_1", 1, "snapshot");
+    bytes = udp_client.receive(net::buffer(datagram));
+    const std::string_view packet(datagram.data(), bytes);
+    EXPECT_EQ(UdpPacketHeader::decode(packet)->type, UdpPacketType::DATA);
+    EXPECT_EQ(packet.substr(UdpPacketHeader::kSize), "snapshot");
+    EXPECT_EQ(connection_manager->get_connection_stats()["udp_sessions"], 1.0);
+    
+    connection_manager->handle_disconnection("conn_1");
+    EXPECT_FALSE(connection_manager->get_udp_channel()->is_bound("conn_1"));
+    
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, FramesAreValidatedByStateBeforeDispatch) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    using mmorpg::network::FrameRejection;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->set_frame_limits(256, 4096, 0, 0);
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    
+    net::io_context io_context;
+    const auto connect = [&](beast::websocket::stream<net::ip::tcp::socket>& client) {
+        client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), handler.get_port()));
+        client.handshake("127.0.0.1", "/");
+        client.binary(true);
+    };
+    const auto expect_closed = [](beast::websocket::stream<net::ip::tcp::socket>& client,
+                                  beast::websocket::close_code code) {
+        beast::flat_buffer buffer;
+        beast::error_code ec;
+        client.read(buffer, ec);
+        EXPECT_EQ(ec, beast::websocket::error::closed);
+        EXPECT_EQ(client.reason().code, code);
+    };
+    
+    // 인증 전에는 게임 메시지를 받지 않음
+    beast::websocket::stream<net::ip::tcp::socket> early_mover(io_context);
+    connect(early_mover);
+    early_mover.write(net::buffer(protocol::wire::encode(protocol::MoveInput{})));
+    expect_closed(early_mover, beast::websocket::close_code::policy_error);
+    
+    // 인증 전 한도를 넘는 메시지는 버퍼에 쌓기 전에 거부
+    beast::websocket::stream<net::ip::tcp::socket> oversized(io_context);
+    connect(oversized);
+    oversized.write(net::buffer(std::string(1024, 'x')));
+    expect_closed(oversized, beast::websocket::close_code::too_big);
+    
+    // 인증 후에는 게임 메시지와 더 큰 메시지를 받음
+    beast::websocket::stream<net::ip::tcp::socket> player(io_context);
+    connect(player);
+    for (int i = 0; i < 200 && !handler.has_connection("conn_3"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(connection_manager->handle_new_connection("conn_3", "127.0.0.1"));
+    connection_manager->authenticate_connection("conn_3", "1001");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    
+    std::string move = protocol::wire::encode(protocol::MoveInput{});
+    move.resize(1024);
+    player.write(net::buffer(move));
+    protocol::Heartbeat heartbeat;
+    heartbeat.client_time_ms = 42;
+    player.write(net::buffer(protocol::wire::encode(heartbeat)));
+    beast::flat_buffer buffer;
+    player.read(buffer);
+    protocol::HeartbeatAckView ack;
+    ASSERT_TRUE(ack.bind_frame(beast::buffers_to_string(buffer.cdata())));
+    EXPECT_EQ(ack.client_time_ms(), 42u);
+    
+    const auto rejections = handler.get_frame_rejections();
+    EXPECT_EQ(rejections[static_cast<size_t>(FrameRejection::OPCODE_NOT_ALLOWED)], 1u);
+    EXPECT_EQ(rejections[static_cast<size_t>(FrameRejection::TOO_LARGE)], 1u);
+    
+    beast::error_code ec;
+    player.close(beast::websocket::close_code::normal, ec);
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, MessageFloodDisconnects) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->set_frame_limits(4096, 4096, 10, 5);
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), handler.get_port()));
+    client.handshake("127.0.0.1", "/");
+    client.binary(true);
+    
+    // 버스트(5개)를 넘겨 몰아 보내면 끊김
+    const std::string heartbeat = protocol::wire::encode(protocol::Heartbeat{});
+    beast::error_code ec;
+    for (int i = 0; i < 20 && !ec; ++i) {
+        client.write(net::buffer(heartbeat), ec);
+    }
+    
+    beast::flat_buffer buffer;
+    size_t acks = 0;
+    while (!client.read(buffer, ec), !ec) {
+        buffer.consume(buffer.size());
+        ++acks;
+    }
+    EXPECT_EQ(ec, beast::websocket::error::closed);
+    EXPECT_EQ(client.reason().code, beast::websocket::close_code::policy_error);
+    EXPECT_LE(acks, 5u);
+    EXPECT_EQ(handler.get_frame_rejections()[static_cast<size_t>(mmorpg::network::FrameRejection::RATE_LIMITED)], 1u);
+    
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, PingMeasuresRoundTripTime) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->set_ping_interval(std::chrono::milliseconds(20));
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), handler.get_port()));
+    client.handshake("127.0.0.1", "/");
+    
+    // 요청하지 않은 퐁은 표본이 되지 않음
+    client.pong(beast::websocket::ping_data("12345678"));
+    
+    // 읽기 중인 클라이언트는 핑에 자동으로 퐁을 보냄
+    size_t pings = 0;
+    client.control_callback([&pings](beast::websocket::frame_type kind, beast::string_view) {
+        if (kind == beast::websocket::frame_type::ping) {
+            ++pings;
+        }
+    });
+    beast::flat_buffer buffer;
+    client.async_read(buffer, [](beast::error_code, size_t) {});
+    io_context.run_for(std::chrono::milliseconds(300));
+    
+    const auto rtt = handler.get_connection_rtt("conn_1");
+    ASSERT_TRUE(rtt);
+    EXPECT_GE(pings, 3u);
+    EXPECT_GE(rtt->samples, 2u);
+    EXPECT_LE(rtt->samples, pings);
+    EXPECT_GT(rtt->smoothed_us, 0u);
+    EXPECT_LT(rtt->smoothed_us, 100000u);
+    EXPECT_EQ(handler.get_rtt_histogram().count, rtt->samples);
+    EXPECT_FALSE(handler.get_connection_rtt("conn_404"));
+    
+    const auto traffic = handler.collect_connection_traffic();
+    ASSERT_EQ(traffic.size(), 1u);
+    EXPECT_EQ(traffic[0].rtt_us, rtt->smoothed_us);
+    EXPECT_TRUE(connection_manager->get_connection_stats().count("rtt_p99_ms"));
+    
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, DrainFlushesQueueThenRedirects) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    
+    // 수용량 비례 분산: node-b(300)와 node-c(100)에 3:1로, 자기 자신(node-a)은 제외
+    auto& load_balancer = connection_manager->get_load_balancer();
+    load_balancer.add_server("node-a", "127.0.0.1", handler.get_port(), 1000);
+    load_balancer.add_server("node-b", "10.0.0.2", 9001, 300);
+    load_balancer.add_server("node-c", "10.0.0.3", 9002, 100);
+    const auto targets = load_balancer.select_servers(8, "node-a");
+    ASSERT_EQ(targets.size(), 8u);
+    EXPECT_EQ(std::count(targets.begin(), targets.end(), "node-b"), 6);
+    EXPECT_EQ(std::count(targets.begin(), targets.end(), "node-c"), 2);
+    EXPECT_EQ(std::adjacent_find(targets.begin(), targets.end(),
+                                 [](const auto& a, const auto& b) { return a == "node-c" && b == "node-c"; }),
+              targets.end());
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), handler.get_port()));
+    client.handshake("127.0.0.1", "/");
+    for (int i = 0; i < 200 && !handler.has_connection("conn_1"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+    wait_established(client);
+    
+    // 드레인 직전에 쌓인 프레임은 재접속 안내보다 먼저 모두 전달
+    for (uint64_t i = 1; i <= 3; ++i) {
+        protocol::HeartbeatAck ack;
+        ack.client_time_ms = i;
+        connection_manager->send_datagram("conn_1", 0, protocol::wire::encode(ack));
+    }
+    connection_manager->begin_drain();
+    EXPECT_TRUE(connection_manager->is_draining());
+    EXPECT_FALSE(connection_manager->handle_new_connection("conn_2", "127.0.0.1"));
+    EXPECT_EQ(connection_manager->drain_connections(std::chrono::milliseconds(200), "node-a"), 1u);
+    
+    beast::flat_buffer buffer;
+    for (uint64_t i = 1; i <= 3; ++i) {
+        client.read(buffer);
+        protocol::HeartbeatAckView ack;
+        ASSERT_TRUE(ack.bind_frame(beast::buffers_to_string(buffer.cdata())));
+        EXPECT_EQ(ack.client_time_ms(), i);
+        buffer.consume(buffer.size());
+    }
+    
+    client.read(buffer);
+    const std::string frame = beast::buffers_to_string(buffer.cdata());
+    protocol::ReconnectView reconnect;
+    ASSERT_TRUE(reconnect.bind_frame(frame));
+    EXPECT_EQ(reconnect.host(), "10.0.0.2");
+    EXPECT_EQ(reconnect.port(), 9001);
+    EXPECT_LE(reconnect.delay_ms(), 200u);
+    buffer.consume(buffer.size());
+    
+    beast::error_code ec;
+    client.read(buffer, ec);
+    EXPECT_EQ(ec, beast::websocket::error::closed);
+    EXPECT_EQ(client.reason().code, beast::websocket::close_code::going_away);
+    for (int i = 0; i < 200 && handler.get_connection_count() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(handler.get_connection_count(), 0u);
+    
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, BandwidthLimitDefersLowPriorityFrames) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    
+    net::io_context io_context;
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), handler.get_port()));
+    client.handshake("127.0.0.1", "/");
+    for (int i = 0; i < 200 && !handler.has_connection("conn_1"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+    wait_established(client);
+    
+    // 초당 4000바이트 (버스트 1000바이트): 500바이트 프레임 둘은 바로, 이후 LOW 프레임은 125ms 간격
+    constexpr size_t kFrameSize = 500;
+    connection_manager->set_bandwidth_limits(4000, 0);
+    const auto frame = [](char tag) { return std::string(kFrameSize, tag); };
+    const auto started = std::chrono::steady_clock::now();
+    for (const char tag : {'a', 'b', 'c', 'd'}) {
+        connection_manager->send_datagram("conn_1", 0, frame(tag));
+    }
+    
+    // 신뢰 프레임(NORMAL)은 한도를 넘어도 미뤄진 LOW 프레임을 앞지름
+    connection_manager->send_datagram("conn_1", 0, frame('N'), true);
+    
+    std::string order;
+    beast::flat_buffer buffer;
+    for (int i = 0; i < 5; ++i) {
+        client.read(buffer);
+        const std::string received = beast::buffers_to_string(buffer.cdata());
+        ASSERT_EQ(received.size(), kFrameSize);
+        order += received.front();
+        buffer.consume(buffer.size());
+    }
+    // b는 a를 쓰는 동안 큐에 들어가므로 N보다 먼저 나갈 수도 있음
+    EXPECT_LE(order.find('N'), 2u);
+    order.erase(order.find('N'), 1);
+    EXPECT_EQ(order, "abcd");
+    EXPECT_GE(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(250));
+    EXPECT_GE(connection_manager->get_connection_stats().at("egress_deferred_frames"), 1.0);
+    
+    // 바이트는 읽기/쓰기 완료 시점에 셈 (wait_established의 Heartbeat 왕복 포함)
+    protocol::Heartbeat heartbeat;
+    heartbeat.client_time_ms = 1;
+    const std::string heartbeat_frame = protocol::wire::encode(heartbeat);
+    client.write(net::buffer(heartbeat_frame));
+    client.read(buffer);
+    const size_t ack_size = buffer.size();
+    
+    const uint64_t expected_sent = 5 * kFrameSize + 2 * ack_size;
+    for (int i = 0; i < 200 && connection_manager->get_connection_info("conn_1")->bytes_sent < expected_sent; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    const auto info = connection_manager->get_connection_info("conn_1");
+    ASSERT_TRUE(info);
+    EXPECT_EQ(info->bytes_sent, expected_sent);
+    EXPECT_EQ(info->bytes_received, 2 * heartbeat_frame.size());
+    
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+    connection_manager->stop();
+}
+
+TEST_F(ConnectionManagerTest, CoroutineSessionsMatchCallbackBehavior) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    namespace protocol = mmorpg::protocol;
+    
+    connection_manager = std::make_unique<mmorpg::agents::connection_manager::ConnectionManagerAgent>(100, 0, 1);
+    connection_manager->set_session_mode(mmorpg::network::SessionMode::COROUTINE);
+    connection_manager->set_frame_limits(256, 1024, 0, 0);
+    connection_manager->start();
+    const auto& handler = connection_manager->get_websocket_handler();
+    EXPECT_EQ(handler.get_session_mode(), mmorpg::network::SessionMode::COROUTINE);
+    
+    net::io_context io_context;
+    const net::ip::tcp::endpoint endpoint(net::ip::address_v4::loopback(), handler.get_port());
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(endpoint);
+    client.handshake("127.0.0.1", "/");
+    
+    // 읽기 루프가 여러 프레임을 이어서 처리
+    client.binary(true);
+    beast::flat_buffer buffer;
+    for (uint64_t i = 1; i <= 3; ++i) {
+        protocol::Heartbeat heartbeat;
+        heartbeat.client_time_ms = i;
+        client.write(net::buffer(protocol::wire::encode(heartbeat)));
+        client.read(buffer);
+        protocol::HeartbeatAckView ack;
+        ASSERT_TRUE(ack.bind_frame(beast::buffers_to_string(buffer.cdata())));
+        EXPECT_EQ(ack.client_time_ms(), i);
+        buffer.consume(buffer.size());
+    }
+    
+    // 수신 검증도 같은 경로 - 인증 전 한도를 넘으면 끊김
+    beast::error_code ec;
+    client.write(net::buffer(std::string(512, 'x')), ec);
+    client.read(buffer, ec);
+    EXPECT_EQ(ec, beast::websocket::error::closed);
+    EXPECT_EQ(client.reason().code, beast::websocket::close_code::too_big);
+    for (int i = 0; i < 200 && handler.get_connection_count() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(handler.get_connection_count(), 0u);
+    
+    connection_manager->stop();
+}
+
+TEST(WebSocketDispatchTest, HandlersSwapLiveOnOpenConnections) {
+    namespace beast = boost::beast;
+    namespace net = boost::asio;
+    using mmorpg::network::WebSocketDispatch;
+    using mmorpg::network::WebSocketHandler;
+
+    mmorpg::common::Logger::initialize("test.log");
+    WebSocketHandler handler(0, 2);
+    const auto echo_with = [&handler](std::string prefix) {
+        return [&handler, prefix](const std::string& connection_id, std::string_view message, bool) {
+            handler.send_to_connection(connection_id, prefix + std::string(message));
+        };
+    };
+    std::atomic<int> connected{0};
+    handler.set_message_handler(echo_with("a:"));
+    handler.set_connection_handler([&connected](const std::string&) { ++connected; });
+    handler.start();
+
+    net::io_context io_context;
+    const net::ip::tcp::endpoint endpoint(net::ip::address_v4::loopback(), handler.get_port());
+    beast::websocket::stream<net::ip::tcp::socket> client(io_context);
+    client.next_layer().connect(endpoint);
+    client.handshake("127.0.0.1", "/");
+    beast::flat_buffer buffer;
+    const auto round_trip = [&](const std::string& message) {
+        client.write(net::buffer(message));
+        buffer.consume(buffer.size());
+        client.read(buffer);
+        return beast::buffers_to_string(buffer.cdata());
+    };
+    EXPECT_EQ(round_trip("1"), "a:1");
+
+    // 메시지가 오가는 중에 교체해도 각 메시지는 옛 핸들러나 새 핸들러 중 하나로 한 번만 전달
+    std::atomic<bool> swapping{true};
+    std::thread swapper([&]() {
+        for (int i = 0; swapping.load(); ++i) {
+            handler.set_message_handler(echo_with(i % 2 == 0 ? "b:" : "a:"));
+        }
+    });
+    for (int i = 0; i < 200; ++i) {
+        const std::string reply = round_trip(std::to_string(i));
+        if (reply != "a:" + std::to_string(i) && reply != "b:" + std::to_string(i)) {
+            ADD_FAILURE() << "unexpected reply " << reply;
+            break;
+        }
+    }
+    swapping = false;
+    swapper.join();
+
+    // 교체가 반환된 뒤 보낸 메시지부터는 새 묶음으로 전달되고, 빠진 항목은 호출하지 않음
+    std::atomic<int> disconnected{0};
+    WebSocketDispatch handlers;
+    handlers.on_message = echo_with("c:");
+    handlers.on_disconnection = [&disconnected](const std::string&) { ++disconnected; };
+    handler.set_handlers(std::move(handlers));
+    EXPECT_EQ(round_trip("2"), "c:2");
+
+    beast::websocket::stream<net::ip::tcp::socket> second(io_context);
+    second.next_layer().connect(endpoint);
+    second.handshake("127.0.0.1", "/");
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+    second.close(beast::websocket::close_code::normal, ec);
+    for (int i = 0; i < 200 && disconnected.load() < 2; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(disconnected.load(), 2);
+    EXPECT_EQ(connected.load(), 1);
+
+    handler.stop();
+}
+
+TEST(RttEstimatorTest, SmoothsSamplesLikeRfc6298) {
+    mmorpg::network::RttEstimator estimator;
+    estimator.record(std::chrono::microseconds(800));
+    auto rtt = estimator.snapshot();
+    EXPECT_EQ(rtt.smoothed_us, 800u);
+    EXPECT_EQ(rtt.jitter_us, 400u);
+    
+    // RTTVAR = 3/4 * 400 + 1/4 * |800 - 1600| = 500, SRTT = 7/8 * 800 + 1/8 * 1600 = 900
+    estimator.record(std::chrono::microseconds(1600));
+    rtt = estimator.snapshot();
+    EXPECT_EQ(rtt.last_us, 1600u);
+    EXPECT_EQ(rtt.smoothed_us, 900u);
+    EXPECT_EQ(rtt.jitter_us, 500u);
+    EXPECT_EQ(rtt.samples, 2u);
+}
+
 } // namespace mmorpg::tests
 
 
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "cluster/gossip_membership.hpp"
+#include "network/load_balancer.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace mmorpg::tests {
+
+using mmorpg::cluster::GossipMembership;
+using mmorpg::cluster::MemberLoad;
+using mmorpg::cluster::MembershipOptions;
+using mmorpg::cluster::MemberState;
+using mmorpg::network::LoadBalancer;
+
+namespace {
+
+MembershipOptions make_options(const std::string& node_id, uint16_t service_port,
+                               std::vector<std::string> seeds = {}) {
+    MembershipOptions options;
+    options.node_id = node_id;
+    options.bind_address = "127.0.0.1:0";
+    options.service_port = service_port;
+    options.seeds = std::move(seeds);
+    options.protocol_period = std::chrono::milliseconds(50);
+    options.ping_timeout = std::chrono::milliseconds(20);
+    options.suspect_timeout = std::chrono::milliseconds(300);
+    options.dead_retention = std::chrono::seconds(5);
+    return options;
+}
+
+std::string address_of(const GossipMembership& membership) {
+    return "127.0.0.1:" + std::to_string(membership.get_port());
+}
+
+template<typename Predicate>
+bool wait_until(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+std::optional<MemberState> state_of(const GossipMembership& membership, const std::string& node_id) {
+    auto member = membership.get_member(node_id);
+    return member ? std::optional<MemberState>(member->state) : std::nullopt;
+}
+
+} // namespace
+
+class GossipMembershipTest : public ::testing::Test {
+protected:
+    /**
+     * @brief a를 시드로 하는 노드 셋 시작
+     */
+    void start_cluster() {
+        a = std::make_unique<GossipMembership>(make_options("a", 9001));
+        a->attach_load_balancer(&balancer);
+        ASSERT_TRUE(a->start());
+
+        b = std::make_unique<GossipMembership>(make_options("b", 9002, {address_of(*a)}));
+        ASSERT_TRUE(b->start());
+        c = std::make_unique<GossipMembership>(make_options("c", 9003, {address_of(*a)}));
+        ASSERT_TRUE(c->start());
+
+        ASSERT_TRUE(wait_until([&]() {
+            return a->get_alive_count() == 3 && b->get_alive_count() == 3 && c->get_alive_count() == 3;
+        }));
+    }
+
+    LoadBalancer balancer;
+    std::unique_ptr<GossipMembership> a;
+    std::unique_ptr<GossipMembership> b;
+    std::unique_ptr<GossipMembership> c;
+};
+
+TEST_F(GossipMembershipTest, NodesDiscoverEachOtherThroughSeed) {
+    start_cluster();
+
+    // b와 c는 시드(a)를 통해서만 서로를 알게 됨
+    EXPECT_EQ(state_of(*b, "c"), MemberState::ALIVE);
+    EXPECT_EQ(state_of(*c, "b"), MemberState::ALIVE);
+
+    // a의 LoadBalancer에 자신 포함 세 노드가 등록됨
+    ASSERT_TRUE(wait_until([&]() { return balancer.get_all_servers().size() == 3; }));
+    const auto* server = balancer.get_server("b");
+    ASSERT_NE(server, nullptr);
+    EXPECT_EQ(server->host, "127.0.0.1");
+    EXPECT_EQ(server->port, 9002);
+    EXPECT_TRUE(server->is_healthy.load());
+}
+
+TEST_F(GossipMembershipTest, DetectsFailureWithinSeconds) {
+    start_cluster();
+    ASSERT_TRUE(wait_until([&]() { return balancer.has_server("c"); }));
+
+    const auto failed_at = std::chrono::steady_clock::now();
+    c->stop();  // 탈퇴 알림 없이 중단 (프로세스 장애)
+
+    ASSERT_TRUE(wait_until([&]() {
+        return state_of(*a, "c") == MemberState::DEAD && state_of(*b, "c") == MemberState::DEAD;
+    }));
+    EXPECT_LT(std::chrono::steady_clock::now() - failed_at, std::chrono::seconds(3));
+    EXPECT_FALSE(balancer.has_server("c"));
+    EXPECT_EQ(a->get_alive_count(), 2u);
+    EXPECT_EQ(state_of(*a, "b"), MemberState::ALIVE);
+}
+
+TEST_F(GossipMembershipTest, LeaveIsDisseminatedImmediately) {
+    start_cluster();
+    ASSERT_TRUE(wait_until([&]() { return balancer.has_server("b"); }));
+
+    b->leave();
+
+    // 의심 단계를 거치지 않고 바로 DEAD
+    ASSERT_TRUE(wait_until([&]() { return state_of(*a, "b") == MemberState::DEAD; },
+                           std::chrono::milliseconds(250)));
+    EXPECT_FALSE(balancer.has_server("b"));
+}
+
+TEST_F(GossipMembershipTest, RestartedNodeRejoinsWithHigherIncarnation) {
+    start_cluster();
+    const uint64_t old_incarnation = a->get_member("c")->incarnation;
+
+    c->stop();
+    ASSERT_TRUE(wait_until([&]() { return state_of(*a, "c") == MemberState::DEAD; }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    c = std::make_unique<GossipMembership>(make_options("c", 9003, {address_of(*a)}));
+    ASSERT_TRUE(c->start());
+
+    ASSERT_TRUE(wait_until([&]() { return state_of(*a, "c") == MemberState::ALIVE; }));
+    EXPECT_GT(a->get_member("c")->incarnation, old_incarnation);
+    ASSERT_TRUE(wait_until([&]() { return balancer.has_server("c"); }));
+}
+
+TEST_F(GossipMembershipTest, LoadIsGossipedToLoadBalancer) {
+    std::atomic<uint32_t> connections{0};
+
+    a = std::make_unique<GossipMembership>(make_options("a", 9001));
+    a->attach_load_balancer(&balancer);
+    ASSERT_TRUE(a->start());
+
+    b = std::make_unique<GossipMembership>(make_options("b", 9002, {address_of(*a)}));
+    b->set_load_provider([&]() {
+        MemberLoad load;
+        load.cpu_usage = 0.25;
+        load.memory_usage = 0.5;
+        load.connections = connections.load();
+        load.max_connections = 2000;
+        return load;
+    });
+    ASSERT_TRUE(b->start());
+
+    ASSERT_TRUE(wait_until([&]() { return balancer.has_server("b"); }));
+    connections = 42;
+
+    ASSERT_TRUE(wait_until([&]() {
+        const auto* server = balancer.get_server("b");
+        return server && server->current_connections.load() == 42;
+    }));
+    const auto* server = balancer.get_server("b");
+    EXPECT_EQ(server->max_connections.load(), 2000u);
+    EXPECT_NEAR(server->cpu_usage.load(), 0.25, 1e-6);
+    EXPECT_NEAR(server->memory_usage.load(), 0.5, 1e-6);
+}
+
+} // namespace mmorpg::tests
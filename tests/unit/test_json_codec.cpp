@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "protocol/json_codec.hpp"
+#include <string>
+
+namespace mmorpg::tests {
+
+namespace json = mmorpg::protocol::json;
+
+TEST(JsonCodecTest, ParsesInSituIntoReceiveBuffer) {
+    json::JsonReader reader;
+    std::string frame = R"({"type":"heartbeat","client_time_ms":42})";
+
+    const json::Document* document = reader.parse_insitu(frame.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_TRUE(reader.get_error().empty());
+
+    const auto type = json::get_string(*document, "type");
+    ASSERT_TRUE(type.has_value());
+    EXPECT_EQ(*type, "heartbeat");
+    EXPECT_EQ(json::get_uint64(*document, "client_time_ms"), 42u);
+
+    // 문자열 값은 복사 없이 수신 버퍼를 가리킴
+    EXPECT_GE(type->data(), frame.data());
+    EXPECT_LT(type->data(), frame.data() + frame.size());
+}
+
+TEST(JsonCodecTest, UnescapesStringsInPlace) {
+    json::JsonReader reader;
+    std::string frame = R"({"text":"say \"hi\"\n"})";
+
+    const json::Document* document = reader.parse_insitu(frame.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_EQ(json::get_string(*document, "text"), "say \"hi\"\n");
+}
+
+TEST(JsonCodecTest, MissingOrMistypedMembers) {
+    json::JsonReader reader;
+    std::string frame = R"({"type":7,"client_time_ms":"soon"})";
+
+    const json::Document* document = reader.parse_insitu(frame.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_FALSE(json::get_string(*document, "type").has_value());
+    EXPECT_FALSE(json::get_uint64(*document, "client_time_ms").has_value());
+    EXPECT_FALSE(json::get_string(*document, "missing").has_value());
+
+    // 루트가 객체가 아닌 경우
+    std::string array = "[1,2,3]";
+    document = reader.parse_insitu(array.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_FALSE(json::get_string(*document, "type").has_value());
+}
+
+TEST(JsonCodecTest, RejectsMalformedAndRecovers) {
+    json::JsonReader reader;
+    std::string broken = R"({"type":)";
+    EXPECT_EQ(reader.parse_insitu(broken.data()), nullptr);
+    EXPECT_FALSE(reader.get_error().empty());
+
+    std::string trailing = R"({"type":"a"} x)";
+    EXPECT_EQ(reader.parse_insitu(trailing.data()), nullptr);
+
+    std::string valid = R"({"type":"ok"})";
+    const json::Document* document = reader.parse_insitu(valid.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_TRUE(reader.get_error().empty());
+    EXPECT_EQ(json::get_string(*document, "type"), "ok");
+}
+
+TEST(JsonCodecTest, PoolIsReusedAcrossMessages) {
+    json::JsonReader reader(16 * 1024);
+    const std::string message = R"({"type":"chat","channel":2,"text":"meet at the bridge","tags":["a","b","c"]})";
+
+    for (int i = 0; i < 1000; ++i) {
+        std::string frame = message;
+        ASSERT_NE(reader.parse_insitu(frame.data()), nullptr);
+    }
+    EXPECT_EQ(reader.get_overflow_count(), 0u);
+    EXPECT_EQ(reader.get_pool_size(), 16u * 1024);
+}
+
+TEST(JsonCodecTest, PoolGrowsAfterOverflow) {
+    json::JsonReader reader(1024, 1024 * 1024);
+
+    std::string message = "{";
+    for (int i = 0; i < 200; ++i) {
+        message += (i ? ",\"k" : "\"k") + std::to_string(i) + "\":" + std::to_string(i);
+    }
+    message += "}";
+
+    std::string frame = message;
+    ASSERT_NE(reader.parse_insitu(frame.data()), nullptr);
+
+    // 다음 파싱 전에 넘침을 감지하고 풀을 키움
+    frame = message;
+    const json::Document* document = reader.parse_insitu(frame.data());
+    ASSERT_NE(document, nullptr);
+    EXPECT_EQ(reader.get_overflow_count(), 1u);
+    EXPECT_GT(reader.get_pool_size(), 1024u);
+    EXPECT_EQ(json::get_uint64(*document, "k199"), 199u);
+
+    // 키운 뒤에는 같은 크기의 메시지가 넘치지 않음
+    frame = message;
+    ASSERT_NE(reader.parse_insitu(frame.data()), nullptr);
+    frame = message;
+    ASSERT_NE(reader.parse_insitu(frame.data()), nullptr);
+    EXPECT_EQ(reader.get_overflow_count(), 1u);
+}
+
+TEST(JsonCodecTest, WriterReusesOutputBuffer) {
+    json::JsonWriter writer;
+
+    auto& first = writer.begin();
+    first.StartObject();
+    first.Key("type");
+    first.String("heartbeat_ack");
+    first.Key("client_time_ms");
+    first.Uint64(42);
+    first.EndObject();
+    EXPECT_EQ(writer.get_output(), R"({"type":"heartbeat_ack","client_time_ms":42})");
+
+    const char* data = writer.get_output().data();
+    const size_t capacity = writer.get_output().capacity();
+
+    auto& second = writer.begin();
+    second.StartObject();
+    second.Key("text");
+    json::write_string(second, std::string_view("quoted \"text\" here").substr(0, 6));
+    second.EndObject();
+    EXPECT_EQ(writer.get_output(), R"({"text":"quoted"})");
+    EXPECT_EQ(writer.get_output().data(), data);
+    EXPECT_EQ(writer.get_output().capacity(), capacity);
+}
+
+} // namespace mmorpg::tests
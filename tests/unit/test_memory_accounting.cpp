@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "common/base_agent.hpp"
+#include "common/logger.hpp"
+#include "common/memory_accounting.hpp"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::common::MemoryAccount;
+using mmorpg::common::MemoryCategory;
+using mmorpg::common::MemoryRegistry;
+using mmorpg::common::TrackingAllocator;
+
+namespace {
+
+class WorldAgent : public mmorpg::common::BaseAgent {
+public:
+    WorldAgent()
+        : BaseAgent("MemoryTestWorld") {
+    }
+
+    void start() override {
+        running_.store(true, std::memory_order_release);
+        memory_account(MemoryCategory::WORLD).charge(4096);
+    }
+
+    void stop() override {
+        running_.store(false, std::memory_order_release);
+        memory_account(MemoryCategory::WORLD).release(4096);
+    }
+};
+
+} // namespace
+
+class MemoryRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mmorpg::common::Logger::initialize("test.log");
+    }
+};
+
+TEST(MemoryAccountTest, TracksBytesPeakAndBudget) {
+    MemoryAccount account("Owner", MemoryCategory::BUFFERS);
+
+    account.charge(100);
+    account.charge(50);
+    account.release(120);
+    EXPECT_EQ(account.get_bytes(), 30u);
+    EXPECT_EQ(account.get_peak(), 150u);
+    EXPECT_FALSE(account.over_budget());   // 예산 0 = 제한 없음
+
+    account.set_budget(20);
+    EXPECT_TRUE(account.over_budget());
+    account.release(10);
+    EXPECT_FALSE(account.over_budget());
+}
+
+TEST(MemoryAccountTest, TrackingAllocatorChargesContainerStorage) {
+    MemoryAccount account("Owner", MemoryCategory::CACHES);
+    {
+        std::vector<uint64_t, TrackingAllocator<uint64_t>> values{TrackingAllocator<uint64_t>(&account)};
+        values.reserve(128);
+        EXPECT_EQ(account.get_bytes(), 128 * sizeof(uint64_t));
+
+        // 노드 기반 컨테이너는 rebind된 할당자로 노드와 버킷을 할당
+        using Map = std::unordered_map<uint64_t, std::string, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                       TrackingAllocator<std::pair<const uint64_t, std::string>>>;
+        Map map(0, std::hash<uint64_t>{}, std::equal_to<uint64_t>{}, Map::allocator_type(&account));
+        for (uint64_t key = 0; key < 100; ++key) {
+            map.emplace(key, "node");
+        }
+        EXPECT_GT(account.get_bytes(), 128 * sizeof(uint64_t) + 100 * sizeof(Map::value_type));
+
+        std::list<int, TrackingAllocator<int>> list{TrackingAllocator<int>(&account)};
+        const size_t before_list = account.get_bytes();
+        list.push_back(1);
+        EXPECT_GE(account.get_bytes(), before_list + sizeof(int));
+    }
+    EXPECT_EQ(account.get_bytes(), 0u);
+}
+
+TEST_F(MemoryRegistryTest, PressureListenersRunOnlyForAccountsOverBudget) {
+    MemoryRegistry registry;
+    auto& cache = registry.account("Directory", MemoryCategory::CACHES);
+    auto& buffers = registry.account("Connections", MemoryCategory::BUFFERS);
+    EXPECT_EQ(&registry.account("Directory", MemoryCategory::CACHES), &cache);
+
+    std::vector<std::string> calls;
+    const uint64_t cache_listener = registry.add_pressure_listener(
+        "Directory", MemoryCategory::CACHES, [&](const MemoryAccount& account) {
+            calls.push_back(account.get_owner());
+            cache.release(account.get_bytes() / 2);   // 캐시 축소
+        });
+    registry.add_pressure_listener("Connections", MemoryCategory::BUFFERS,
+                                   [&](const MemoryAccount& account) { calls.push_back(account.get_owner()); });
+
+    cache.charge(1000);
+    buffers.charge(1000);
+    registry.set_budget("Directory", MemoryCategory::CACHES, 600);
+    registry.set_budget("Connections", MemoryCategory::BUFFERS, 2000);
+
+    EXPECT_EQ(registry.check_budgets(), 1u);
+    EXPECT_EQ(calls, (std::vector<std::string>{"Directory"}));
+    EXPECT_EQ(cache.get_bytes(), 500u);
+
+    // 압박이 해소되면 더 이상 호출되지 않음
+    EXPECT_EQ(registry.check_budgets(), 0u);
+    EXPECT_EQ(calls.size(), 1u);
+
+    cache.charge(1000);
+    registry.remove_pressure_listener(cache_listener);
+    EXPECT_EQ(registry.check_budgets(), 1u);
+    EXPECT_EQ(calls.size(), 1u);
+
+    EXPECT_EQ(registry.get_total_bytes(), 2500u);
+    const auto usage = registry.snapshot("Connections");
+    ASSERT_EQ(usage.size(), 1u);
+    EXPECT_EQ(usage[0].category, MemoryCategory::BUFFERS);
+    EXPECT_EQ(usage[0].bytes, 1000u);
+    EXPECT_EQ(usage[0].budget, 2000u);
+}
+
+TEST_F(MemoryRegistryTest, AgentHealthCheckReportsItsAccounts) {
+    WorldAgent agent;
+    agent.start();
+
+    auto health = agent.health_check();
+    EXPECT_EQ(health["memory_world_bytes"], "4096");
+    EXPECT_EQ(health["memory_world_peak_bytes"], "4096");
+    EXPECT_EQ(health.count("memory_world_budget_bytes"), 0u);
+
+    MemoryRegistry::instance().set_budget("MemoryTestWorld", MemoryCategory::WORLD, 1024);
+    health = agent.health_check();
+    EXPECT_EQ(health["memory_world_budget_bytes"], "1024");
+
+    agent.stop();
+    EXPECT_EQ(agent.health_check()["memory_world_bytes"], "0");
+    MemoryRegistry::instance().set_budget("MemoryTestWorld", MemoryCategory::WORLD, 0);
+}
+
+} // namespace mmorpg::tests
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "agents/monitoring/monitoring_agent.hpp"
+#include "cluster/cluster_transport.hpp"
+#include "common/logger.hpp"
+#include "common/metrics.hpp"
+#include "network/message_stats.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace mmorpg::tests {
+
+using mmorpg::agents::monitoring::MonitoringAgent;
+using mmorpg::common::LatencyHistogram;
+using mmorpg::network::MessageStats;
+
+namespace {
+
+class DummyAgent : public mmorpg::common::BaseAgent {
+public:
+    DummyAgent() : BaseAgent("Dummy") {}
+    void start() override { running_.store(true, std::memory_order_release); }
+    void stop() override { running_.store(false, std::memory_order_release); }
+};
+
+} // namespace
+
+class MonitoringAgentTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mmorpg::common::Logger::initialize("test.log");
+        monitoring = std::make_unique<MonitoringAgent>(std::chrono::seconds(60), 0);
+    }
+
+    void TearDown() override {
+        if (monitoring) {
+            monitoring->stop();
+        }
+        monitoring.reset();
+    }
+
+    std::unique_ptr<MonitoringAgent> monitoring;
+};
+
+TEST(MessageStatsTest, ClassifyFrames) {
+    EXPECT_EQ(MessageStats::classify("hello", false), MessageStats::kTextSlot);
+    EXPECT_EQ(MessageStats::classify(std::string("\x07\x00payload", 9), true), 7);
+    EXPECT_EQ(MessageStats::classify(std::string("\xff\xff", 2), true), MessageStats::kOtherSlot);
+    EXPECT_EQ(MessageStats::classify(std::string("\x01", 1), true), MessageStats::kOtherSlot);
+}
+
+TEST(MessageStatsTest, RecordAndSnapshot) {
+    MessageStats stats;
+    stats.record_inbound(3, 100, 1000);
+    stats.record_inbound(3, 50, 2000);
+    stats.record_outbound(3, 10);
+
+    auto snapshot = stats.snapshot();
+    EXPECT_EQ(snapshot[3].inbound_count, 2u);
+    EXPECT_EQ(snapshot[3].inbound_bytes, 150u);
+    EXPECT_EQ(snapshot[3].outbound_count, 1u);
+    EXPECT_EQ(snapshot[3].outbound_bytes, 10u);
+    EXPECT_EQ(snapshot[3].handler_latency.count, 2u);
+    EXPECT_EQ(snapshot[3].handler_latency.sum_ns, 3000u);
+}
+
+TEST(LatencyHistogramTest, PercentileWithinBucket) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 99; ++i) {
+        histogram.record(1000);      // ~1us
+    }
+    histogram.record(1000000);       // ~1ms
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 100u);
+    EXPECT_LE(snapshot.percentile(0.50), 1024.0);
+    EXPECT_GE(snapshot.percentile(0.50), 512.0);
+    EXPECT_GE(snapshot.percentile(1.0), 524288.0);
+}
+
+TEST_F(MonitoringAgentTest, CollectsAgentMetrics) {
+    DummyAgent agent;
+    agent.start();
+    agent.update_metric("connections_total", 42.0);
+
+    monitoring->register_agent(&agent);
+    monitoring->aggregate_now();
+
+    auto snapshot = monitoring->get_last_snapshot();
+    ASSERT_EQ(snapshot.agent_metrics.count("Dummy"), 1u);
+    EXPECT_EQ(snapshot.agent_metrics["Dummy"]["connections_total"], 42.0);
+
+    const std::string text = monitoring->render_prometheus();
+    EXPECT_NE(text.find("mmorpg_agent_metric{agent=\"Dummy\",key=\"connections_total\"} 42"), std::string::npos);
+    EXPECT_NE(monitoring->render_summary().find("Dummy.connections=42"), std::string::npos);
+
+    // 이 프로세스의 메모리는 최소 한 노드에 상주
+    ASSERT_FALSE(snapshot.numa.resident_pages.empty());
+    EXPECT_GT(snapshot.numa.resident_pages[0], 0u);
+    EXPECT_NE(text.find("mmorpg_numa_resident_pages{node=\"0\"} "), std::string::npos);
+    EXPECT_NE(text.find("mmorpg_numa_allocations_total{placement=\"remote\"} "), std::string::npos);
+
+    monitoring->unregister_agent(&agent);
+    monitoring->aggregate_now();
+    EXPECT_EQ(monitoring->get_last_snapshot().agent_metrics.count("Dummy"), 0u);
+}
+
+TEST_F(MonitoringAgentTest, ExportsClusterPeerMetrics) {
+    cluster::TransportOptions options;
+    options.node_id = "a";
+    cluster::ClusterTransport a(options);
+    options.node_id = "b";
+    cluster::ClusterTransport b(options);
+    ASSERT_TRUE(a.start());
+    ASSERT_TRUE(b.start());
+    a.add_peer("b", "127.0.0.1:" + std::to_string(b.get_port()));
+
+    a.add_message("b")->mutable_whisper()->set_text("hi");
+    uint64_t tick = 0;
+    for (int i = 0; i < 500 && a.get_peer_stats().front().batches_acked == 0; ++i) {
+        a.flush(++tick);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    monitoring->attach_cluster(&a);
+    monitoring->aggregate_now();
+
+    const auto snapshot = monitoring->get_last_snapshot();
+    ASSERT_EQ(snapshot.cluster_peers.size(), 1u);
+    EXPECT_EQ(snapshot.cluster_peers[0].node_id, "b");
+    EXPECT_TRUE(snapshot.cluster_peers[0].connected);
+    EXPECT_GT(snapshot.cluster_peers[0].sent_messages_per_second, 0.0);
+
+    const std::string text = monitoring->render_prometheus();
+    EXPECT_NE(text.find("mmorpg_cluster_peer_connected{peer=\"b\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("mmorpg_cluster_messages_total{direction=\"out\",peer=\"b\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("mmorpg_cluster_ack_latency_seconds_count{peer=\"b\"} 1"), std::string::npos);
+
+    monitoring->attach_cluster(nullptr);
+}
+
+TEST_F(MonitoringAgentTest, StartAndStop) {
+    monitoring->start();
+    EXPECT_TRUE(monitoring->is_running());
+
+    monitoring->stop();
+    EXPECT_FALSE(monitoring->is_running());
+}
+
+} // namespace mmorpg::tests
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "common/numa.hpp"
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <unistd.h>
+
+namespace mmorpg::tests {
+
+using mmorpg::common::HugePageMode;
+using mmorpg::common::HugePageRegion;
+using mmorpg::common::NumaTopology;
+
+TEST(NumaTopologyTest, EveryNodeHasCpus) {
+    const auto& topology = NumaTopology::instance();
+    ASSERT_GE(topology.node_count(), 1u);
+    for (size_t node = 0; node < topology.node_count(); ++node) {
+        EXPECT_FALSE(topology.cpus_of(node).empty()) << node;
+    }
+    EXPECT_LT(topology.current_node(), topology.node_count());
+}
+
+TEST(NumaTopologyTest, BindsThreadToNode) {
+    const auto& topology = NumaTopology::instance();
+
+    bool bound = false;
+    size_t running_on = topology.node_count();
+    std::thread worker([&]() {
+        bound = mmorpg::common::bind_thread_to_node(0);
+        running_on = topology.current_node();
+    });
+    worker.join();
+
+    EXPECT_TRUE(bound);
+    EXPECT_EQ(running_on, 0u);
+    EXPECT_FALSE(mmorpg::common::bind_thread_to_node(topology.node_count()));
+}
+
+TEST(HugePageRegionTest, RoundsUpAndFallsBack) {
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    HugePageRegion small(100, -1, HugePageMode::OFF);
+    ASSERT_NE(small.data(), nullptr);
+    EXPECT_EQ(small.size(), page_size);
+    EXPECT_EQ(small.get_backing(), HugePageMode::OFF);
+
+    HugePageRegion transparent(HugePageRegion::kHugePageSize + 1, 0, HugePageMode::TRANSPARENT);
+    ASSERT_NE(transparent.data(), nullptr);
+    EXPECT_EQ(transparent.size(), 2 * HugePageRegion::kHugePageSize);
+    std::memset(transparent.data(), 0x5A, transparent.size());
+    EXPECT_EQ(transparent.data()[transparent.size() - 1], 0x5A);
+
+    // hugetlbfs 예약 페이지가 없는 호스트에서는 THP로 대체
+    HugePageRegion explicit_pages(HugePageRegion::kHugePageSize, -1, HugePageMode::EXPLICIT);
+    ASSERT_NE(explicit_pages.data(), nullptr);
+    EXPECT_EQ(explicit_pages.size(), HugePageRegion::kHugePageSize);
+    explicit_pages.data()[0] = 1;
+
+    HugePageRegion moved(std::move(transparent));
+    EXPECT_EQ(transparent.data(), nullptr);
+    EXPECT_EQ(moved.size(), 2 * HugePageRegion::kHugePageSize);
+    EXPECT_EQ(moved.data()[0], 0x5A);
+}
+
+TEST(NumaStatsTest, CountsResidentPagesPerNode) {
+    const auto before = mmorpg::common::sample_numa_stats();
+    ASSERT_EQ(before.resident_pages.size(), NumaTopology::instance().node_count());
+
+    HugePageRegion region(8 * HugePageRegion::kHugePageSize, 0, HugePageMode::OFF);
+    std::memset(region.data(), 1, region.size());
+
+    const auto after = mmorpg::common::sample_numa_stats();
+    const auto total = [](const std::vector<uint64_t>& pages) {
+        return std::accumulate(pages.begin(), pages.end(), uint64_t{0});
+    };
+    EXPECT_GE(total(after.resident_pages), total(before.resident_pages) + region.size() / 4096 / 2);
+}
+
+} // namespace mmorpg::tests
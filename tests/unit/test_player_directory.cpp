@@ -0,0 +1,336 @@
+#include <gtest/gtest.h>
+#include "cluster/cluster_transport.hpp"
+#include "cluster/hash_ring.hpp"
+#include "cluster/player_directory.hpp"
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+using mmorpg::cluster::ClusterBatch;
+using mmorpg::cluster::ClusterTransport;
+using mmorpg::cluster::DirectoryOptions;
+using mmorpg::cluster::HashRing;
+using mmorpg::cluster::PlayerDirectory;
+using mmorpg::cluster::TransportOptions;
+
+TEST(HashRingTest, SpreadsKeysAndMovesOnlyToNewNode) {
+    HashRing ring;
+    ring.add_node("a");
+    ring.add_node("b");
+    ring.add_node("c");
+
+    constexpr uint64_t kKeys = 30000;
+    std::map<std::string, uint64_t> counts;
+    std::vector<std::string> before(kKeys);
+    for (uint64_t key = 0; key < kKeys; ++key) {
+        before[key] = *ring.owner(key);
+        ++counts[before[key]];
+    }
+    for (const auto& [node_id, count] : counts) {
+        EXPECT_GT(count, kKeys / 5) << node_id;
+        EXPECT_LT(count, kKeys / 2) << node_id;
+    }
+
+    // 노드 추가 시 키는 새 노드로만 옮겨 가고, 옮겨 가는 양은 약 1/4
+    ring.add_node("d");
+    uint64_t moved = 0;
+    for (uint64_t key = 0; key < kKeys; ++key) {
+        const auto owner = *ring.owner(key);
+        if (owner != before[key]) {
+            EXPECT_EQ(owner, "d");
+            ++moved;
+        }
+    }
+    EXPECT_GT(moved, kKeys / 6);
+    EXPECT_LT(moved, kKeys / 3);
+
+    // 제거하면 원래 소유자로 돌아감
+    EXPECT_TRUE(ring.remove_node("d"));
+    for (uint64_t key = 0; key < kKeys; ++key) {
+        ASSERT_EQ(*ring.owner(key), before[key]);
+    }
+}
+
+namespace {
+
+struct Node {
+    std::unique_ptr<ClusterTransport> transport;
+    std::unique_ptr<PlayerDirectory> directory;
+};
+
+template<typename Predicate>
+bool wait_until(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return predicate();
+}
+
+} // namespace
+
+class PlayerDirectoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (const std::string node_id : {"a", "b", "c"}) {
+            TransportOptions options;
+            options.node_id = node_id;
+            options.listen_address = "127.0.0.1:0";
+            options.reconnect_backoff = std::chrono::milliseconds(50);
+
+            Node& node = nodes[node_id];
+            node.transport = std::make_unique<ClusterTransport>(options);
+            node.directory = std::make_unique<PlayerDirectory>(*node.transport);
+            node.transport->set_batch_handler([directory = node.directory.get()](const ClusterBatch& batch) {
+                directory->on_batch(batch);
+            });
+            ASSERT_TRUE(node.transport->start());
+        }
+        for (auto& [node_id, node] : nodes) {
+            for (auto& [peer_id, peer] : nodes) {
+                if (peer_id != node_id) {
+                    node.transport->add_peer(peer_id, "127.0.0.1:" + std::to_string(peer.transport->get_port()));
+                }
+            }
+        }
+    }
+
+    void TearDown() override {
+        for (auto& [node_id, node] : nodes) {
+            node.transport->stop();
+        }
+    }
+
+    PlayerDirectory& directory(const std::string& node_id) {
+        return *nodes.at(node_id).directory;
+    }
+
+    /**
+     * @brief 링 구성 (모든 노드에 같은 멤버를 반영)
+     */
+    void join(const std::string& node_id) {
+        for (auto& [id, node] : nodes) {
+            node.directory->add_node(node_id);
+        }
+    }
+
+    /**
+     * @brief 틱 하나 진행 (디렉터리 메시지를 배치로 전송)
+     */
+    void tick() {
+        ++tick_;
+        for (auto& [node_id, node] : nodes) {
+            node.directory->poll();
+            node.transport->flush(tick_);
+        }
+    }
+
+    template<typename Predicate>
+    bool pump_until(Predicate predicate) {
+        return wait_until([&]() {
+            tick();
+            return predicate();
+        });
+    }
+
+    /**
+     * @brief owner가 소유하는 player_id 하나
+     */
+    uint64_t player_owned_by(const std::string& owner, uint64_t start = 1) {
+        uint64_t player_id = start;
+        while (directory("a").get_owner(player_id) != owner) {
+            ++player_id;
+        }
+        return player_id;
+    }
+
+    std::optional<std::string> lookup(const std::string& from, uint64_t player_id) {
+        bool done = false;
+        std::optional<std::string> result;
+        directory(from).lookup(player_id, [&](uint64_t, const std::optional<std::string>& node_id) {
+            result = node_id;
+            done = true;
+        });
+        EXPECT_TRUE(pump_until([&]() { return done; }));
+        return result;
+    }
+
+    std::map<std::string, Node> nodes;
+    uint64_t tick_ = 0;
+};
+
+TEST_F(PlayerDirectoryTest, LookupQueriesOwnerOnceThenHitsNearCache) {
+    join("a");
+    join("b");
+    join("c");
+
+    const uint64_t player_id = player_owned_by("c");
+    directory("a").on_login(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("c").locate(player_id) == "a"; }));
+
+    EXPECT_EQ(directory("b").locate(player_id), std::nullopt);
+    EXPECT_EQ(lookup("b", player_id), "a");
+    EXPECT_EQ(directory("b").get_stats().queries_sent, 1u);
+
+    // 두 번째 조회는 원격 질의 없이 캐시에서
+    EXPECT_EQ(lookup("b", player_id), "a");
+    const auto stats = directory("b").get_stats();
+    EXPECT_EQ(stats.queries_sent, 1u);
+    EXPECT_EQ(stats.cached_entries, 1u);
+    EXPECT_GE(stats.cache_hits, 1u);
+
+    // 접속하지 않은 플레이어는 소유 노드가 없다고 응답
+    EXPECT_EQ(lookup("b", player_owned_by("c", player_id + 1)), std::nullopt);
+}
+
+TEST_F(PlayerDirectoryTest, AsyncLookupResumesAwaitingCoroutine) {
+    namespace net = boost::asio;
+
+    join("a");
+    join("b");
+    join("c");
+
+    const uint64_t player_id = player_owned_by("c");
+    directory("a").on_login(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("c").locate(player_id) == "a"; }));
+
+    // 코루틴은 I/O 스레드의 strand에서 기다리고, 결과는 틱 스레드의 poll에서 그 strand로 post됨
+    net::io_context io_context;
+    auto work = net::make_work_guard(io_context);
+    std::thread io_thread([&io_context]() { io_context.run(); });
+
+    std::atomic<bool> done{false};
+    std::optional<std::string> result;
+    std::thread::id resumed_on;
+    net::co_spawn(net::make_strand(io_context),
+        [&]() -> net::awaitable<void> {
+            result = co_await directory("b").async_lookup(player_id, net::use_awaitable);
+            resumed_on = std::this_thread::get_id();
+            done = true;
+        },
+        net::detached);
+
+    EXPECT_TRUE(pump_until([&]() { return done.load(); }));
+    const auto io_thread_id = io_thread.get_id();
+    work.reset();
+    io_thread.join();
+    EXPECT_EQ(result, "a");
+    EXPECT_EQ(resumed_on, io_thread_id);
+}
+
+TEST_F(PlayerDirectoryTest, LogoutInvalidatesNearCache) {
+    join("a");
+    join("b");
+    join("c");
+
+    const uint64_t player_id = player_owned_by("c");
+    directory("a").on_login(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("c").locate(player_id) == "a"; }));
+    ASSERT_EQ(lookup("b", player_id), "a");
+
+    directory("a").on_logout(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("b").get_stats().invalidations_received == 1; }));
+    EXPECT_EQ(directory("b").locate(player_id), std::nullopt);
+    EXPECT_EQ(directory("c").get_stats().owned_entries, 0u);
+}
+
+TEST_F(PlayerDirectoryTest, CacheBudgetPressureShrinksNearCache) {
+    using mmorpg::common::MemoryCategory;
+    auto& memory = mmorpg::common::MemoryRegistry::instance();
+    const auto& cache_memory = memory.account(DirectoryOptions{}.memory_owner, MemoryCategory::CACHES);
+
+    join("a");
+    join("b");
+    join("c");
+
+    const uint64_t player_id = player_owned_by("c");
+    directory("a").on_login(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("c").locate(player_id) == "a"; }));
+
+    const size_t empty_bytes = cache_memory.get_bytes();
+    ASSERT_EQ(lookup("b", player_id), "a");
+    ASSERT_EQ(directory("b").get_stats().cached_entries, 1u);
+    const size_t cached_bytes = cache_memory.get_bytes();
+    EXPECT_GT(cached_bytes, empty_bytes);
+
+    memory.set_budget(DirectoryOptions{}.memory_owner, MemoryCategory::CACHES, 1);
+    EXPECT_EQ(memory.check_budgets(), 1u);
+    memory.set_budget(DirectoryOptions{}.memory_owner, MemoryCategory::CACHES, 0);
+
+    const auto stats = directory("b").get_stats();
+    EXPECT_EQ(stats.cached_entries, 0u);
+    EXPECT_EQ(stats.pressure_evictions, 1u);
+    EXPECT_LT(cache_memory.get_bytes(), cached_bytes);
+
+    // 캐시가 비어도 조회는 소유 노드 질의로 계속 동작
+    EXPECT_EQ(lookup("b", player_id), "a");
+}
+
+TEST_F(PlayerDirectoryTest, MigrationWinsOverLateLogout) {
+    join("a");
+    join("b");
+    join("c");
+
+    const uint64_t player_id = player_owned_by("b");
+    directory("a").on_login(player_id);
+    ASSERT_TRUE(pump_until([&]() { return directory("b").locate(player_id) == "a"; }));
+    ASSERT_EQ(lookup("c", player_id), "a");
+
+    // c로 재접속한 뒤 a의 연결 해제가 늦게 도착
+    directory("c").on_login(player_id);
+    directory("a").on_logout(player_id);
+
+    ASSERT_TRUE(pump_until([&]() { return directory("b").locate(player_id) == "c"; }));
+    for (int i = 0; i < 10; ++i) {
+        tick();
+    }
+    EXPECT_EQ(directory("b").locate(player_id), "c");
+    EXPECT_EQ(lookup("a", player_id), "c");
+}
+
+TEST_F(PlayerDirectoryTest, RingChangeMovesEntriesToNewOwner) {
+    join("a");
+    join("b");
+
+    // c가 합류하기 전 a에 접속한 플레이어들
+    std::vector<uint64_t> players;
+    for (uint64_t player_id = 1; player_id <= 64; ++player_id) {
+        directory("a").on_login(player_id);
+        players.push_back(player_id);
+    }
+    for (int i = 0; i < 5; ++i) {
+        tick();
+    }
+
+    join("c");
+    size_t owned_by_c = 0;
+    for (const uint64_t player_id : players) {
+        owned_by_c += directory("a").get_owner(player_id) == "c" ? 1 : 0;
+    }
+    ASSERT_GT(owned_by_c, 0u);
+    ASSERT_TRUE(pump_until([&]() { return directory("c").get_stats().owned_entries == owned_by_c; }));
+
+    for (const uint64_t player_id : players) {
+        ASSERT_EQ(lookup("b", player_id), "a") << player_id;
+    }
+
+    // a가 DEAD로 제거되면 a에 있던 플레이어 항목은 즉시 사라짐
+    directory("b").remove_node("a");
+    directory("c").remove_node("a");
+    EXPECT_EQ(directory("b").get_stats().owned_entries, 0u);
+    EXPECT_EQ(directory("c").get_stats().owned_entries, 0u);
+    EXPECT_EQ(directory("b").locate(players.front()), std::nullopt);
+}
+
+} // namespace mmorpg::tests
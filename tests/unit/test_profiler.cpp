@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "common/profiler.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace mmorpg::tests {
+
+using mmorpg::common::Profiler;
+using mmorpg::common::ProfileEvent;
+using mmorpg::common::ProfileRingBuffer;
+using mmorpg::common::ScopedZone;
+
+namespace {
+
+size_t count_events(const char* name) {
+    size_t count = 0;
+    for (const auto& [buffer, events] : Profiler::instance().collect(std::chrono::seconds(60))) {
+        for (const auto& event : events) {
+            if (event.name && std::string(event.name) == name) {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(ProfilerTest, ScopedZoneRecordsEvent) {
+    {
+        ScopedZone zone("test.scoped_zone", "test");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_GE(count_events("test.scoped_zone"), 1u);
+}
+
+TEST(ProfilerTest, ZonesFromMultipleThreads) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 100; ++i) {
+                ScopedZone zone("test.multi_thread", "test");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(count_events("test.multi_thread"), 400u);
+}
+
+TEST(ProfilerTest, DisabledProfilerRecordsNothing) {
+    Profiler::instance().set_enabled(false);
+    {
+        ScopedZone zone("test.disabled", "test");
+    }
+    Profiler::instance().set_enabled(true);
+
+    EXPECT_EQ(count_events("test.disabled"), 0u);
+}
+
+TEST(ProfilerTest, RingBufferKeepsMostRecentEvents) {
+    auto buffer = std::make_unique<ProfileRingBuffer>(99, "ring_test");
+    const size_t total = ProfileRingBuffer::kCapacity + 100;
+    for (size_t i = 0; i < total; ++i) {
+        buffer->push("ring", "test", i + 1, i + 2);
+    }
+
+    std::vector<ProfileEvent> events;
+    buffer->snapshot(events, 0);
+    ASSERT_EQ(events.size(), ProfileRingBuffer::kCapacity);
+    EXPECT_EQ(events.front().start_ns, 101u);
+    EXPECT_EQ(events.back().start_ns, total);
+
+    // 시간 창 필터링
+    events.clear();
+    buffer->snapshot(events, total - 8);
+    EXPECT_EQ(events.size(), 10u);
+}
+
+TEST(ProfilerTest, TickOverrunIsCounted) {
+    const uint64_t before = Profiler::instance().get_overrun_count();
+
+    uint64_t start = Profiler::now_ns();
+    EXPECT_FALSE(Profiler::instance().end_tick(start, std::chrono::seconds(10)));
+
+    start = Profiler::now_ns();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_TRUE(Profiler::instance().end_tick(start, std::chrono::microseconds(100)));
+
+    EXPECT_EQ(Profiler::instance().get_overrun_count(), before + 1);
+}
+
+TEST(ProfilerTest, DumpChromeTrace) {
+    {
+        ScopedZone zone("test.dump \"quoted\"", "test");
+    }
+
+    const std::string path = "test_profiler_trace.json";
+    size_t count = Profiler::instance().dump_chrome_trace(path, std::chrono::seconds(60));
+    EXPECT_GE(count, 1u);
+
+    std::ifstream in(path);
+    ASSERT_TRUE(in.is_open());
+    std::stringstream content;
+    content << in.rdbuf();
+
+    const std::string json = content.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("test.dump \\\"quoted\\\""), std::string::npos);
+
+    std::remove(path.c_str());
+}
+
+} // namespace mmorpg::tests
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "protocol/game_protocol.hpp"
+#include <string>
+#include <vector>
+
+namespace mmorpg::tests {
+
+namespace protocol = mmorpg::protocol;
+using protocol::DispatchResult;
+
+namespace {
+
+/**
+ * @brief 디스패치된 메시지를 기록하는 테스트 핸들러 (Heartbeat, MoveInput, ChatSend만 처리)
+ */
+struct RecordingHandler {
+    void handle(const protocol::HeartbeatView& heartbeat, const std::string& connection_id) {
+        calls.push_back("heartbeat:" + connection_id + ":" + std::to_string(heartbeat.client_time_ms()));
+    }
+
+    void handle(const protocol::MoveInputView& move, const std::string& connection_id) {
+        calls.push_back("move:" + connection_id + ":" + std::to_string(move.sequence()));
+        last_position = move.position();
+    }
+
+    void handle(const protocol::ChatSendView& chat, const std::string&) {
+        calls.push_back("chat:" + std::string(chat.text()));
+    }
+
+    std::vector<std::string> calls;
+    protocol::Vec3 last_position;
+};
+
+} // namespace
+
+TEST(ProtocolTest, FixedSizeRoundTrip) {
+    protocol::MoveInput move;
+    move.sequence = 42;
+    move.position = {1.5f, -2.25f, 100.0f};
+    move.yaw = 3.0f;
+
+    const std::string frame = protocol::wire::encode(move);
+    ASSERT_EQ(frame.size(), move.encoded_size());
+    EXPECT_EQ(frame.size(), protocol::wire::kHeaderSize + protocol::MoveInput::kFixedSize);
+
+    // 바이트 배치: opcode(LE) 다음 sequence(LE)
+    EXPECT_EQ(static_cast<uint8_t>(frame[0]), 0x10);
+    EXPECT_EQ(static_cast<uint8_t>(frame[1]), 0x00);
+    EXPECT_EQ(static_cast<uint8_t>(frame[2]), 42);
+
+    protocol::MoveInputView view;
+    ASSERT_TRUE(view.bind_frame(frame));
+    EXPECT_EQ(view.sequence(), 42u);
+    EXPECT_EQ(view.position(), move.position);
+    EXPECT_FLOAT_EQ(view.yaw(), 3.0f);
+}
+
+TEST(ProtocolTest, VariableSizeViewPointsIntoFrame) {
+    protocol::ChatBroadcast chat;
+    chat.channel = 2;
+    chat.sender_id = 0x0102030405060708ull;
+    chat.sender_name = "knight";
+    chat.text = "hello guild";
+
+    std::string frame;
+    protocol::wire::append(frame, chat);
+    ASSERT_EQ(frame.size(), chat.encoded_size());
+
+    protocol::ChatBroadcastView view;
+    ASSERT_TRUE(view.bind_frame(frame));
+    EXPECT_EQ(view.channel(), 2u);
+    EXPECT_EQ(view.sender_id(), 0x0102030405060708ull);
+    EXPECT_EQ(view.sender_name(), "knight");
+    EXPECT_EQ(view.text(), "hello guild");
+
+    // 복사 없이 프레임 버퍼를 가리킴
+    EXPECT_GE(view.text().data(), frame.data());
+    EXPECT_LT(view.text().data(), frame.data() + frame.size());
+
+    const auto message = view.to_message();
+    EXPECT_EQ(message.sender_name, "knight");
+}
+
+TEST(ProtocolTest, AppendEncodesSeveralMessagesIntoOneBuffer) {
+    protocol::EntityMoved first;
+    first.entity_id = 1;
+    protocol::EntityMoved second;
+    second.entity_id = 2;
+
+    std::string buffer;
+    protocol::wire::append(buffer, first);
+    protocol::wire::append(buffer, second);
+    ASSERT_EQ(buffer.size(), first.encoded_size() * 2);
+
+    protocol::EntityMovedView view;
+    ASSERT_TRUE(view.bind_frame(std::string_view(buffer).substr(first.encoded_size())));
+    EXPECT_EQ(view.entity_id(), 2u);
+}
+
+TEST(ProtocolTest, RejectsTruncatedAndOversizedFrames) {
+    protocol::ChatSend chat;
+    chat.channel = 0;
+    chat.target = "";
+    chat.text = "hi";
+    const std::string frame = protocol::wire::encode(chat);
+
+    protocol::ChatSendView view;
+    for (size_t size = 0; size < frame.size(); ++size) {
+        EXPECT_FALSE(view.bind_frame(std::string_view(frame).substr(0, size))) << "size " << size;
+    }
+    EXPECT_TRUE(view.bind_frame(frame));
+    EXPECT_FALSE(view.bind_frame(frame + "x"));
+
+    // 길이 접두사가 프레임 밖을 가리키는 경우
+    std::string corrupted = frame;
+    corrupted[protocol::wire::kHeaderSize + protocol::ChatSend::kFixedSize + 2] = '\x7f';
+    EXPECT_FALSE(view.bind_frame(corrupted));
+
+    // 고정 길이 메시지는 정확한 길이만 허용
+    const std::string heartbeat = protocol::wire::encode(protocol::Heartbeat{});
+    protocol::HeartbeatView heartbeat_view;
+    EXPECT_FALSE(heartbeat_view.bind_frame(heartbeat + '\0'));
+    EXPECT_FALSE(heartbeat_view.bind_frame(heartbeat.substr(0, heartbeat.size() - 1)));
+
+    // 다른 opcode
+    EXPECT_FALSE(heartbeat_view.bind_frame(frame));
+}
+
+TEST(ProtocolTest, DispatchRoutesByOpcode) {
+    RecordingHandler handler;
+    const std::string connection_id = "conn_1";
+
+    protocol::Heartbeat heartbeat;
+    heartbeat.client_time_ms = 7;
+    EXPECT_EQ(protocol::dispatch(protocol::wire::encode(heartbeat), handler, connection_id), DispatchResult::OK);
+
+    protocol::MoveInput move;
+    move.sequence = 3;
+    move.position = {4.0f, 5.0f, 6.0f};
+    EXPECT_EQ(protocol::dispatch(protocol::wire::encode(move), handler, connection_id), DispatchResult::OK);
+
+    protocol::ChatSend chat;
+    chat.text = "gg";
+    EXPECT_EQ(protocol::dispatch(protocol::wire::encode(chat), handler, connection_id), DispatchResult::OK);
+
+    ASSERT_EQ(handler.calls.size(), 3u);
+    EXPECT_EQ(handler.calls[0], "heartbeat:conn_1:7");
+    EXPECT_EQ(handler.calls[1], "move:conn_1:3");
+    EXPECT_EQ(handler.calls[2], "chat:gg");
+    EXPECT_EQ(handler.last_position, move.position);
+}
+
+TEST(ProtocolTest, DispatchReportsRejectedFrames) {
+    RecordingHandler handler;
+    const std::string connection_id = "conn_1";
+
+    // 핸들러 오버로드 없음
+    EXPECT_EQ(protocol::dispatch(protocol::wire::encode(protocol::AttackRequest{}), handler, connection_id),
+              DispatchResult::UNHANDLED);
+
+    // 스키마에 없는 opcode
+    const std::string unknown("\xff\x7f\x00\x00", 4);
+    EXPECT_EQ(protocol::dispatch(unknown, handler, connection_id), DispatchResult::UNKNOWN_OPCODE);
+
+    // 헤더 부족 / 본문 길이 불일치
+    EXPECT_EQ(protocol::dispatch(std::string_view("\x01", 1), handler, connection_id), DispatchResult::MALFORMED);
+    std::string short_move = protocol::wire::encode(protocol::MoveInput{});
+    short_move.pop_back();
+    EXPECT_EQ(protocol::dispatch(short_move, handler, connection_id), DispatchResult::MALFORMED);
+
+    EXPECT_TRUE(handler.calls.empty());
+}
+
+TEST(ProtocolTest, MessageMetadataMatchesCodecs) {
+    for (const auto& info : protocol::kMessages) {
+        EXPECT_EQ(protocol::find_message(info.opcode), &info);
+    }
+    EXPECT_EQ(protocol::find_message(0x7fff), nullptr);
+
+    const auto* login = protocol::find_message(static_cast<uint16_t>(protocol::Opcode::LOGIN_REQUEST));
+    ASSERT_NE(login, nullptr);
+    EXPECT_STREQ(login->name, "LoginRequest");
+    EXPECT_TRUE(login->variable_size);
+    EXPECT_EQ(login->min_frame_size, protocol::wire::encode(protocol::LoginRequest{}).size());
+}
+
+} // namespace mmorpg::tests
@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+#include "agents/connection_manager/connection_manager.hpp"
+#include "agents/connection_manager/session_migrator.hpp"
+#include "cluster/cluster_transport.hpp"
+#include "common/logger.hpp"
+#include "network/websocket_handler.hpp"
+#include "protocol/game_protocol.hpp"
+#include <boost/beast.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+namespace beast = boost::beast;
+namespace net = boost::asio;
+
+using mmorpg::agents::connection_manager::ConnectionManagerAgent;
+using mmorpg::agents::connection_manager::SessionMigrator;
+using mmorpg::cluster::ClusterBatch;
+using mmorpg::cluster::ClusterTransport;
+using mmorpg::cluster::TransportOptions;
+
+namespace {
+
+using Client = beast::websocket::stream<net::ip::tcp::socket>;
+
+void connect(Client& client, uint16_t port) {
+    client.next_layer().connect(net::ip::tcp::endpoint(net::ip::address_v4::loopback(), port));
+    client.handshake("127.0.0.1", "/");
+}
+
+std::string read_frame(Client& client) {
+    beast::flat_buffer buffer;
+    client.read(buffer);
+    return beast::buffers_to_string(buffer.cdata());
+}
+
+/**
+ * @brief 연결 관리자에 접속 후 하트비트 왕복 (서버 쪽 핸드셰이크 완료 보장)
+ */
+void connect_established(Client& client, uint16_t port) {
+    connect(client, port);
+    protocol::Heartbeat heartbeat;
+    client.binary(true);
+    client.write(net::buffer(protocol::wire::encode(heartbeat)));
+    read_frame(client);
+}
+
+template<typename Predicate>
+bool wait_until(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return predicate();
+}
+
+} // namespace
+
+TEST(WebSocketDetachTest, HandsOverUnsentFramesInOrderAndSendsFinalFrameLast) {
+    mmorpg::common::Logger::initialize("test.log");
+
+    network::WebSocketHandler handler(0, 1);
+    std::atomic<bool> ready{false};
+    handler.set_message_handler([&](const std::string&, std::string_view, bool) { ready = true; });
+    handler.start();
+
+    // 첫 수신은 서버 쪽 핸드셰이크 완료 이후이므로 그 뒤에 보낸 프레임은 버려지지 않음
+    net::io_context io_context;
+    Client client(io_context);
+    connect(client, handler.get_port());
+    client.write(net::buffer(std::string("ready")));
+    ASSERT_TRUE(wait_until([&]() { return ready.load(); }));
+
+    constexpr int kFrames = 2000;
+    for (int i = 0; i < kFrames; ++i) {
+        handler.send_to_connection("conn_1", "m" + std::to_string(i));
+    }
+
+    std::atomic<bool> detached{false};
+    std::vector<common::PendingFrame> pending;
+    ASSERT_TRUE(handler.detach_connection("conn_1", "redirect", true,
+                                          [&](std::vector<common::PendingFrame> frames) {
+                                              pending = std::move(frames);
+                                              detached = true;
+                                          }));
+    EXPECT_FALSE(handler.detach_connection("conn_404", "redirect", true, [](auto) {}));
+
+    // 클라이언트가 받은 프레임 + 넘겨받은 프레임 = 보낸 프레임 전체 (순서 유지, 중복 없음)
+    std::vector<std::string> received;
+    std::string frame;
+    while ((frame = read_frame(client)) != "redirect") {
+        received.push_back(frame);
+    }
+    EXPECT_TRUE(client.got_binary());
+    ASSERT_TRUE(wait_until([&]() { return detached.load(); }));
+
+    for (const auto& pending_frame : pending) {
+        EXPECT_FALSE(pending_frame.binary);
+        received.push_back(pending_frame.payload);
+    }
+    ASSERT_EQ(received.size(), static_cast<size_t>(kFrames));
+    for (int i = 0; i < kFrames; ++i) {
+        ASSERT_EQ(received[i], "m" + std::to_string(i));
+    }
+
+    // 마지막 프레임 뒤 서버가 연결을 닫음
+    beast::flat_buffer buffer;
+    beast::error_code ec;
+    client.read(buffer, ec);
+    EXPECT_EQ(ec, beast::websocket::error::closed);
+
+    handler.stop();
+}
+
+class SessionMigrationTest : public ::testing::Test {
+protected:
+    struct Node {
+        std::unique_ptr<ConnectionManagerAgent> connection_manager;
+        std::unique_ptr<ClusterTransport> transport;
+        std::unique_ptr<SessionMigrator> migrator;
+    };
+
+    void SetUp() override {
+        mmorpg::common::Logger::initialize("test.log");
+
+        for (auto* node : {&a, &b}) {
+            TransportOptions options;
+            options.node_id = node == &a ? "a" : "b";
+            options.listen_address = "127.0.0.1:0";
+
+            node->connection_manager = std::make_unique<ConnectionManagerAgent>(100, 0, 1);
+            node->transport = std::make_unique<ClusterTransport>(options);
+            node->migrator = std::make_unique<SessionMigrator>(*node->connection_manager, *node->transport);
+            node->transport->set_batch_handler([migrator = node->migrator.get()](const ClusterBatch& batch) {
+                migrator->on_batch(batch);
+            });
+            ASSERT_TRUE(node->transport->start());
+            node->connection_manager->start();
+        }
+        a.transport->add_peer("b", "127.0.0.1:" + std::to_string(b.transport->get_port()));
+        b.transport->add_peer("a", "127.0.0.1:" + std::to_string(a.transport->get_port()));
+
+        // 가십 멤버십이 하는 일: 대상 노드의 클라이언트 접속 주소 등록
+        a.connection_manager->get_load_balancer().add_server(
+            "b", "127.0.0.1", b.connection_manager->get_websocket_handler().get_port());
+
+        // 틱 스레드 (5ms)
+        ticking = true;
+        ticker = std::thread([this]() {
+            uint64_t tick = 0;
+            while (ticking) {
+                ++tick;
+                for (auto* node : {&a, &b}) {
+                    node->migrator->poll();
+                    node->transport->flush(tick);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        });
+    }
+
+    void TearDown() override {
+        ticking = false;
+        ticker.join();
+        for (auto* node : {&a, &b}) {
+            node->connection_manager->stop();
+            node->transport->stop();
+        }
+    }
+
+    Node a;
+    Node b;
+    std::atomic<bool> ticking{false};
+    std::thread ticker;
+};
+
+TEST_F(SessionMigrationTest, ClientResumesOnTargetNodeWithinBudget) {
+    net::io_context io_context;
+    Client client(io_context);
+    connect_established(client, a.connection_manager->get_websocket_handler().get_port());
+    ASSERT_TRUE(wait_until([&]() { return a.connection_manager->get_websocket_handler().has_connection("conn_1"); }));
+    ASSERT_TRUE(a.connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+
+    // 인증되지 않은 연결이나 모르는 노드로는 이전하지 않음
+    EXPECT_FALSE(a.migrator->migrate("conn_1", "b"));
+    a.connection_manager->authenticate_connection("conn_1", "1001");
+    EXPECT_FALSE(a.migrator->migrate("conn_1", "c"));
+
+    const auto started_at = std::chrono::steady_clock::now();
+    ASSERT_TRUE(a.migrator->migrate("conn_1", "b"));
+
+    const std::string redirect_frame = read_frame(client);
+    protocol::MigrateRedirectView redirect;
+    ASSERT_TRUE(redirect.bind_frame(redirect_frame));
+    EXPECT_EQ(redirect.host(), "127.0.0.1");
+    EXPECT_EQ(redirect.port(), b.connection_manager->get_websocket_handler().get_port());
+    EXPECT_EQ(redirect.token().size(), 32u);
+
+    // 새 노드로 재접속 후 토큰 제출
+    Client resumed(io_context);
+    connect_established(resumed, redirect.port());
+    ASSERT_TRUE(wait_until([&]() { return b.connection_manager->get_websocket_handler().has_connection("conn_1"); }));
+    ASSERT_TRUE(b.connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+
+    protocol::ResumeRequest request;
+    request.token = redirect.token();
+    resumed.binary(true);
+    resumed.write(net::buffer(protocol::wire::encode(request)));
+
+    const std::string response_frame = read_frame(resumed);
+    const auto downtime = std::chrono::steady_clock::now() - started_at;
+
+    protocol::ResumeResponseView response;
+    ASSERT_TRUE(response.bind_frame(response_frame));
+    EXPECT_EQ(response.result(), 0);
+    EXPECT_EQ(response.user_id(), "1001");
+    EXPECT_LT(downtime, std::chrono::milliseconds(100));
+
+    const auto info = b.connection_manager->get_connection_info("conn_1");
+    ASSERT_TRUE(info.has_value());
+    EXPECT_TRUE(info->is_authenticated);
+    EXPECT_EQ(info->user_id, "1001");
+    EXPECT_EQ(a.migrator->get_stats().sent, 1u);
+    EXPECT_EQ(b.migrator->get_stats().received, 1u);
+
+    beast::error_code ec;
+    resumed.close(beast::websocket::close_code::normal, ec);
+}
+
+TEST_F(SessionMigrationTest, ResumeRequestWaitsForLateHandoff) {
+    net::io_context io_context;
+    Client client(io_context);
+    connect_established(client, b.connection_manager->get_websocket_handler().get_port());
+    ASSERT_TRUE(wait_until([&]() { return b.connection_manager->get_websocket_handler().has_connection("conn_1"); }));
+    ASSERT_TRUE(b.connection_manager->handle_new_connection("conn_1", "127.0.0.1"));
+
+    std::string resumed_connection;
+    b.connection_manager->set_resume_listener(
+        [&](const std::string& connection_id, const common::SessionHandoff& handoff) {
+            resumed_connection = connection_id + "/" + handoff.state;
+        });
+
+    // 노드 간 전송보다 클라이언트가 먼저 도착
+    protocol::ResumeRequest request;
+    request.token = "token-1";
+    client.binary(true);
+    client.write(net::buffer(protocol::wire::encode(request)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    common::SessionHandoff handoff;
+    handoff.token = "token-1";
+    handoff.user_id = "2002";
+    handoff.state = "hp=10";
+    handoff.pending_frames.push_back({"queued-1", false});
+    handoff.pending_frames.push_back({"queued-2", false});
+    b.connection_manager->accept_handoff(std::move(handoff));
+
+    protocol::ResumeResponseView response;
+    const std::string response_frame = read_frame(client);
+    ASSERT_TRUE(response.bind_frame(response_frame));
+    EXPECT_EQ(response.result(), 0);
+    EXPECT_EQ(response.user_id(), "2002");
+
+    // 이전 노드가 보내지 못한 프레임이 재개 응답 뒤에 순서대로
+    EXPECT_EQ(read_frame(client), "queued-1");
+    EXPECT_EQ(read_frame(client), "queued-2");
+    EXPECT_EQ(resumed_connection, "conn_1/hp=10");
+
+    beast::error_code ec;
+    client.close(beast::websocket::close_code::normal, ec);
+}
+
+} // namespace mmorpg::tests
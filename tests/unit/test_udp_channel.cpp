@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+#include "network/udp_channel.hpp"
+#include "common/logger.hpp"
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mmorpg::tests {
+
+namespace net = boost::asio;
+using udp = net::ip::udp;
+
+using mmorpg::network::UdpChannel;
+using mmorpg::network::UdpChannelOptions;
+using mmorpg::network::UdpPacketHeader;
+using mmorpg::network::UdpPacketType;
+
+/**
+ * @brief 헤더를 직접 만들어 보내는 시험용 UDP 클라이언트
+ */
+class RawClient {
+public:
+    explicit RawClient(uint16_t server_port)
+        : socket_(io_context_, udp::endpoint(net::ip::address_v4::loopback(), 0))
+        , server_(net::ip::address_v4::loopback(), server_port) {
+        socket_.non_blocking(true);
+    }
+
+    void send(UdpPacketType type, uint64_t token, uint32_t sequence, uint16_t lane = 0,
+              const std::string& payload = {}, bool reliable = false) {
+        UdpPacketHeader header;
+        header.token = token;
+        header.type = type;
+        header.flags = reliable ? UdpPacketHeader::kReliable : 0;
+        header.lane = lane;
+        header.sequence = sequence;
+
+        std::string packet(UdpPacketHeader::kSize, '\0');
+        header.encode(packet.data());
+        packet += payload;
+        socket_.send_to(net::buffer(packet), server_);
+    }
+
+    struct Packet {
+        UdpPacketHeader header;
+        std::string payload;
+    };
+
+    std::optional<Packet> receive(std::chrono::milliseconds timeout = std::chrono::milliseconds(500)) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        std::array<char, 2048> buffer{};
+        while (std::chrono::steady_clock::now() < deadline) {
+            udp::endpoint from;
+            boost::system::error_code ec;
+            const size_t bytes = socket_.receive_from(net::buffer(buffer), from, 0, ec);
+            if (!ec) {
+                const std::string_view packet(buffer.data(), bytes);
+                if (auto header = UdpPacketHeader::decode(packet)) {
+                    return Packet{*header, std::string(packet.substr(UdpPacketHeader::kSize))};
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief BIND_ACK를 받을 때까지 BIND 재시도 (손실 시뮬레이션 중에도 바인드)
+     */
+    bool bind(uint64_t token) {
+        for (int attempt = 0; attempt < 50; ++attempt) {
+            send(UdpPacketType::BIND, token, 0);
+            if (auto reply = receive(std::chrono::milliseconds(50))) {
+                if (reply->header.type == UdpPacketType::BIND_ACK && reply->header.token == token) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    net::io_context io_context_;
+    udp::socket socket_;
+    udp::endpoint server_;
+};
+
+class UdpChannelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mmorpg::common::Logger::initialize("test.log");
+    }
+
+    void start(UdpChannelOptions options = {}) {
+        options.bind_address = "127.0.0.1:0";
+        channel = std::make_unique<UdpChannel>(options);
+        channel->set_receive_handler([this](const std::string& connection_id, uint16_t lane, std::string_view payload) {
+            std::lock_guard<std::mutex> lock(mutex);
+            received.push_back(connection_id + "/" + std::to_string(lane) + "/" + std::string(payload));
+        });
+        ASSERT_TRUE(channel->start());
+        ASSERT_NE(channel->get_port(), 0);
+    }
+
+    std::vector<std::string> wait_received(size_t count) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (received.size() >= count) {
+                    return received;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return received;
+    }
+
+    std::unique_ptr<UdpChannel> channel;
+    std::mutex mutex;
+    std::vector<std::string> received;
+};
+
+TEST(UdpPacketHeaderTest, RoundTripsAndRejectsShortPackets) {
+    UdpPacketHeader header;
+    header.token = 0x0102030405060708ULL;
+    header.type = UdpPacketType::ACK;
+    header.flags = UdpPacketHeader::kReliable;
+    header.lane = 0xBEEF;
+    header.sequence = 0xFFFFFFF0u;
+
+    char bytes[UdpPacketHeader::kSize];
+    header.encode(bytes);
+    EXPECT_EQ(bytes[0], 0x08);
+
+    const auto decoded = UdpPacketHeader::decode(std::string_view(bytes, sizeof(bytes)));
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(decoded->token, header.token);
+    EXPECT_EQ(decoded->type, UdpPacketType::ACK);
+    EXPECT_TRUE(decoded->reliable());
+    EXPECT_EQ(decoded->lane, 0xBEEF);
+    EXPECT_EQ(decoded->sequence, 0xFFFFFFF0u);
+
+    EXPECT_FALSE(UdpPacketHeader::decode(std::string_view(bytes, sizeof(bytes) - 1)));
+    bytes[8] = 9;
+    EXPECT_FALSE(UdpPacketHeader::decode(std::string_view(bytes, sizeof(bytes))));
+
+    EXPECT_TRUE(mmorpg::network::sequence_newer(2, 0xFFFFFFFFu));
+    EXPECT_FALSE(mmorpg::network::sequence_newer(0xFFFFFFFFu, 2));
+}
+
+TEST_F(UdpChannelTest, BindRequiresIssuedTokenFromBoundEndpoint) {
+    start();
+    const uint64_t token = channel->open_session("conn_1");
+    RawClient client(channel->get_port());
+    RawClient intruder(channel->get_port());
+
+    // 바인드 전 DATA와 모르는 토큰은 거부
+    client.send(UdpPacketType::DATA, token, 1, 0, "early");
+    client.send(UdpPacketType::BIND, token + 1, 0);
+    EXPECT_FALSE(client.receive(std::chrono::milliseconds(100)));
+    EXPECT_FALSE(channel->send("conn_1", 0, "not yet"));
+
+    ASSERT_TRUE(client.bind(token));
+    EXPECT_TRUE(channel->is_bound("conn_1"));
+
+    // 토큰을 알아도 바인드한 엔드포인트가 아니면 거부
+    intruder.send(UdpPacketType::DATA, token, 2, 0, "spoofed");
+    client.send(UdpPacketType::DATA, token, 3, 7, "move");
+    EXPECT_EQ(wait_received(1), std::vector<std::string>{"conn_1/7/move"});
+
+    ASSERT_TRUE(channel->send("conn_1", 4, "snapshot"));
+    const auto packet = client.receive();
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(packet->header.type, UdpPacketType::DATA);
+    EXPECT_EQ(packet->header.token, token);
+    EXPECT_EQ(packet->header.lane, 4);
+    EXPECT_EQ(packet->payload, "snapshot");
+    EXPECT_FALSE(channel->send("conn_1", 0, std::string(UdpChannel::kMaxPayloadSize + 1, 'x')));
+
+    // 세션을 닫으면 토큰도 무효
+    channel->close_session("conn_1");
+    client.send(UdpPacketType::DATA, token, 5, 7, "late");
+    EXPECT_FALSE(client.receive(std::chrono::milliseconds(100)));
+    EXPECT_EQ(channel->get_session_count(), 0u);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(received.size(), 1u);
+    }
+    EXPECT_GE(channel->get_stats().rejected, 4u);
+}
+
+TEST_F(UdpChannelTest, UnreliableDataIsLatestWinsPerLane) {
+    start();
+    const uint64_t token = channel->open_session("conn_1");
+    RawClient client(channel->get_port());
+    ASSERT_TRUE(client.bind(token));
+
+    client.send(UdpPacketType::DATA, token, 5, 1, "a5");
+    client.send(UdpPacketType::DATA, token, 3, 1, "a3");   // 늦게 도착한 오래된 위치
+    client.send(UdpPacketType::DATA, token, 4, 2, "b4");   // lane이 다르면 독립
+    client.send(UdpPacketType::DATA, token, 6, 1, "a6");
+    client.send(UdpPacketType::DATA, token, 0xFFFFFFFFu, 3, "c_max");
+    client.send(UdpPacketType::DATA, token, 1, 3, "c_wrapped");
+
+    const std::vector<std::string> expected{"conn_1/1/a5", "conn_1/2/b4", "conn_1/1/a6",
+                                            "conn_1/3/c_max", "conn_1/3/c_wrapped"};
+    EXPECT_EQ(wait_received(expected.size()), expected);
+    EXPECT_EQ(channel->get_stats().stale_dropped, 1u);
+}
+
+TEST_F(UdpChannelTest, ReliableDataIsAckedOnceDeliveredOnce) {
+    start();
+    const uint64_t token = channel->open_session("conn_1");
+    RawClient client(channel->get_port());
+    ASSERT_TRUE(client.bind(token));
+
+    client.send(UdpPacketType::DATA, token, 1, 0, "r1", true);
+    client.send(UdpPacketType::DATA, token, 1, 0, "r1", true);   // ACK 유실 후 재전송
+    client.send(UdpPacketType::DATA, token, 3, 0, "r3", true);
+    client.send(UdpPacketType::DATA, token, 2, 0, "r2", true);   // 순서가 바뀌어도 전달
+
+    std::vector<uint32_t> acks;
+    while (auto packet = client.receive(std::chrono::milliseconds(200))) {
+        ASSERT_EQ(packet->header.type, UdpPacketType::ACK);
+        acks.push_back(packet->header.sequence);
+    }
+    EXPECT_EQ(acks, (std::vector<uint32_t>{1, 1, 3, 2}));
+
+    const std::vector<std::string> expected{"conn_1/0/r1", "conn_1/0/r3", "conn_1/0/r2"};
+    EXPECT_EQ(wait_received(expected.size()), expected);
+    EXPECT_EQ(channel->get_stats().duplicates_dropped, 1u);
+}
+
+TEST_F(UdpChannelTest, ReliableDeliverySurvivesSimulatedLoss) {
+    UdpChannelOptions options;
+    options.loss_rate = 0.3;
+    options.loss_seed = 42;
+    options.resend_interval = std::chrono::milliseconds(10);
+    options.max_resends = 50;
+    start(options);
+
+    const uint64_t token = channel->open_session("conn_1");
+    RawClient client(channel->get_port());
+    ASSERT_TRUE(client.bind(token));
+
+    constexpr size_t kMessages = 50;
+    for (size_t i = 0; i < kMessages; ++i) {
+        ASSERT_TRUE(channel->send("conn_1", 0, "event_" + std::to_string(i), true));
+    }
+
+    // 받은 신뢰 DATA마다 ACK (ACK도 서버 수신 쪽에서 손실될 수 있음)
+    std::set<std::string> delivered;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (delivered.size() < kMessages && std::chrono::steady_clock::now() < deadline) {
+        auto packet = client.receive(std::chrono::milliseconds(50));
+        if (!packet || packet->header.type != UdpPacketType::DATA) {
+            continue;
+        }
+        EXPECT_TRUE(packet->header.reliable());
+        delivered.insert(packet->payload);
+        client.send(UdpPacketType::ACK, token, packet->header.sequence);
+    }
+
+    EXPECT_EQ(delivered.size(), kMessages);
+    const auto stats = channel->get_stats();
+    EXPECT_GT(stats.simulated_losses, 0u);
+    EXPECT_GT(stats.resends, 0u);
+    EXPECT_EQ(stats.reliable_expired, 0u);
+}
+
+} // namespace mmorpg::tests
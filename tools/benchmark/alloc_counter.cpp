@@ -0,0 +1,71 @@
+#include "alloc_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local uint64_t g_thread_allocations = 0;
+std::atomic<uint64_t> g_process_allocations{0};
+
+void count_allocation() noexcept {
+    ++g_thread_allocations;
+    g_process_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* counted_allocate(std::size_t size) {
+    count_allocation();
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+namespace mmorpg::tools::benchmark {
+
+uint64_t thread_allocation_count() noexcept {
+    return g_thread_allocations;
+}
+
+uint64_t process_allocation_count() noexcept {
+    return g_process_allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace mmorpg::tools::benchmark
+
+// 정렬 지정 new는 기본 구현을 그대로 사용 (벤치마크 대상 코드는 쓰지 않음)
+void* operator new(std::size_t size) {
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return counted_allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    count_allocation();
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    count_allocation();
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mmorpg::tools::benchmark {
+
+/**
+ * @brief 현재 스레드의 누적 힙 할당 횟수 (전역 operator new 교체로 집계)
+ *
+ * 카운터는 thread_local이라 다른 벤치마크 스레드와 경합하지 않습니다.
+ */
+uint64_t thread_allocation_count() noexcept;
+
+/**
+ * @brief 프로세스 전체 누적 힙 할당 횟수 (I/O 스레드처럼 벤치마크 스레드 밖의 할당 포함)
+ */
+uint64_t process_allocation_count() noexcept;
+
+/**
+ * @brief 구간 동안의 힙 할당 횟수 측정
+ */
+class AllocationScope {
+public:
+    AllocationScope() noexcept
+        : start_(thread_allocation_count()) {
+    }
+
+    uint64_t count() const noexcept {
+        return thread_allocation_count() - start_;
+    }
+
+private:
+    uint64_t start_;
+};
+
+} // namespace mmorpg::tools::benchmark
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include "common/base_agent.hpp"
+#include <memory>
+#include <string>
+
+namespace {
+
+class BenchAgent : public mmorpg::common::BaseAgent {
+public:
+    BenchAgent() : BaseAgent("Bench") {}
+    void start() override {}
+    void stop() override {}
+};
+
+std::unique_ptr<BenchAgent> g_agent;
+
+// 핫 패스에서 흔한 패턴: 고정 키 메트릭 갱신 (스레드 수별 경합)
+void BM_BaseAgentUpdateMetric(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_agent = std::make_unique<BenchAgent>();
+    }
+
+    const std::string key = "metric_" + std::to_string(state.thread_index() % 4);
+    double value = 0.0;
+    for (auto _ : state) {
+        g_agent->update_metric(key, value);
+        value += 1.0;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        g_agent.reset();
+    }
+}
+
+BENCHMARK(BM_BaseAgentUpdateMetric)->ThreadRange(1, 16)->UseRealTime();
+
+void BM_BaseAgentGetMetric(benchmark::State& state) {
+    BenchAgent agent;
+    for (int i = 0; i < 32; ++i) {
+        agent.update_metric("metric_" + std::to_string(i), i);
+    }
+
+    const std::string key = "metric_17";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(agent.get_metric(key));
+    }
+}
+
+BENCHMARK(BM_BaseAgentGetMetric);
+
+} // namespace
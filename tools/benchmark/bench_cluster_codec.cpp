@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include "alloc_counter.hpp"
+#include "cluster/cluster_codec.hpp"
+#include <string>
+#include <string_view>
+
+namespace {
+
+using mmorpg::cluster::ClusterBatch;
+using mmorpg::cluster::ClusterBatchWriter;
+using mmorpg::cluster::ClusterMessage;
+using mmorpg::cluster::MessageArena;
+using mmorpg::common::BufferPool;
+using mmorpg::tools::benchmark::AllocationScope;
+
+// 클라이언트 프레임 뷰에서 전달받는 문자열과 같은 형태
+constexpr std::string_view kSenderName = "adventurer_with_long_name";
+constexpr std::string_view kText = "are you coming to the dungeon tonight? we need a healer";
+
+void fill_whisper(ClusterMessage* message, uint64_t i) {
+    auto* whisper = message->mutable_whisper();
+    whisper->set_sender_id(i);
+    whisper->set_target_id(i + 1000);
+    whisper->mutable_sender_name()->assign(kSenderName);
+    whisper->mutable_text()->assign(kText);
+}
+
+std::string make_batch_frame(int64_t messages) {
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+    for (int64_t i = 0; i < messages; ++i) {
+        fill_whisper(writer.add_message(), static_cast<uint64_t>(i));
+    }
+    return *writer.flush(1, pool);
+}
+
+void report(benchmark::State& state, const AllocationScope& allocations) {
+    const double messages = static_cast<double>(state.iterations()) * static_cast<double>(state.range(0));
+    state.counters["allocs_per_msg"] = static_cast<double>(allocations.count()) / messages;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 기준선: 배치마다 힙에 메시지 트리를 만들고 파싱 (메시지/문자열마다 할당)
+void BM_ClusterDecodeHeap(benchmark::State& state) {
+    const std::string frame = make_batch_frame(state.range(0));
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        ClusterBatch batch;
+        const bool ok = batch.ParseFromArray(frame.data(), static_cast<int>(frame.size()));
+        benchmark::DoNotOptimize(ok);
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK(BM_ClusterDecodeHeap)->ArgName("messages")->Arg(1)->Arg(32)->Arg(256);
+
+// 배치 Arena에 파싱 후 리셋 (정상 상태 할당 0)
+void BM_ClusterDecodeArena(benchmark::State& state) {
+    const std::string frame = make_batch_frame(state.range(0));
+    MessageArena arena;
+
+    // 첫 배치에서 Arena 크기를 맞춘 뒤 측정
+    mmorpg::cluster::decode_batch(frame, arena);
+    arena.reset();
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        auto* batch = mmorpg::cluster::decode_batch(frame, arena);
+        benchmark::DoNotOptimize(batch);
+        arena.reset();
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK(BM_ClusterDecodeArena)->ArgName("messages")->Arg(1)->Arg(32)->Arg(256);
+
+// 기준선: 힙 메시지 조립 + SerializeAsString
+void BM_ClusterEncodeHeap(benchmark::State& state) {
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        ClusterBatch batch;
+        batch.set_source_node("node-a");
+        batch.set_tick(1);
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            auto* message = batch.add_messages();
+            message->set_sequence(static_cast<uint64_t>(i));
+            fill_whisper(message, static_cast<uint64_t>(i));
+        }
+        std::string frame = batch.SerializeAsString();
+        benchmark::DoNotOptimize(frame.data());
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK(BM_ClusterEncodeHeap)->ArgName("messages")->Arg(1)->Arg(32)->Arg(256);
+
+// 배치 Arena 조립 + 풀 버퍼에 SerializeWithCachedSizesToArray
+void BM_ClusterEncodeArena(benchmark::State& state) {
+    BufferPool pool;
+    ClusterBatchWriter writer("node-a");
+
+    auto encode_one_batch = [&]() {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            fill_whisper(writer.add_message(), static_cast<uint64_t>(i));
+        }
+        return writer.flush(1, pool);
+    };
+    encode_one_batch();
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        auto frame = encode_one_batch();
+        benchmark::DoNotOptimize(frame->data());
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK(BM_ClusterEncodeArena)->ArgName("messages")->Arg(1)->Arg(32)->Arg(256);
+
+} // namespace
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+#include "common/concurrent_hash_map.hpp"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Value = std::shared_ptr<const uint64_t>;
+
+constexpr uint32_t kResidentKeys = 10000;
+
+/**
+ * @brief 지금까지 레지스트리가 쓰던 형태 (unordered_map + 전역 뮤텍스 하나)
+ */
+class MutexMap {
+public:
+    template <typename Visitor>
+    bool visit(const std::string& key, Visitor&& visitor) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            return false;
+        }
+        visitor(it->second);
+        return true;
+    }
+
+    void insert_or_assign(const std::string& key, Value value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_.insert_or_assign(key, std::move(value));
+    }
+
+    void erase(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_.erase(key);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Value> map_;
+};
+
+using LockFreeMap = mmorpg::common::ConcurrentHashMap<std::string, Value>;
+
+std::vector<std::string> make_keys(const std::string& prefix, uint32_t count) {
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        keys.push_back(prefix + std::to_string(i));
+    }
+    return keys;
+}
+
+// 스레드 간 공유 대상 - thread 0이 루프 전에 만들고 루프 후에 정리
+template <typename Map>
+std::unique_ptr<Map> g_map;
+
+/**
+ * @brief 연결 ID 레지스트리 조회/갱신 혼합 (인자: 쓰기 비율 %)
+ *
+ * 상주 키 10,000개 중 임의 키를 조회해 값을 읽고, 쓰기 비율만큼 스레드 전용 키를 넣고 지웁니다.
+ * 연결 ID로 연결을 찾는 send_to_connection 경로처럼 조회가 대부분인 부하입니다.
+ */
+template <typename Map>
+void BM_RegistryLookupMix(benchmark::State& state) {
+    static std::vector<std::string> resident;
+    if (state.thread_index() == 0) {
+        resident = make_keys("conn_", kResidentKeys);
+        g_map<Map> = std::make_unique<Map>();
+        for (uint32_t i = 0; i < kResidentKeys; ++i) {
+            g_map<Map>->insert_or_assign(resident[i], std::make_shared<const uint64_t>(i));
+        }
+    }
+
+    const auto write_percent = static_cast<uint64_t>(state.range(0));
+    const auto churn = make_keys("t" + std::to_string(state.thread_index()) + "_", 256);
+    uint64_t index = static_cast<uint64_t>(state.thread_index()) * 7919;
+    uint64_t sum = 0;
+
+    // thread 0의 준비는 첫 반복의 시작 장벽 뒤에야 보장되므로 맵은 루프 안에서만 참조
+    for (auto _ : state) {
+        ++index;
+        if (index % 100 < write_percent) {
+            const auto& key = churn[index % churn.size()];
+            if ((index / 100) % 2 == 0) {
+                g_map<Map>->insert_or_assign(key, std::make_shared<const uint64_t>(index));
+            } else {
+                g_map<Map>->erase(key);
+            }
+        } else {
+            g_map<Map>->visit(resident[(index * 31) % kResidentKeys], [&sum](const Value& value) { sum += *value; });
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        g_map<Map>.reset();
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_RegistryLookupMix, MutexMap)
+    ->ArgName("write_pct")->Arg(0)->Arg(10)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_RegistryLookupMix, LockFreeMap)
+    ->ArgName("write_pct")->Arg(0)->Arg(10)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include "agents/connection_manager/connection_manager.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mmorpg::agents::connection_manager::ConnectionManagerAgent;
+
+constexpr uint32_t kPopulatedConnections = 5000;
+
+// 스레드 간 공유 대상 - thread 0이 루프 전에 만들고 루프 후에 정리
+std::unique_ptr<ConnectionManagerAgent> g_connection_manager;
+
+std::vector<std::string> make_ids(const std::string& prefix, uint32_t count) {
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        ids.push_back(prefix + std::to_string(i));
+    }
+    return ids;
+}
+
+// 새 연결 수락 + 해제 (연결 테이블 크기를 일정하게 유지)
+void BM_ConnectionManagerConnectDisconnect(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_connection_manager = std::make_unique<ConnectionManagerAgent>(UINT32_MAX);
+        for (const auto& id : make_ids("resident_", kPopulatedConnections)) {
+            g_connection_manager->handle_new_connection(id, "127.0.0.1");
+        }
+    }
+
+    const auto ids = make_ids("t" + std::to_string(state.thread_index()) + "_", 1024);
+    size_t index = 0;
+
+    for (auto _ : state) {
+        const auto& id = ids[index++ & 1023];
+        benchmark::DoNotOptimize(g_connection_manager->handle_new_connection(id, "127.0.0.1"));
+        g_connection_manager->handle_disconnection(id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        g_connection_manager.reset();
+    }
+}
+
+BENCHMARK(BM_ConnectionManagerConnectDisconnect)->ThreadRange(1, 16)->UseRealTime();
+
+// 이미 연결된 5,000개 중 임의 연결의 활동 시간 갱신
+void BM_ConnectionManagerUpdateActivity(benchmark::State& state) {
+    static std::vector<std::string> ids;
+    if (state.thread_index() == 0) {
+        ids = make_ids("conn_", kPopulatedConnections);
+        g_connection_manager = std::make_unique<ConnectionManagerAgent>(UINT32_MAX);
+        for (const auto& id : ids) {
+            g_connection_manager->handle_new_connection(id, "127.0.0.1");
+        }
+    }
+
+    // 스레드마다 다른 순서로 접근
+    size_t index = static_cast<size_t>(state.thread_index()) * 7919;
+    for (auto _ : state) {
+        g_connection_manager->update_activity(ids[index % kPopulatedConnections]);
+        index += 31;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        g_connection_manager.reset();
+    }
+}
+
+BENCHMARK(BM_ConnectionManagerUpdateActivity)->ThreadRange(1, 16)->UseRealTime();
+
+void BM_ConnectionManagerGetStats(benchmark::State& state) {
+    ConnectionManagerAgent connection_manager(UINT32_MAX);
+    for (const auto& id : make_ids("conn_", static_cast<uint32_t>(state.range(0)))) {
+        connection_manager.handle_new_connection(id, "127.0.0.1");
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(connection_manager.get_connection_stats());
+    }
+}
+
+BENCHMARK(BM_ConnectionManagerGetStats)->ArgName("connections")->Arg(100)->Arg(5000);
+
+} // namespace
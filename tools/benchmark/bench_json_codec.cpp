@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include "alloc_counter.hpp"
+#include "protocol/json_codec.hpp"
+#include <cstring>
+#include <string>
+
+namespace {
+
+namespace json = mmorpg::protocol::json;
+using mmorpg::tools::benchmark::AllocationScope;
+
+constexpr std::string_view kHeartbeat = R"({"type":"heartbeat","client_time_ms":1234567})";
+constexpr std::string_view kChat =
+    R"({"type":"chat","channel":2,"target":"","text":"looking for group near the \"northern\" gate"})";
+
+void report(benchmark::State& state, const AllocationScope& allocations) {
+    state.counters["allocs_per_msg"] = static_cast<double>(allocations.count()) /
+                                       static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief 수신 버퍼 흉내: 프레임을 재사용 버퍼에 복사해 NUL 종단 (WebSocketConnection::on_read와 동일)
+ */
+class ReceiveBuffer {
+public:
+    explicit ReceiveBuffer(std::string_view frame)
+        : frame_(frame)
+        , buffer_(frame.size() + 1, '\0') {
+    }
+
+    char* refill() {
+        std::memcpy(buffer_.data(), frame_.data(), frame_.size());
+        buffer_[frame_.size()] = '\0';
+        return buffer_.data();
+    }
+
+private:
+    std::string_view frame_;
+    std::string buffer_;
+};
+
+// 기준선: 메시지마다 새 Document를 만들고 복사 파싱
+void BM_JsonDecodeCopy(benchmark::State& state, std::string_view frame) {
+    ReceiveBuffer receive(frame);
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        rapidjson::Document document;
+        document.Parse(receive.refill());
+        benchmark::DoNotOptimize(document.HasParseError());
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK_CAPTURE(BM_JsonDecodeCopy, heartbeat, kHeartbeat);
+BENCHMARK_CAPTURE(BM_JsonDecodeCopy, chat, kChat);
+
+// 재사용 리더로 수신 버퍼 제자리 파싱
+void BM_JsonDecodeInsitu(benchmark::State& state, std::string_view frame) {
+    ReceiveBuffer receive(frame);
+    json::JsonReader reader;
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        const auto* document = reader.parse_insitu(receive.refill());
+        benchmark::DoNotOptimize(document);
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK_CAPTURE(BM_JsonDecodeInsitu, heartbeat, kHeartbeat);
+BENCHMARK_CAPTURE(BM_JsonDecodeInsitu, chat, kChat);
+
+// 하트비트 왕복: 제자리 파싱 + 재사용 출력 버퍼에 응답 작성
+void BM_JsonHeartbeatRoundTrip(benchmark::State& state) {
+    ReceiveBuffer receive(kHeartbeat);
+    json::JsonReader reader;
+    json::JsonWriter writer;
+    AllocationScope allocations;
+
+    for (auto _ : state) {
+        const auto* document = reader.parse_insitu(receive.refill());
+        auto& out = writer.begin();
+        out.StartObject();
+        out.Key("type");
+        out.String("heartbeat_ack");
+        out.Key("client_time_ms");
+        out.Uint64(json::get_uint64(*document, "client_time_ms").value_or(0));
+        out.Key("server_time_ms");
+        out.Uint64(1700000000000ull);
+        out.EndObject();
+        benchmark::DoNotOptimize(writer.get_output().data());
+    }
+
+    report(state, allocations);
+}
+
+BENCHMARK(BM_JsonHeartbeatRoundTrip);
+
+} // namespace
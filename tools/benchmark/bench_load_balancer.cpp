@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include "network/load_balancer.hpp"
+#include <string>
+
+namespace {
+
+using mmorpg::network::LoadBalancer;
+using mmorpg::network::LoadBalancingStrategy;
+
+std::unique_ptr<LoadBalancer> make_fleet(LoadBalancingStrategy strategy, int64_t fleet_size) {
+    auto balancer = std::make_unique<LoadBalancer>(strategy);
+    for (int64_t i = 0; i < fleet_size; ++i) {
+        const std::string id = "node_" + std::to_string(i);
+        balancer->add_server(id, "10.0.0." + std::to_string(i % 250), 8080, 5000);
+        balancer->update_server_status(id, 0.1 + 0.5 * static_cast<double>(i % 7) / 7.0,
+                                       0.2 + 0.4 * static_cast<double>(i % 5) / 5.0, true);
+    }
+    return balancer;
+}
+
+// range(0) = 전략, range(1) = 서버 수
+void BM_LoadBalancerSelectServer(benchmark::State& state) {
+    const auto strategy = static_cast<LoadBalancingStrategy>(state.range(0));
+    auto balancer = make_fleet(strategy, state.range(1));
+
+    uint32_t client = 0;
+    std::string client_ip = "192.168.0.1";
+    for (auto _ : state) {
+        client_ip.back() = static_cast<char>('0' + (client++ % 10));
+        benchmark::DoNotOptimize(balancer->select_server(client_ip));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_LoadBalancerSelectServer)
+    ->ArgNames({"strategy", "servers"})
+    ->ArgsProduct({
+        {static_cast<int64_t>(LoadBalancingStrategy::ROUND_ROBIN),
+         static_cast<int64_t>(LoadBalancingStrategy::LEAST_CONNECTIONS),
+         static_cast<int64_t>(LoadBalancingStrategy::LEAST_LOAD),
+         static_cast<int64_t>(LoadBalancingStrategy::WEIGHTED_ROUND_ROBIN),
+         static_cast<int64_t>(LoadBalancingStrategy::IP_HASH)},
+        {4, 16, 64, 256}
+    });
+
+// assign/release는 select_server와 같은 잠금을 사용하므로 함께 측정
+void BM_LoadBalancerAssignRelease(benchmark::State& state) {
+    auto balancer = make_fleet(LoadBalancingStrategy::LEAST_LOAD, state.range(0));
+    const std::string connection_id = "conn_bench";
+
+    for (auto _ : state) {
+        const std::string server = balancer->select_server();
+        balancer->assign_connection(server, connection_id);
+        balancer->release_connection(server, connection_id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_LoadBalancerAssignRelease)->ArgName("servers")->Arg(4)->Arg(64);
+
+} // namespace
@@ -0,0 +1,15 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+// 벤치마크 대상 코드의 로그 출력이 측정값을 왜곡하지 않도록 로그를 끈 뒤 실행
+int main(int argc, char** argv) {
+    spdlog::set_level(spdlog::level::off);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
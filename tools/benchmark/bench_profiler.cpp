@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+#include "common/profiler.hpp"
+
+namespace {
+
+using mmorpg::common::Profiler;
+using mmorpg::common::ScopedZone;
+
+// 존 하나의 비용 - 틱당 존 수 x 이 값이 틱 예산의 1% 미만이어야 함
+void BM_ProfilerScopedZone(benchmark::State& state) {
+    Profiler::instance().set_enabled(state.range(0) != 0);
+
+    for (auto _ : state) {
+        ScopedZone zone("bench.zone", "bench");
+        benchmark::ClobberMemory();
+    }
+
+    Profiler::instance().set_enabled(true);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ProfilerScopedZone)->ArgName("enabled")->Arg(0)->Arg(1);
+BENCHMARK(BM_ProfilerScopedZone)->ArgName("enabled")->Arg(1)->Threads(8)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include "protocol/game_protocol.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace protocol = mmorpg::protocol;
+
+std::string make_move_frame() {
+    protocol::MoveInput move;
+    move.sequence = 1234;
+    move.position = {10.0f, 20.0f, 30.0f};
+    move.yaw = 1.5f;
+    return protocol::wire::encode(move);
+}
+
+std::string make_chat_frame() {
+    protocol::ChatSend chat;
+    chat.channel = 0;
+    chat.text = "looking for group near the northern gate";
+    return protocol::wire::encode(chat);
+}
+
+// 기존 수신 경로 기준선: 프레임마다 std::string 복사
+void BM_ProtocolCopyBaseline(benchmark::State& state) {
+    const std::string frame = make_move_frame();
+
+    for (auto _ : state) {
+        std::string copy(frame.data(), frame.size());
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ProtocolCopyBaseline);
+
+// zero-copy 디코드: 길이 검사 + 고정 오프셋 읽기
+void BM_ProtocolDecodeMove(benchmark::State& state) {
+    const std::string frame = make_move_frame();
+
+    for (auto _ : state) {
+        protocol::MoveInputView view;
+        const bool ok = view.bind_frame(frame);
+        benchmark::DoNotOptimize(ok);
+        auto position = view.position();
+        benchmark::DoNotOptimize(position);
+        benchmark::DoNotOptimize(view.sequence());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ProtocolDecodeMove);
+
+void BM_ProtocolDecodeChat(benchmark::State& state) {
+    const std::string frame = make_chat_frame();
+
+    for (auto _ : state) {
+        protocol::ChatSendView view;
+        const bool ok = view.bind_frame(frame);
+        benchmark::DoNotOptimize(ok);
+        auto text = view.text();
+        benchmark::DoNotOptimize(text);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ProtocolDecodeChat);
+
+// 재사용 출력 버퍼에 range(0)개 EntityMoved 인코딩 (스냅샷 배치)
+void BM_ProtocolEncodeEntityMovedBatch(benchmark::State& state) {
+    const auto batch = static_cast<uint64_t>(state.range(0));
+    std::string buffer;
+    buffer.reserve(batch * protocol::EntityMoved{}.encoded_size());
+
+    protocol::EntityMoved moved;
+    moved.position = {1.0f, 2.0f, 3.0f};
+
+    for (auto _ : state) {
+        buffer.clear();
+        for (uint64_t i = 0; i < batch; ++i) {
+            moved.entity_id = i;
+            protocol::wire::append(buffer, moved);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+
+BENCHMARK(BM_ProtocolEncodeEntityMovedBatch)->Arg(1)->Arg(64)->Arg(1024);
+
+struct CountingHandler {
+    void handle(const protocol::HeartbeatView& view) { sum += view.client_time_ms(); }
+    void handle(const protocol::MoveInputView& view) { sum += view.sequence(); }
+    void handle(const protocol::ChatSendView& view) { sum += view.text().size(); }
+
+    uint64_t sum = 0;
+};
+
+// 혼합 프레임 opcode 디스패치
+void BM_ProtocolDispatchMixed(benchmark::State& state) {
+    std::vector<std::string> frames = {
+        make_move_frame(), make_move_frame(), make_chat_frame(),
+        protocol::wire::encode(protocol::Heartbeat{}), protocol::wire::encode(protocol::AttackRequest{}),
+    };
+    CountingHandler handler;
+
+    for (auto _ : state) {
+        for (const auto& frame : frames) {
+            auto result = protocol::dispatch(frame, handler);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    benchmark::DoNotOptimize(handler.sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(frames.size()));
+}
+
+BENCHMARK(BM_ProtocolDispatchMixed);
+
+} // namespace
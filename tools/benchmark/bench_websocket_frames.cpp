@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <boost/beast.hpp>
+#include <boost/beast/_experimental/test/stream.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+
+using TestSocket = websocket::stream<beast::test::stream>;
+
+/**
+ * @brief 메모리 내 test::stream으로 연결된 서버/클라이언트 WebSocket 쌍
+ */
+struct InMemoryConnection {
+    explicit InMemoryConnection(net::io_context& io_context)
+        : server(io_context)
+        , client(io_context) {
+        server.next_layer().connect(client.next_layer());
+    }
+
+    TestSocket server;
+    TestSocket client;
+};
+
+void handshake_all(net::io_context& io_context, std::vector<std::unique_ptr<InMemoryConnection>>& connections) {
+    for (auto& connection : connections) {
+        connection->server.async_accept([](beast::error_code) {});
+        connection->client.async_handshake("localhost", "/", [](beast::error_code) {});
+    }
+    io_context.run();
+    io_context.restart();
+}
+
+// 클라이언트 -> 서버: 마스킹된 프레임 인코딩 + 서버 측 디코딩 (수신 경로)
+void BM_WebSocketFrameClientToServer(benchmark::State& state) {
+    net::io_context io_context;
+    std::vector<std::unique_ptr<InMemoryConnection>> connections;
+    connections.push_back(std::make_unique<InMemoryConnection>(io_context));
+    handshake_all(io_context, connections);
+
+    auto& connection = *connections.front();
+    connection.client.binary(true);
+
+    const std::string payload(static_cast<size_t>(state.range(0)), 'x');
+    beast::flat_buffer buffer;
+
+    for (auto _ : state) {
+        connection.client.write(net::buffer(payload));
+        connection.server.read(buffer);
+        buffer.consume(buffer.size());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_WebSocketFrameClientToServer)->ArgName("bytes")->RangeMultiplier(8)->Range(16, 16384);
+
+// 서버 -> 클라이언트: 마스킹 없는 프레임 인코딩 + 디코딩 (송신 경로)
+void BM_WebSocketFrameServerToClient(benchmark::State& state) {
+    net::io_context io_context;
+    std::vector<std::unique_ptr<InMemoryConnection>> connections;
+    connections.push_back(std::make_unique<InMemoryConnection>(io_context));
+    handshake_all(io_context, connections);
+
+    auto& connection = *connections.front();
+    connection.server.binary(true);
+
+    const std::string payload(static_cast<size_t>(state.range(0)), 'x');
+    beast::flat_buffer buffer;
+
+    for (auto _ : state) {
+        connection.server.write(net::buffer(payload));
+        connection.client.read(buffer);
+        buffer.consume(buffer.size());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_WebSocketFrameServerToClient)->ArgName("bytes")->RangeMultiplier(8)->Range(16, 16384);
+
+// 브로드캐스트 팬아웃: 같은 메시지를 N개 연결에 인코딩/기록
+// range(0) = 연결 수, range(1) = 메시지 크기
+void BM_WebSocketBroadcastFanout(benchmark::State& state) {
+    net::io_context io_context;
+    std::vector<std::unique_ptr<InMemoryConnection>> connections;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        connections.push_back(std::make_unique<InMemoryConnection>(io_context));
+    }
+    handshake_all(io_context, connections);
+
+    const std::string message(static_cast<size_t>(state.range(1)), 'b');
+
+    for (auto _ : state) {
+        for (auto& connection : connections) {
+            connection->server.write(net::buffer(message));
+        }
+
+        // 수신 측 원시 바이트는 측정 밖에서 버림
+        state.PauseTiming();
+        for (auto& connection : connections) {
+            connection->client.next_layer().clear();
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+
+BENCHMARK(BM_WebSocketBroadcastFanout)
+    ->ArgNames({"connections", "bytes"})
+    ->ArgsProduct({{10, 100, 1000}, {64, 1024}})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
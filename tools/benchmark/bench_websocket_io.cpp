@@ -0,0 +1,234 @@
+#include <benchmark/benchmark.h>
+#include "network/websocket_handler.hpp"
+#include "alloc_counter.hpp"
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+using Clock = std::chrono::steady_clock;
+
+using mmorpg::network::SessionMode;
+using mmorpg::network::WebSocketHandler;
+using mmorpg::tools::benchmark::process_allocation_count;
+
+constexpr size_t kPayloadSize = 64;
+
+/**
+ * @brief 루프백 에코 클라이언트 하나
+ */
+struct EchoClient {
+    explicit EchoClient(net::io_context& io_context)
+        : ws(io_context) {
+    }
+
+    websocket::stream<tcp::socket> ws;
+    beast::flat_buffer buffer;
+    Clock::time_point sent_at;
+};
+
+void raise_fd_limit() {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+long context_switches() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+std::string label(SessionMode mode) {
+    return std::string(WebSocketHandler::get_io_backend()) + "/" + mmorpg::network::to_string(mode);
+}
+
+/**
+ * @brief 실제 소켓 위의 WebSocketHandler 에코 왕복 (서버 수신 -> 핸들러 -> 송신 큐 -> 클라이언트)
+ *
+ * 반복 한 번에 모든 연결이 프레임 하나를 보내고 에코를 받습니다. 서버는 I/O 스레드 2개,
+ * 클라이언트는 벤치마크 스레드 하나에서 실행됩니다. 백엔드는 빌드 옵션(ENABLE_IO_URING)으로
+ * 정해지므로 두 빌드의 결과를 label(epoll/io_uring)로 구분해 비교합니다.
+ * syscall 수는 프로세스 밖에서 `perf stat -e raw_syscalls:sys_enter`로 재고, 여기서는
+ * 같은 경향을 보이는 컨텍스트 스위치 수를 메시지당으로 보고합니다.
+ *
+ * 두 번째 인자는 세션 구동 방식(0 = 완료 핸들러 체인, 1 = 코루틴)입니다. allocs_per_msg는
+ * 클라이언트와 에코 핸들러의 할당까지 포함한 프로세스 전체 값이므로 두 방식의 차이만 의미가 있습니다.
+ */
+void BM_WebSocketEchoRoundTrip(benchmark::State& state) {
+    const auto connection_count = static_cast<size_t>(state.range(0));
+    const auto mode = static_cast<SessionMode>(state.range(1));
+    raise_fd_limit();
+
+    WebSocketHandler server(0, 2);
+    server.set_session_mode(mode);
+    server.set_message_handler([&server](const std::string& connection_id, std::string_view message, bool binary) {
+        server.send_to_connection(connection_id, std::string(message), binary);
+    });
+    server.start();
+
+    net::io_context io_context;
+    const tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"), server.get_port());
+
+    std::vector<std::unique_ptr<EchoClient>> clients;
+    clients.reserve(connection_count);
+    for (size_t i = 0; i < connection_count; ++i) {
+        auto& client = *clients.emplace_back(std::make_unique<EchoClient>(io_context));
+        client.ws.next_layer().async_connect(endpoint, [&client](beast::error_code ec) {
+            if (!ec) {
+                client.ws.binary(true);
+                client.ws.async_handshake("127.0.0.1", "/", [](beast::error_code) {});
+            }
+        });
+    }
+    io_context.run();
+    io_context.restart();
+
+    // 서버 쪽 핸드셰이크가 모두 끝나야 첫 반복이 연결 수립 비용을 포함하지 않음
+    while (server.get_connection_count() < connection_count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    const std::string payload(kPayloadSize, 'x');
+    std::vector<double> round_trips_us;
+    round_trips_us.reserve(static_cast<size_t>(state.max_iterations) * connection_count);
+    size_t errors = 0;
+    const long switches_before = context_switches();
+    const uint64_t allocations_before = process_allocation_count();
+
+    for (auto _ : state) {
+        for (auto& client_ptr : clients) {
+            auto& client = *client_ptr;
+            client.sent_at = Clock::now();
+            client.ws.async_write(net::buffer(payload), [&errors](beast::error_code ec, size_t) {
+                errors += ec ? 1 : 0;
+            });
+            client.ws.async_read(client.buffer, [&client, &round_trips_us, &errors](beast::error_code ec, size_t) {
+                if (ec) {
+                    ++errors;
+                    return;
+                }
+                round_trips_us.push_back(
+                    std::chrono::duration<double, std::micro>(Clock::now() - client.sent_at).count());
+                client.buffer.consume(client.buffer.size());
+            });
+        }
+        io_context.run();
+        io_context.restart();
+    }
+
+    const double messages = static_cast<double>(round_trips_us.size());
+    const double allocations = static_cast<double>(process_allocation_count() - allocations_before);
+    std::sort(round_trips_us.begin(), round_trips_us.end());
+    const auto percentile = [&round_trips_us](double p) {
+        if (round_trips_us.empty()) {
+            return 0.0;
+        }
+        return round_trips_us[static_cast<size_t>(p * static_cast<double>(round_trips_us.size() - 1))];
+    };
+
+    state.SetLabel(label(mode));
+    state.SetItemsProcessed(static_cast<int64_t>(messages));
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["ctx_switches_per_msg"] =
+        messages > 0 ? static_cast<double>(context_switches() - switches_before) / messages : 0.0;
+    state.counters["allocs_per_msg"] = messages > 0 ? allocations / messages : 0.0;
+    state.counters["errors"] = static_cast<double>(errors);
+
+    for (auto& client : clients) {
+        beast::error_code ignored;
+        client->ws.next_layer().close(ignored);
+    }
+    server.stop();
+}
+
+// 연결 수 준비 비용이 크므로 반복 횟수를 고정해 한 번만 준비
+BENCHMARK(BM_WebSocketEchoRoundTrip)
+    ->Args({100, 0})->Args({100, 1})
+    ->Args({1000, 0})->Args({1000, 1})
+    ->Args({5000, 0})->Args({5000, 1})
+    ->Iterations(50)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 연결 수립 처리량 (TCP 연결 + WebSocket 핸드셰이크 + 첫 읽기 시작)
+ *
+ * 반복 한 번에 연결 kHandshakeBatch개를 열고 서버가 모두 등록할 때까지 기다립니다.
+ * 연결을 닫고 서버가 정리하는 시간은 재지 않습니다. 인자는 세션 구동 방식입니다.
+ */
+void BM_WebSocketHandshake(benchmark::State& state) {
+    constexpr size_t kHandshakeBatch = 100;
+    const auto mode = static_cast<SessionMode>(state.range(0));
+    raise_fd_limit();
+
+    WebSocketHandler server(0, 2);
+    server.set_session_mode(mode);
+    server.start();
+
+    net::io_context io_context;
+    const tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"), server.get_port());
+    size_t errors = 0;
+    uint64_t allocations = 0;
+
+    for (auto _ : state) {
+        const uint64_t allocations_before = process_allocation_count();
+        std::vector<std::unique_ptr<EchoClient>> clients;
+        clients.reserve(kHandshakeBatch);
+        for (size_t i = 0; i < kHandshakeBatch; ++i) {
+            auto& client = *clients.emplace_back(std::make_unique<EchoClient>(io_context));
+            client.ws.next_layer().async_connect(endpoint, [&client, &errors](beast::error_code ec) {
+                if (ec) {
+                    ++errors;
+                    return;
+                }
+                client.ws.async_handshake("127.0.0.1", "/", [&errors](beast::error_code ec) {
+                    errors += ec ? 1 : 0;
+                });
+            });
+        }
+        io_context.run();
+        io_context.restart();
+        while (server.get_connection_count() < kHandshakeBatch - errors) {
+            std::this_thread::yield();
+        }
+        allocations += process_allocation_count() - allocations_before;
+
+        state.PauseTiming();
+        for (auto& client : clients) {
+            beast::error_code ignored;
+            client->ws.next_layer().close(ignored);
+        }
+        while (server.get_connection_count() > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        state.ResumeTiming();
+    }
+
+    const double handshakes = static_cast<double>(state.iterations() * kHandshakeBatch);
+    state.SetLabel(label(mode));
+    state.SetItemsProcessed(static_cast<int64_t>(handshakes));
+    state.counters["allocs_per_handshake"] = static_cast<double>(allocations) / handshakes;
+    state.counters["errors"] = static_cast<double>(errors);
+
+    server.stop();
+}
+
+BENCHMARK(BM_WebSocketHandshake)
+    ->Arg(0)->Arg(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,78 @@
+#include "load_stats.hpp"
+#include <algorithm>
+#include <sstream>
+
+namespace mmorpg::tools::load_test {
+
+namespace {
+
+double to_ms(double ns) {
+    return ns / 1e6;
+}
+
+} // namespace
+
+LoadStatsSample LoadStatsSample::take(const LoadStats& stats) {
+    LoadStatsSample sample;
+    sample.time = std::chrono::steady_clock::now();
+    sample.connect_successes = stats.connect_successes.load(std::memory_order_relaxed);
+    sample.connect_failures = stats.connect_failures.load(std::memory_order_relaxed);
+    sample.active_connections = stats.active_connections.load(std::memory_order_relaxed);
+    sample.messages_sent = stats.messages_sent.load(std::memory_order_relaxed);
+    sample.bytes_sent = stats.bytes_sent.load(std::memory_order_relaxed);
+    sample.messages_received = stats.messages_received.load(std::memory_order_relaxed);
+    sample.bytes_received = stats.bytes_received.load(std::memory_order_relaxed);
+    sample.sends_dropped = stats.sends_dropped.load(std::memory_order_relaxed);
+    sample.pongs_received = stats.pongs_received.load(std::memory_order_relaxed);
+    sample.connect_latency = stats.connect_latency.snapshot();
+    sample.round_trip_latency = stats.round_trip_latency.snapshot();
+    return sample;
+}
+
+std::string format_progress(const LoadStatsSample& previous, const LoadStatsSample& current) {
+    const double seconds = std::max(
+        std::chrono::duration<double>(current.time - previous.time).count(), 1e-6);
+    const auto rtt = current.round_trip_latency - previous.round_trip_latency;
+
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(1);
+    out << "active=" << current.active_connections
+        << " connected=" << current.connect_successes
+        << " failed=" << current.connect_failures
+        << " send=" << static_cast<double>(current.messages_sent - previous.messages_sent) / seconds << "msg/s"
+        << " recv=" << static_cast<double>(current.messages_received - previous.messages_received) / seconds << "msg/s"
+        << " rtt_p50/p99=" << to_ms(rtt.percentile(0.50)) << "/" << to_ms(rtt.percentile(0.99)) << "ms";
+    return out.str();
+}
+
+std::string format_report(const LoadStatsSample& start, const LoadStatsSample& end, uint64_t connect_attempts) {
+    const double seconds = std::max(std::chrono::duration<double>(end.time - start.time).count(), 1e-6);
+    const auto& connect = end.connect_latency;
+    const auto& rtt = end.round_trip_latency;
+
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(2);
+
+    out << "=== Load test report ===\n"
+        << "duration:            " << seconds << " s\n"
+        << "connections:         " << end.connect_successes << " ok / " << end.connect_failures
+        << " failed / " << connect_attempts << " attempted\n"
+        << "connect latency:     p50=" << to_ms(connect.percentile(0.50))
+        << "ms p99=" << to_ms(connect.percentile(0.99))
+        << "ms p99.9=" << to_ms(connect.percentile(0.999)) << "ms\n"
+        << "round-trip latency:  p50=" << to_ms(rtt.percentile(0.50))
+        << "ms p90=" << to_ms(rtt.percentile(0.90))
+        << "ms p99=" << to_ms(rtt.percentile(0.99))
+        << "ms p99.9=" << to_ms(rtt.percentile(0.999))
+        << "ms (" << rtt.count << " samples)\n"
+        << "sent:                " << static_cast<double>(end.messages_sent - start.messages_sent) / seconds
+        << " msg/s, " << static_cast<double>(end.bytes_sent - start.bytes_sent) / seconds / 1024.0 << " KB/s\n"
+        << "received:            " << static_cast<double>(end.messages_received - start.messages_received) / seconds
+        << " msg/s, " << static_cast<double>(end.bytes_received - start.bytes_received) / seconds / 1024.0 << " KB/s\n"
+        << "dropped sends:       " << end.sends_dropped - start.sends_dropped << "\n";
+    return out.str();
+}
+
+} // namespace mmorpg::tools::load_test
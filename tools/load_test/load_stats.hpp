@@ -0,0 +1,66 @@
+#pragma once
+
+#include "common/metrics.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace mmorpg::tools::load_test {
+
+/**
+ * @brief 부하 테스트 전역 통계
+ *
+ * 모든 클라이언트가 공유하며 relaxed 원자 연산으로만 갱신합니다.
+ */
+struct LoadStats {
+    std::atomic<uint64_t> connect_attempts{0};
+    std::atomic<uint64_t> connect_successes{0};
+    std::atomic<uint64_t> connect_failures{0};
+    std::atomic<uint64_t> disconnects{0};
+    std::atomic<uint64_t> active_connections{0};
+
+    std::atomic<uint64_t> messages_sent{0};
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> messages_received{0};
+    std::atomic<uint64_t> bytes_received{0};
+    std::atomic<uint64_t> sends_dropped{0};
+
+    std::atomic<uint64_t> pings_sent{0};
+    std::atomic<uint64_t> pongs_received{0};
+
+    mmorpg::common::LatencyHistogram connect_latency;
+    mmorpg::common::LatencyHistogram round_trip_latency;
+};
+
+/**
+ * @brief 특정 시점의 통계 사본 (구간 비율 계산용)
+ */
+struct LoadStatsSample {
+    std::chrono::steady_clock::time_point time;
+    uint64_t connect_successes = 0;
+    uint64_t connect_failures = 0;
+    uint64_t active_connections = 0;
+    uint64_t messages_sent = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t messages_received = 0;
+    uint64_t bytes_received = 0;
+    uint64_t sends_dropped = 0;
+    uint64_t pongs_received = 0;
+    mmorpg::common::HistogramSnapshot connect_latency;
+    mmorpg::common::HistogramSnapshot round_trip_latency;
+
+    static LoadStatsSample take(const LoadStats& stats);
+};
+
+/**
+ * @brief 진행 상황 한 줄 (직전 샘플과의 차이)
+ */
+std::string format_progress(const LoadStatsSample& previous, const LoadStatsSample& current);
+
+/**
+ * @brief 최종 보고서
+ */
+std::string format_report(const LoadStatsSample& start, const LoadStatsSample& end, uint64_t connect_attempts);
+
+} // namespace mmorpg::tools::load_test
@@ -0,0 +1,308 @@
+#include "load_stats.hpp"
+#include "simulated_client.hpp"
+#include <sys/resource.h>
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mmorpg::tools::load_test;
+
+namespace {
+
+/**
+ * @brief 명령행 옵션
+ */
+struct Options {
+    std::string host = "127.0.0.1";
+    uint16_t port = 8080;
+    uint32_t connections = 5000;
+    std::chrono::seconds duration{300};
+    uint32_t ramp_rate = 500;           // 초당 새 연결 수
+    uint32_t threads = 4;
+    std::chrono::seconds report_interval{5};
+    // 프로필 비율 (idle, mover, chatter, fighter)
+    std::vector<std::pair<BehaviourProfile, uint32_t>> mix = {
+        {BehaviourProfile::IDLE, 25},
+        {BehaviourProfile::MOVER, 35},
+        {BehaviourProfile::CHATTER, 15},
+        {BehaviourProfile::FIGHTER, 25},
+    };
+};
+
+std::atomic<bool> g_interrupted{false};
+
+void on_signal(int) {
+    g_interrupted.store(true, std::memory_order_relaxed);
+}
+
+void print_usage() {
+    std::cout
+        << "Usage: load_test [options]\n"
+        << "  --host=127.0.0.1          server address\n"
+        << "  --port=8080               server WebSocket port\n"
+        << "  --connections=5000        number of simulated clients\n"
+        << "  --duration=300s           test duration (s/m suffix)\n"
+        << "  --ramp-rate=500           new connections per second\n"
+        << "  --threads=4               client I/O threads\n"
+        << "  --report-interval=5s      progress report interval\n"
+        << "  --profile=mover           single behaviour profile (idle|mover|chatter|fighter)\n"
+        << "  --mix=idle:25,mover:35,chatter:15,fighter:25\n"
+        << "                            weighted profile mix\n";
+}
+
+bool parse_duration(const std::string& value, std::chrono::seconds& out) {
+    if (value.empty()) {
+        return false;
+    }
+
+    try {
+        std::size_t pos = 0;
+        const long number = std::stol(value, &pos);
+        const std::string unit = value.substr(pos);
+        if (unit.empty() || unit == "s") {
+            out = std::chrono::seconds(number);
+        } else if (unit == "m") {
+            out = std::chrono::minutes(number);
+        } else if (unit == "h") {
+            out = std::chrono::hours(number);
+        } else {
+            return false;
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return out.count() > 0;
+}
+
+bool parse_mix(const std::string& value, std::vector<std::pair<BehaviourProfile, uint32_t>>& mix) {
+    mix.clear();
+
+    std::stringstream stream(value);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+        auto colon = entry.find(':');
+        BehaviourProfile profile;
+        if (!parse_profile(entry.substr(0, colon), profile)) {
+            return false;
+        }
+
+        uint32_t weight = 1;
+        if (colon != std::string::npos) {
+            try {
+                weight = static_cast<uint32_t>(std::stoul(entry.substr(colon + 1)));
+            } catch (const std::exception&) {
+                return false;
+            }
+        }
+        if (weight > 0) {
+            mix.emplace_back(profile, weight);
+        }
+    }
+    return !mix.empty();
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+
+        auto eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return false;
+        }
+
+        const std::string key = arg.substr(2, eq - 2);
+        const std::string value = arg.substr(eq + 1);
+
+        try {
+            if (key == "host") {
+                options.host = value;
+            } else if (key == "port") {
+                options.port = static_cast<uint16_t>(std::stoul(value));
+            } else if (key == "connections") {
+                options.connections = static_cast<uint32_t>(std::stoul(value));
+            } else if (key == "duration") {
+                if (!parse_duration(value, options.duration)) {
+                    std::cerr << "Invalid duration: " << value << std::endl;
+                    return false;
+                }
+            } else if (key == "ramp-rate") {
+                options.ramp_rate = std::max<uint32_t>(1, static_cast<uint32_t>(std::stoul(value)));
+            } else if (key == "threads") {
+                options.threads = std::max<uint32_t>(1, static_cast<uint32_t>(std::stoul(value)));
+            } else if (key == "report-interval") {
+                if (!parse_duration(value, options.report_interval)) {
+                    std::cerr << "Invalid report interval: " << value << std::endl;
+                    return false;
+                }
+            } else if (key == "profile") {
+                BehaviourProfile profile;
+                if (!parse_profile(value, profile)) {
+                    std::cerr << "Unknown profile: " << value << std::endl;
+                    return false;
+                }
+                options.mix = {{profile, 1}};
+            } else if (key == "mix") {
+                if (!parse_mix(value, options.mix)) {
+                    std::cerr << "Invalid mix: " << value << std::endl;
+                    return false;
+                }
+            } else {
+                std::cerr << "Unknown option: --" << key << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for --" << key << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 클라이언트 수천 개를 위해 파일 디스크립터 한도를 최대로 올림
+ */
+void raise_fd_limit(uint32_t connections) {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) {
+        return;
+    }
+
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+
+    if (limit.rlim_cur < connections + 64) {
+        std::cerr << "Warning: RLIMIT_NOFILE=" << limit.rlim_cur
+                  << " is below the requested connection count" << std::endl;
+    }
+}
+
+BehaviourProfile pick_profile(const Options& options, uint32_t index) {
+    uint32_t total = 0;
+    for (const auto& [profile, weight] : options.mix) {
+        total += weight;
+    }
+
+    // 결정적 분배: 인덱스를 가중치 구간에 매핑
+    uint32_t slot = index % total;
+    for (const auto& [profile, weight] : options.mix) {
+        if (slot < weight) {
+            return profile;
+        }
+        slot -= weight;
+    }
+    return options.mix.front().first;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    raise_fd_limit(options.connections);
+
+    beast::error_code ec;
+    auto address = net::ip::make_address(options.host, ec);
+    if (ec) {
+        std::cerr << "Invalid host address: " << options.host << std::endl;
+        return 1;
+    }
+    const tcp::endpoint endpoint(address, options.port);
+
+    std::cout << "Load test: " << options.connections << " connections to " << endpoint
+              << ", ramp " << options.ramp_rate << "/s, duration " << options.duration.count()
+              << "s, " << options.threads << " threads" << std::endl;
+
+    // 스레드마다 독립 io_context - 클라이언트는 하나의 스레드에만 속하므로 strand 불필요
+    std::vector<std::unique_ptr<net::io_context>> contexts;
+    std::vector<net::executor_work_guard<net::io_context::executor_type>> guards;
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < options.threads; ++i) {
+        contexts.push_back(std::make_unique<net::io_context>(1));
+        guards.push_back(net::make_work_guard(*contexts.back()));
+    }
+    for (uint32_t i = 0; i < options.threads; ++i) {
+        threads.emplace_back([&contexts, i]() {
+            contexts[i]->run();
+        });
+    }
+
+    LoadStats stats;
+    std::vector<std::shared_ptr<SimulatedClient>> clients;
+    clients.reserve(options.connections);
+
+    const auto start_sample = LoadStatsSample::take(stats);
+    const auto test_start = std::chrono::steady_clock::now();
+    const auto test_end = test_start + options.duration;
+    auto previous_sample = start_sample;
+    auto next_report = test_start + options.report_interval;
+
+    // 램프업: 10ms 간격으로 ramp_rate에 맞춰 연결 생성
+    constexpr auto kRampTick = std::chrono::milliseconds(10);
+    uint32_t created = 0;
+
+    while (!g_interrupted.load(std::memory_order_relaxed)) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= test_end) {
+            break;
+        }
+
+        if (created < options.connections) {
+            const double elapsed = std::chrono::duration<double>(now - test_start).count();
+            const uint32_t target = std::min<uint32_t>(
+                options.connections, static_cast<uint32_t>(elapsed * options.ramp_rate) + 1);
+
+            for (; created < target; ++created) {
+                auto& context = *contexts[created % options.threads];
+                auto client = std::make_shared<SimulatedClient>(
+                    context, endpoint, options.host, pick_profile(options, created), stats, created + 1);
+                net::post(context, [client]() { client->start(); });
+                clients.push_back(std::move(client));
+            }
+        }
+
+        if (now >= next_report) {
+            auto sample = LoadStatsSample::take(stats);
+            std::cout << "[" << std::chrono::duration_cast<std::chrono::seconds>(now - test_start).count()
+                      << "s] " << format_progress(previous_sample, sample) << std::endl;
+            previous_sample = sample;
+            next_report += options.report_interval;
+        }
+
+        std::this_thread::sleep_for(kRampTick);
+    }
+
+    const auto end_sample = LoadStatsSample::take(stats);
+
+    // 정리: 각 클라이언트를 자기 io_context에서 종료
+    for (uint32_t i = 0; i < clients.size(); ++i) {
+        net::post(*contexts[i % options.threads], [client = clients[i]]() { client->stop(); });
+    }
+    clients.clear();
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    guards.clear();
+    for (auto& context : contexts) {
+        context->stop();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::cout << format_report(start_sample, end_sample, stats.connect_attempts.load()) << std::flush;
+    return end_sample.connect_failures == 0 ? 0 : 2;
+}
@@ -0,0 +1,339 @@
+#include "simulated_client.hpp"
+#include "common/profiler.hpp"
+#include "protocol/game_protocol.hpp"
+#include <charconv>
+#include <iostream>
+
+namespace mmorpg::tools::load_test {
+
+namespace {
+
+constexpr std::size_t kMaxWriteQueue = 64;
+
+} // namespace
+
+const char* to_string(BehaviourProfile profile) {
+    switch (profile) {
+        case BehaviourProfile::IDLE:    return "idle";
+        case BehaviourProfile::MOVER:   return "mover";
+        case BehaviourProfile::CHATTER: return "chatter";
+        case BehaviourProfile::FIGHTER: return "fighter";
+    }
+    return "unknown";
+}
+
+bool parse_profile(const std::string& name, BehaviourProfile& profile) {
+    if (name == "idle") {
+        profile = BehaviourProfile::IDLE;
+    } else if (name == "mover") {
+        profile = BehaviourProfile::MOVER;
+    } else if (name == "chatter") {
+        profile = BehaviourProfile::CHATTER;
+    } else if (name == "fighter") {
+        profile = BehaviourProfile::FIGHTER;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+ProfileTiming ProfileTiming::for_profile(BehaviourProfile profile) {
+    using std::chrono::milliseconds;
+
+    switch (profile) {
+        case BehaviourProfile::IDLE:
+            return {milliseconds(5000), milliseconds(0), milliseconds(0), milliseconds(0)};
+        case BehaviourProfile::MOVER:
+            return {milliseconds(1000), milliseconds(100), milliseconds(0), milliseconds(0)};
+        case BehaviourProfile::CHATTER:
+            return {milliseconds(1000), milliseconds(0), milliseconds(2000), milliseconds(0)};
+        case BehaviourProfile::FIGHTER:
+            return {milliseconds(1000), milliseconds(100), milliseconds(0), milliseconds(200)};
+    }
+    return {milliseconds(5000), milliseconds(0), milliseconds(0), milliseconds(0)};
+}
+
+SimulatedClient::SimulatedClient(net::io_context& io_context,
+                                 tcp::endpoint endpoint,
+                                 std::string host,
+                                 BehaviourProfile profile,
+                                 LoadStats& stats,
+                                 uint32_t seed)
+    : ws_(io_context)
+    , endpoint_(std::move(endpoint))
+    , host_(std::move(host))
+    , profile_(profile)
+    , timing_(ProfileTiming::for_profile(profile))
+    , stats_(stats)
+    , rng_(seed)
+    , ping_timer_(io_context)
+    , move_timer_(io_context)
+    , chat_timer_(io_context)
+    , attack_timer_(io_context) {
+}
+
+void SimulatedClient::start() {
+    stats_.connect_attempts.fetch_add(1, std::memory_order_relaxed);
+    connect_started_ = std::chrono::steady_clock::now();
+
+    beast::get_lowest_layer(ws_).expires_after(std::chrono::seconds(10));
+    beast::get_lowest_layer(ws_).async_connect(endpoint_,
+        [self = shared_from_this()](beast::error_code ec) {
+            self->on_connect(ec);
+        });
+}
+
+void SimulatedClient::stop() {
+    if (stopping_) {
+        return;
+    }
+    stopping_ = true;
+
+    ping_timer_.cancel();
+    move_timer_.cancel();
+    chat_timer_.cancel();
+    attack_timer_.cancel();
+
+    if (!connected_) {
+        beast::error_code ec;
+        beast::get_lowest_layer(ws_).socket().close(ec);
+        return;
+    }
+
+    ws_.async_close(websocket::close_code::normal,
+        [self = shared_from_this()](beast::error_code) {
+            beast::error_code ec;
+            beast::get_lowest_layer(self->ws_).socket().close(ec);
+        });
+}
+
+void SimulatedClient::on_connect(beast::error_code ec) {
+    if (ec) {
+        fail("connect", ec);
+        return;
+    }
+
+    beast::get_lowest_layer(ws_).socket().set_option(tcp::no_delay(true), ec);
+    beast::get_lowest_layer(ws_).expires_never();
+    ws_.set_option(websocket::stream_base::timeout::suggested(beast::role_type::client));
+
+    ws_.async_handshake(host_, "/",
+        [self = shared_from_this()](beast::error_code ec) {
+            self->on_handshake(ec);
+        });
+}
+
+void SimulatedClient::on_handshake(beast::error_code ec) {
+    if (ec) {
+        fail("handshake", ec);
+        return;
+    }
+
+    connected_ = true;
+    handshake_done_ = true;
+    const auto latency = std::chrono::steady_clock::now() - connect_started_;
+    stats_.connect_latency.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()));
+    stats_.connect_successes.fetch_add(1, std::memory_order_relaxed);
+    stats_.active_connections.fetch_add(1, std::memory_order_relaxed);
+
+    ws_.control_callback(
+        [this](websocket::frame_type kind, beast::string_view payload) {
+            on_control(kind, payload);
+        });
+
+    ws_.async_read(read_buffer_,
+        [self = shared_from_this()](beast::error_code ec, std::size_t bytes) {
+            self->on_read(ec, bytes);
+        });
+
+    // 모든 클라이언트가 같은 위상으로 보내지 않도록 첫 주기를 무작위로 분산
+    auto jitter = [this](std::chrono::milliseconds interval) {
+        std::uniform_int_distribution<int64_t> dist(0, std::max<int64_t>(interval.count(), 1));
+        return std::chrono::milliseconds(dist(rng_));
+    };
+
+    schedule(ping_timer_, jitter(timing_.ping_interval), &SimulatedClient::send_ping);
+    if (timing_.move_interval.count() > 0) {
+        schedule(move_timer_, jitter(timing_.move_interval), &SimulatedClient::send_move);
+    }
+    if (timing_.chat_interval.count() > 0) {
+        schedule(chat_timer_, jitter(timing_.chat_interval), &SimulatedClient::send_chat);
+    }
+    if (timing_.attack_interval.count() > 0) {
+        schedule(attack_timer_, jitter(timing_.attack_interval), &SimulatedClient::send_attack);
+    }
+}
+
+void SimulatedClient::on_read(beast::error_code ec, std::size_t bytes_transferred) {
+    if (ec) {
+        if (connected_) {
+            connected_ = false;
+            stats_.active_connections.fetch_sub(1, std::memory_order_relaxed);
+            stats_.disconnects.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!stopping_ && ec != websocket::error::closed) {
+            fail("read", ec);
+        }
+        ping_timer_.cancel();
+        move_timer_.cancel();
+        chat_timer_.cancel();
+        attack_timer_.cancel();
+        return;
+    }
+
+    stats_.messages_received.fetch_add(1, std::memory_order_relaxed);
+    stats_.bytes_received.fetch_add(bytes_transferred, std::memory_order_relaxed);
+    read_buffer_.consume(read_buffer_.size());
+
+    ws_.async_read(read_buffer_,
+        [self = shared_from_this()](beast::error_code ec, std::size_t bytes) {
+            self->on_read(ec, bytes);
+        });
+}
+
+void SimulatedClient::on_control(websocket::frame_type kind, beast::string_view payload) {
+    if (kind != websocket::frame_type::pong) {
+        return;
+    }
+
+    uint64_t sent_ns = 0;
+    auto result = std::from_chars(payload.data(), payload.data() + payload.size(), sent_ns);
+    if (result.ec != std::errc() || sent_ns == 0) {
+        return;
+    }
+
+    ping_in_flight_ = false;
+    stats_.pongs_received.fetch_add(1, std::memory_order_relaxed);
+    stats_.round_trip_latency.record(mmorpg::common::Profiler::now_ns() - sent_ns);
+}
+
+void SimulatedClient::schedule(net::steady_timer& timer,
+                               std::chrono::milliseconds interval,
+                               void (SimulatedClient::*action)()) {
+    timer.expires_after(interval);
+    timer.async_wait(
+        [self = shared_from_this(), &timer, action, this](beast::error_code ec) {
+            if (ec || stopping_ || !connected_) {
+                return;
+            }
+            (this->*action)();
+
+            std::chrono::milliseconds next = timing_.ping_interval;
+            if (&timer == &move_timer_) {
+                next = timing_.move_interval;
+            } else if (&timer == &chat_timer_) {
+                next = timing_.chat_interval;
+            } else if (&timer == &attack_timer_) {
+                next = timing_.attack_interval;
+            }
+            schedule(timer, next, action);
+        });
+}
+
+void SimulatedClient::send_ping() {
+    // 이전 ping의 pong을 아직 받지 못했으면 겹쳐 보내지 않음 (RTT 왜곡 방지)
+    if (ping_in_flight_) {
+        return;
+    }
+
+    // async_ping은 payload를 참조로 보관하므로 연산이 끝날 때까지 멤버에 유지
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), mmorpg::common::Profiler::now_ns());
+    ping_payload_ = beast::string_view(digits, static_cast<std::size_t>(result.ptr - digits));
+
+    ping_in_flight_ = true;
+    stats_.pings_sent.fetch_add(1, std::memory_order_relaxed);
+    ws_.async_ping(ping_payload_,
+        [self = shared_from_this()](beast::error_code ec) {
+            if (ec) {
+                self->ping_in_flight_ = false;
+            }
+        });
+}
+
+void SimulatedClient::send_move() {
+    std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+    x_ += step(rng_);
+    y_ += step(rng_);
+
+    protocol::MoveInput move;
+    move.sequence = ++move_sequence_;
+    move.position = {x_, y_, 0.0f};
+    enqueue(protocol::wire::encode(move), true);
+}
+
+void SimulatedClient::send_chat() {
+    static constexpr const char* kLines[] = {
+        "hello everyone", "looking for group", "selling iron ore", "gg", "anyone up for the raid?"
+    };
+    std::uniform_int_distribution<std::size_t> pick(0, std::size(kLines) - 1);
+
+    std::string frame = "{\"type\":\"chat\",\"channel\":\"zone\",\"text\":\"";
+    frame += kLines[pick(rng_)];
+    frame += "\"}";
+    enqueue(std::move(frame), false);
+}
+
+void SimulatedClient::send_attack() {
+    std::uniform_int_distribution<uint32_t> target(1, 5000);
+
+    protocol::AttackRequest attack;
+    attack.target_id = target(rng_);
+    attack.skill_id = 1;
+    enqueue(protocol::wire::encode(attack), true);
+}
+
+void SimulatedClient::enqueue(std::string frame, bool binary) {
+    if (write_queue_.size() >= kMaxWriteQueue) {
+        stats_.sends_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    write_queue_.emplace_back(std::move(frame), binary);
+    if (!writing_) {
+        write_next();
+    }
+}
+
+void SimulatedClient::write_next() {
+    if (write_queue_.empty() || !connected_) {
+        writing_ = false;
+        return;
+    }
+
+    writing_ = true;
+    ws_.binary(write_queue_.front().second);
+    ws_.async_write(net::buffer(write_queue_.front().first),
+        [self = shared_from_this()](beast::error_code ec, std::size_t bytes) {
+            self->write_queue_.pop_front();
+            if (ec) {
+                self->writing_ = false;
+                if (!self->stopping_) {
+                    self->fail("write", ec);
+                }
+                return;
+            }
+            self->stats_.messages_sent.fetch_add(1, std::memory_order_relaxed);
+            self->stats_.bytes_sent.fetch_add(bytes, std::memory_order_relaxed);
+            self->write_next();
+        });
+}
+
+void SimulatedClient::fail(const char* what, beast::error_code ec) {
+    // 오류 폭주 시 출력이 넘치지 않도록 처음 몇 건만 표시
+    static std::atomic<uint32_t> reported{0};
+    if (reported.fetch_add(1, std::memory_order_relaxed) < 5) {
+        std::cerr << "client " << what << " error: " << ec.message() << std::endl;
+    }
+
+    if (!handshake_done_) {
+        stats_.connect_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+    stopping_ = true;
+
+    beast::error_code ignored;
+    beast::get_lowest_layer(ws_).socket().close(ignored);
+}
+
+} // namespace mmorpg::tools::load_test
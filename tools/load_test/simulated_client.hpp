@@ -0,0 +1,115 @@
+#pragma once
+
+#include "load_stats.hpp"
+#include <boost/asio.hpp>
+#include <boost/beast.hpp>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace mmorpg::tools::load_test {
+
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+using tcp = boost::asio::ip::tcp;
+
+/**
+ * @brief 시뮬레이션 클라이언트 행동 프로필
+ */
+enum class BehaviourProfile {
+    IDLE,     // 하트비트 ping만 전송
+    MOVER,    // 10Hz 이동 패킷
+    CHATTER,  // 2초마다 채팅 메시지
+    FIGHTER   // 10Hz 이동 + 5Hz 공격
+};
+
+const char* to_string(BehaviourProfile profile);
+bool parse_profile(const std::string& name, BehaviourProfile& profile);
+
+/**
+ * @brief 프로필별 송신 주기
+ */
+struct ProfileTiming {
+    std::chrono::milliseconds ping_interval;
+    std::chrono::milliseconds move_interval;    // 0이면 전송 안 함
+    std::chrono::milliseconds chat_interval;
+    std::chrono::milliseconds attack_interval;
+
+    static ProfileTiming for_profile(BehaviourProfile profile);
+};
+
+/**
+ * @brief 시뮬레이션 WebSocket 클라이언트 하나
+ *
+ * 하나의 io_context 스레드에서만 실행되므로 strand 없이 동작합니다.
+ * RTT는 WebSocket ping 제어 프레임의 payload에 송신 시각을 넣고
+ * pong 수신 시 차이를 재서 측정하므로 서버 쪽 핸들러 구현과 무관합니다.
+ */
+class SimulatedClient : public std::enable_shared_from_this<SimulatedClient> {
+public:
+    SimulatedClient(net::io_context& io_context,
+                    tcp::endpoint endpoint,
+                    std::string host,
+                    BehaviourProfile profile,
+                    LoadStats& stats,
+                    uint32_t seed);
+
+    /**
+     * @brief 연결 및 행동 시작
+     */
+    void start();
+
+    /**
+     * @brief 정상 종료
+     */
+    void stop();
+
+private:
+    void on_connect(beast::error_code ec);
+    void on_handshake(beast::error_code ec);
+    void on_read(beast::error_code ec, std::size_t bytes_transferred);
+    void on_control(websocket::frame_type kind, beast::string_view payload);
+
+    void schedule(net::steady_timer& timer, std::chrono::milliseconds interval, void (SimulatedClient::*action)());
+    void send_ping();
+    void send_move();
+    void send_chat();
+    void send_attack();
+
+    void enqueue(std::string frame, bool binary);
+    void write_next();
+    void fail(const char* what, beast::error_code ec);
+
+    websocket::stream<beast::tcp_stream> ws_;
+    tcp::endpoint endpoint_;
+    std::string host_;
+    BehaviourProfile profile_;
+    ProfileTiming timing_;
+    LoadStats& stats_;
+    std::mt19937 rng_;
+
+    beast::flat_buffer read_buffer_;
+    websocket::ping_data ping_payload_;
+    std::deque<std::pair<std::string, bool>> write_queue_;
+    bool writing_ = false;
+    bool connected_ = false;
+    bool handshake_done_ = false;
+    bool stopping_ = false;
+    bool ping_in_flight_ = false;
+
+    std::chrono::steady_clock::time_point connect_started_;
+
+    net::steady_timer ping_timer_;
+    net::steady_timer move_timer_;
+    net::steady_timer chat_timer_;
+    net::steady_timer attack_timer_;
+
+    float x_ = 0.0f;
+    float y_ = 0.0f;
+    uint32_t move_sequence_ = 0;
+};
+
+} // namespace mmorpg::tools::load_test
@@ -0,0 +1,504 @@
+#!/usr/bin/env python3
+"""
+게임 프로토콜 코드 생성기
+
+protocol/*.schema 파일을 읽어 C++ 헤더를 생성합니다.
+  - 메시지별 값 구조체 (인코더: 출력 버퍼에 직접 기록)
+  - 메시지별 View 클래스 (수신 버퍼 위의 zero-copy 뷰: 경계 검사 후 오프셋 읽기만 수행)
+  - opcode -> 핸들러 오버로드로 분기하는 dispatch() (switch 기반, 컴파일 시점 결정)
+
+사용법:
+  protocol_gen.py --schema protocol/game.schema --output build/generated/protocol/game_protocol.hpp
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCALAR_TYPES = {
+    # 스키마 타입: (C++ 타입, 바이트 수, 기본값)
+    "bool": ("bool", 1, "false"),
+    "u8": ("uint8_t", 1, "0"),
+    "i8": ("int8_t", 1, "0"),
+    "u16": ("uint16_t", 2, "0"),
+    "i16": ("int16_t", 2, "0"),
+    "u32": ("uint32_t", 4, "0"),
+    "i32": ("int32_t", 4, "0"),
+    "u64": ("uint64_t", 8, "0"),
+    "i64": ("int64_t", 8, "0"),
+    "f32": ("float", 4, "0.0f"),
+    "f64": ("double", 8, "0.0"),
+}
+
+VARIABLE_TYPES = {"string", "bytes"}
+
+# 생성 코드의 멤버 함수와 충돌하는 필드 이름
+RESERVED_FIELD_NAMES = {
+    "bind", "bind_frame", "encode_to", "encoded_size", "to_message", "load", "store", "data",
+}
+
+IDENTIFIER = r"[A-Za-z_][A-Za-z0-9_]*"
+STRUCT_RE = re.compile(r"^struct\s+(" + IDENTIFIER + r")\s*\{$")
+MESSAGE_RE = re.compile(r"^message\s+(" + IDENTIFIER + r")\s*=\s*(0[xX][0-9A-Fa-f]+|\d+)\s*\{$")
+FIELD_RE = re.compile(r"^(" + IDENTIFIER + r")\s+(" + IDENTIFIER + r")\s*;$")
+NAMESPACE_RE = re.compile(r"^namespace\s+([A-Za-z_][A-Za-z0-9_:]*)\s*;$")
+
+
+class SchemaError(Exception):
+    pass
+
+
+class Field:
+    def __init__(self, type_name, name, line):
+        self.type_name = type_name
+        self.name = name
+        self.line = line
+
+
+class Definition:
+    def __init__(self, kind, name, opcode, doc, line):
+        self.kind = kind  # "struct" | "message"
+        self.name = name
+        self.opcode = opcode
+        self.doc = doc
+        self.line = line
+        self.fields = []
+
+    @property
+    def fixed_fields(self):
+        return [f for f in self.fields if f.type_name not in VARIABLE_TYPES]
+
+    @property
+    def variable_fields(self):
+        return [f for f in self.fields if f.type_name in VARIABLE_TYPES]
+
+
+class Schema:
+    def __init__(self):
+        self.namespace = "mmorpg::protocol"
+        self.structs = {}
+        self.messages = []
+
+    def wire_size(self, type_name):
+        if type_name in SCALAR_TYPES:
+            return SCALAR_TYPES[type_name][1]
+        return self.struct_size(self.structs[type_name])
+
+    def struct_size(self, definition):
+        return sum(self.wire_size(f.type_name) for f in definition.fixed_fields)
+
+    def cpp_type(self, type_name):
+        if type_name in SCALAR_TYPES:
+            return SCALAR_TYPES[type_name][0]
+        if type_name in VARIABLE_TYPES:
+            return "std::string_view"
+        return type_name
+
+
+def parse_schema(text, path):
+    schema = Schema()
+    current = None
+    pending_doc = []
+    names = set()
+    opcodes = {}
+
+    def fail(line_number, message):
+        raise SchemaError("{}:{}: {}".format(path, line_number, message))
+
+    for line_number, raw in enumerate(text.splitlines(), start=1):
+        line = raw.strip()
+
+        if not line:
+            pending_doc = []
+            continue
+
+        if line.startswith("#"):
+            pending_doc.append(line[1:].strip())
+            continue
+
+        # 줄 끝 주석 제거
+        if "#" in line:
+            line = line[: line.index("#")].strip()
+
+        if current is None:
+            match = NAMESPACE_RE.match(line)
+            if match:
+                schema.namespace = match.group(1)
+                pending_doc = []
+                continue
+
+            match = STRUCT_RE.match(line)
+            if match:
+                name = match.group(1)
+                if name in names or name in SCALAR_TYPES or name in VARIABLE_TYPES:
+                    fail(line_number, "duplicate type name '{}'".format(name))
+                names.add(name)
+                current = Definition("struct", name, None, pending_doc, line_number)
+                pending_doc = []
+                continue
+
+            match = MESSAGE_RE.match(line)
+            if match:
+                name = match.group(1)
+                opcode = int(match.group(2), 0)
+                if name in names or name in SCALAR_TYPES or name in VARIABLE_TYPES:
+                    fail(line_number, "duplicate type name '{}'".format(name))
+                if not 0 < opcode <= 0xFFFF:
+                    fail(line_number, "opcode {} out of range (1-65535)".format(opcode))
+                if opcode in opcodes:
+                    fail(line_number, "opcode 0x{:04X} already used by {}".format(opcode, opcodes[opcode]))
+                names.add(name)
+                opcodes[opcode] = name
+                current = Definition("message", name, opcode, pending_doc, line_number)
+                pending_doc = []
+                continue
+
+            fail(line_number, "expected 'struct Name {' or 'message Name = opcode {'")
+
+        if line == "}":
+            if not current.fields:
+                fail(line_number, "{} has no fields".format(current.name))
+            if current.kind == "struct":
+                schema.structs[current.name] = current
+            else:
+                schema.messages.append(current)
+            current = None
+            pending_doc = []
+            continue
+
+        match = FIELD_RE.match(line)
+        if not match:
+            fail(line_number, "expected 'type name;'")
+
+        type_name, field_name = match.group(1), match.group(2)
+        if type_name not in SCALAR_TYPES and type_name not in VARIABLE_TYPES and type_name not in schema.structs:
+            fail(line_number, "unknown type '{}' (structs must be declared before use)".format(type_name))
+        if current.kind == "struct" and type_name in VARIABLE_TYPES:
+            fail(line_number, "struct {} must be fixed-size; '{}' not allowed".format(current.name, type_name))
+        if field_name in RESERVED_FIELD_NAMES or field_name.endswith("_"):
+            fail(line_number, "field name '{}' is reserved".format(field_name))
+        if any(f.name == field_name for f in current.fields):
+            fail(line_number, "duplicate field '{}'".format(field_name))
+
+        current.fields.append(Field(type_name, field_name, line_number))
+        pending_doc = []
+
+    if current is not None:
+        fail(current.line, "unterminated definition '{}'".format(current.name))
+
+    if not schema.messages:
+        raise SchemaError("{}: no messages defined".format(path))
+
+    return schema
+
+
+def upper_snake(name):
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+
+
+def doc_comment(lines, indent=""):
+    if not lines:
+        return []
+    out = [indent + "/**", indent + " * @brief " + lines[0]]
+    if len(lines) > 1:
+        out.append(indent + " *")
+        out.extend(indent + " * " + line if line else indent + " *" for line in lines[1:])
+    out.append(indent + " */")
+    return out
+
+
+def emit_fixed_loads(schema, definition, target, source, indent):
+    out = []
+    offset = 0
+    for field in definition.fixed_fields:
+        if field.type_name in SCALAR_TYPES:
+            out.append("{}{}.{} = wire::load<{}>({} + {});".format(
+                indent, target, field.name, schema.cpp_type(field.type_name), source, offset))
+        else:
+            out.append("{}{}.{} = {}::load({} + {});".format(
+                indent, target, field.name, field.type_name, source, offset))
+        offset += schema.wire_size(field.type_name)
+    return out
+
+
+def emit_fixed_stores(schema, definition, destination, indent):
+    out = []
+    offset = 0
+    for field in definition.fixed_fields:
+        if field.type_name in SCALAR_TYPES:
+            out.append("{}wire::store<{}>({} + {}, {});".format(
+                indent, schema.cpp_type(field.type_name), destination, offset, field.name))
+        else:
+            out.append("{}{}.store({} + {});".format(indent, field.name, destination, offset))
+        offset += schema.wire_size(field.type_name)
+    return out
+
+
+def emit_value_fields(schema, definition):
+    out = []
+    for field in definition.fields:
+        if field.type_name in SCALAR_TYPES:
+            default = SCALAR_TYPES[field.type_name][2]
+            out.append("    {} {} = {};".format(schema.cpp_type(field.type_name), field.name, default))
+        elif field.type_name in VARIABLE_TYPES:
+            out.append("    std::string_view {};".format(field.name))
+        else:
+            out.append("    {} {}{{}};".format(field.type_name, field.name))
+    return out
+
+
+def emit_struct(schema, definition):
+    out = doc_comment(definition.doc or ["{} (고정 길이 {}바이트)".format(definition.name, schema.struct_size(definition))])
+    out.append("struct {} {{".format(definition.name))
+    out.append("    static constexpr size_t kWireSize = {};".format(schema.struct_size(definition)))
+    out.append("")
+    out.extend(emit_value_fields(schema, definition))
+    out.append("")
+    out.append("    static {} load(const char* source) noexcept {{".format(definition.name))
+    out.append("        {} value;".format(definition.name))
+    out.extend(emit_fixed_loads(schema, definition, "value", "source", "        "))
+    out.append("        return value;")
+    out.append("    }")
+    out.append("")
+    out.append("    void store(char* destination) const noexcept {")
+    out.extend(emit_fixed_stores(schema, definition, "destination", "        "))
+    out.append("    }")
+    out.append("")
+    out.append("    bool operator==(const {}&) const = default;".format(definition.name))
+    out.append("};")
+    return out
+
+
+def emit_message(schema, message):
+    fixed_size = schema.struct_size(message)
+    variable = message.variable_fields
+    name = message.name
+    view = name + "View"
+
+    doc = message.doc or ["{} (opcode 0x{:04X})".format(name, message.opcode)]
+    out = doc_comment(doc)
+    out.append("struct {} {{".format(name))
+    out.append("    static constexpr Opcode kOpcode = Opcode::{};".format(upper_snake(name)))
+    out.append("    static constexpr const char* kName = \"{}\";".format(name))
+    out.append("    static constexpr size_t kFixedSize = {};".format(fixed_size))
+    out.append("")
+    out.extend(emit_value_fields(schema, message))
+    out.append("")
+    out.append("    /**")
+    out.append("     * @brief 헤더를 포함한 인코딩 크기")
+    out.append("     */")
+    out.append("    size_t encoded_size() const noexcept {")
+    size_terms = ["wire::kHeaderSize", "kFixedSize"] + ["wire::bytes_wire_size({})".format(f.name) for f in variable]
+    out.append("        return {};".format(" + ".join(size_terms)))
+    out.append("    }")
+    out.append("")
+    out.append("    /**")
+    out.append("     * @brief destination에 encoded_size() 바이트를 기록")
+    out.append("     */")
+    out.append("    void encode_to(char* destination) const noexcept {")
+    out.append("        wire::store<uint16_t>(destination, static_cast<uint16_t>(kOpcode));")
+    if message.fixed_fields:
+        out.append("        char* body = destination + wire::kHeaderSize;")
+        out.extend(emit_fixed_stores(schema, message, "body", "        "))
+    if variable:
+        out.append("        char* cursor = destination + wire::kHeaderSize + kFixedSize;")
+        for field in variable:
+            out.append("        cursor = wire::store_bytes(cursor, {});".format(field.name))
+    out.append("    }")
+    out.append("};")
+    out.append("")
+
+    out.append("/**")
+    out.append(" * @brief 수신 프레임 위의 {} 뷰 (복사 없음, 프레임 버퍼보다 오래 살 수 없음)".format(name))
+    out.append(" */")
+    out.append("class {} {{".format(view))
+    out.append("public:")
+    out.append("    using Message = {};".format(name))
+    out.append("    static constexpr Opcode kOpcode = Message::kOpcode;")
+    out.append("")
+    out.append("    /**")
+    out.append("     * @brief opcode를 제외한 본문에 바인드 (길이 검사만 수행)")
+    out.append("     */")
+    out.append("    bool bind(std::string_view body) noexcept {")
+    if not variable:
+        out.append("        if (body.size() != Message::kFixedSize) {")
+        out.append("            return false;")
+        out.append("        }")
+    else:
+        out.append("        if (body.size() < Message::kFixedSize) {")
+        out.append("            return false;")
+        out.append("        }")
+        out.append("        size_t offset = Message::kFixedSize;")
+        for field in variable:
+            out.append("        if (!wire::check_bytes(body, offset, {0}_offset_, {0}_size_)) {{".format(field.name))
+            out.append("            return false;")
+            out.append("        }")
+        out.append("        if (offset != body.size()) {")
+        out.append("            return false;")
+        out.append("        }")
+    out.append("        data_ = body.data();")
+    out.append("        return true;")
+    out.append("    }")
+    out.append("")
+    out.append("    /**")
+    out.append("     * @brief opcode 헤더를 포함한 전체 프레임에 바인드")
+    out.append("     */")
+    out.append("    bool bind_frame(std::string_view frame) noexcept {")
+    out.append("        uint16_t opcode = 0;")
+    out.append("        return wire::peek_opcode(frame, opcode) && opcode == static_cast<uint16_t>(kOpcode) &&")
+    out.append("               bind(frame.substr(wire::kHeaderSize));")
+    out.append("    }")
+    out.append("")
+
+    offset = 0
+    offsets = {}
+    for field in message.fixed_fields:
+        offsets[field.name] = offset
+        offset += schema.wire_size(field.type_name)
+
+    for field in message.fields:
+        cpp_type = schema.cpp_type(field.type_name)
+        if field.type_name in SCALAR_TYPES:
+            out.append("    {} {}() const noexcept {{ return wire::load<{}>(data_ + {}); }}".format(
+                cpp_type, field.name, cpp_type, offsets[field.name]))
+        elif field.type_name in VARIABLE_TYPES:
+            out.append("    std::string_view {0}() const noexcept {{ return {{data_ + {0}_offset_, {0}_size_}}; }}".format(
+                field.name))
+        else:
+            out.append("    {} {}() const noexcept {{ return {}::load(data_ + {}); }}".format(
+                cpp_type, field.name, field.type_name, offsets[field.name]))
+    out.append("")
+    out.append("    /**")
+    out.append("     * @brief 값 구조체로 변환 (string/bytes 필드는 여전히 프레임을 가리킴)")
+    out.append("     */")
+    out.append("    Message to_message() const noexcept {")
+    out.append("        return Message{")
+    for field in message.fields:
+        out.append("            .{0} = {0}(),".format(field.name))
+    out.append("        };")
+    out.append("    }")
+    out.append("")
+    out.append("private:")
+    out.append("    const char* data_ = nullptr;")
+    for field in variable:
+        out.append("    uint32_t {}_offset_ = 0;".format(field.name))
+        out.append("    uint16_t {}_size_ = 0;".format(field.name))
+    out.append("};")
+    return out
+
+
+def generate(schema, schema_path):
+    messages = sorted(schema.messages, key=lambda m: m.opcode)
+    out = []
+    out.append("// 자동 생성 파일 - 직접 수정하지 마세요.")
+    out.append("// 원본: {}".format(os.path.basename(schema_path)))
+    out.append("// 생성기: tools/protocol_gen/protocol_gen.py")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include \"protocol/wire.hpp\"")
+    out.append("#include <array>")
+    out.append("#include <cstddef>")
+    out.append("#include <cstdint>")
+    out.append("#include <string_view>")
+    out.append("")
+    out.append("namespace {} {{".format(schema.namespace))
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief 메시지 opcode (프레임 앞 2바이트, little-endian)")
+    out.append(" */")
+    out.append("enum class Opcode : uint16_t {")
+    for message in messages:
+        out.append("    {} = 0x{:04X},".format(upper_snake(message.name), message.opcode))
+    out.append("};")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief 메시지 메타데이터 (검증/모니터링용)")
+    out.append(" */")
+    out.append("struct MessageInfo {")
+    out.append("    uint16_t opcode;")
+    out.append("    const char* name;")
+    out.append("    size_t min_frame_size;  // 헤더 + 고정 필드 + 가변 필드 길이 접두사")
+    out.append("    bool variable_size;")
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr std::array<MessageInfo, {}> kMessages = {{{{".format(len(messages)))
+    for message in messages:
+        min_size = 2 + schema.struct_size(message) + 2 * len(message.variable_fields)
+        out.append("    {{0x{:04X}, \"{}\", {}, {}}},".format(
+            message.opcode, message.name, min_size, "true" if message.variable_fields else "false"))
+    out.append("}};")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief opcode의 메타데이터 (스키마에 없으면 nullptr)")
+    out.append(" */")
+    out.append("constexpr const MessageInfo* find_message(uint16_t opcode) noexcept {")
+    out.append("    for (const auto& info : kMessages) {")
+    out.append("        if (info.opcode == opcode) {")
+    out.append("            return &info;")
+    out.append("        }")
+    out.append("    }")
+    out.append("    return nullptr;")
+    out.append("}")
+    out.append("")
+
+    for struct in schema.structs.values():
+        out.extend(emit_struct(schema, struct))
+        out.append("")
+
+    for message in schema.messages:
+        out.extend(emit_message(schema, message))
+        out.append("")
+
+    out.append("/**")
+    out.append(" * @brief 프레임의 opcode에 따라 handler.handle(const XxxView&, context...) 호출")
+    out.append(" *")
+    out.append(" * 핸들러 오버로드는 컴파일 시점에 결정되며 opcode 분기는 switch 점프 테이블로 컴파일됩니다.")
+    out.append(" * 핸들러가 처리하지 않는 메시지는 디코드하지 않고 UNHANDLED를 반환합니다.")
+    out.append(" */")
+    out.append("template <typename Handler, typename... Context>")
+    out.append("inline DispatchResult dispatch(std::string_view frame, Handler& handler, Context&&... context) {")
+    out.append("    uint16_t opcode = 0;")
+    out.append("    if (!wire::peek_opcode(frame, opcode)) {")
+    out.append("        return DispatchResult::MALFORMED;")
+    out.append("    }")
+    out.append("")
+    out.append("    const std::string_view body = frame.substr(wire::kHeaderSize);")
+    out.append("    switch (static_cast<Opcode>(opcode)) {")
+    for message in messages:
+        out.append("        case Opcode::{}:".format(upper_snake(message.name)))
+        out.append("            return detail::dispatch_as<{}View>(body, handler, context...);".format(message.name))
+    out.append("    }")
+    out.append("    return DispatchResult::UNKNOWN_OPCODE;")
+    out.append("}")
+    out.append("")
+    out.append("}} // namespace {}".format(schema.namespace))
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate C++ codecs from a protocol schema")
+    parser.add_argument("--schema", required=True, help="schema file (protocol/*.schema)")
+    parser.add_argument("--output", required=True, help="generated header path")
+    args = parser.parse_args()
+
+    try:
+        with open(args.schema, encoding="utf-8") as f:
+            schema = parse_schema(f.read(), args.schema)
+    except (OSError, SchemaError) as error:
+        print("protocol_gen: {}".format(error), file=sys.stderr)
+        return 1
+
+    header = generate(schema, args.schema)
+
+    output_dir = os.path.dirname(args.output)
+    if output_dir:
+        os.makedirs(output_dir, exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())